@@ -0,0 +1,239 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// LoopPlaybackRenderer.h
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <cmath>
+
+// Plays an in-memory loop locked to the host's musical position.
+//
+// While the host transport runs, every output sample's loop phase is computed
+// from the block's PPQ and the current tempo, so the loop stays sample-locked
+// to the bar grid and follows tempo changes (varispeed, read with 4-point
+// Hermite interpolation). With the transport stopped it free-runs at its
+// native rate. Jumps in phase (transport relocation, a tempo jump, starting
+// the host) are crossfaded, and so is the loop seam, tail into head, over the
+// same short window. render() never allocates or locks.
+class LoopPlaybackRenderer
+{
+public:
+    static constexpr int maxChannels = 32;
+
+    void prepare(double sampleRateToUse) noexcept
+    {
+        sampleRate = sampleRateToUse > 0.0 ? sampleRateToUse : 44100.0;
+        crossfadeSamples = juce::jlimit(16, 1024, juce::roundToInt(sampleRate * crossfadeSeconds));
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        phase = 0.0;
+        hasPhase = false;
+        fadeRemaining = 0;
+        seamRemaining = 0;
+        seamPhase = 0.0;
+        seamOffset.fill(0.0f);
+    }
+
+    // Restart from a loop position in source samples; used for seeks while the
+    // host is stopped.
+    void setPhase(double newPhase) noexcept
+    {
+        jumpTo(newPhase);
+    }
+
+    double getPhase() const noexcept { return phase; }
+
+    // Adds numSamples of the loop into dest. When hostIsPlaying is false the
+    // ppq and bpm arguments are ignored.
+    void render(const juce::AudioBuffer<float>& source,
+                double loopLengthBeats,
+                bool hostIsPlaying,
+                double ppqAtBlockStart,
+                double bpm,
+                juce::AudioBuffer<float>& dest,
+                int destStartSample,
+                int numSamples,
+                int numDestChannels) noexcept
+    {
+        const int loopLength = source.getNumSamples();
+        const int sourceChannels = source.getNumChannels();
+        if (loopLength < 4 || sourceChannels <= 0 || numSamples <= 0)
+            return;
+
+        double increment = 1.0;
+
+        if (hostIsPlaying && loopLengthBeats > 0.0 && bpm > 0.0)
+        {
+            const double samplesPerBeat = (double)loopLength / loopLengthBeats;
+            increment = samplesPerBeat * bpm / (60.0 * sampleRate);
+
+            double beatInLoop = std::fmod(ppqAtBlockStart, loopLengthBeats);
+            if (beatInLoop < 0.0)
+                beatInLoop += loopLengthBeats;
+
+            const double lockedPhase = wrap(beatInLoop * samplesPerBeat, loopLength);
+
+            // Sub-sample differences are just PPQ rounding; snap silently.
+            if (!hasPhase || circularDistance(phase, lockedPhase, loopLength) > resyncToleranceSamples)
+                jumpTo(lockedPhase);
+            else
+                phase = lockedPhase;
+        }
+
+        hasPhase = true;
+        const int channelsToRender = juce::jmin(numDestChannels, dest.getNumChannels(), maxChannels);
+
+        std::array<float*, maxChannels> destData{};
+        for (int channel = 0; channel < channelsToRender; ++channel)
+            destData[(size_t)channel] = dest.getWritePointer(channel, destStartSample);
+
+        // The 4-point read of the last two samples already reaches into the
+        // head, so the tail hands over to the seam crossfade just before them
+        const double seamStart = (double)(loopLength - 2);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            // Until phase wraps round to the head only the replayed tail plays
+            const bool headPending = seamRemaining > 0 && phase >= seamStart;
+            const float fadeIn = fadeRemaining > 0 ? 1.0f - (float)fadeRemaining / (float)crossfadeSamples : 1.0f;
+            const float seamIn = headPending ? 0.0f
+                               : seamRemaining > 0 ? 1.0f - (float)seamRemaining / (float)crossfadeSamples : 1.0f;
+
+            for (int channel = 0; channel < channelsToRender; ++channel)
+            {
+                // Mono sources feed every output channel
+                const int sourceChannel = sourceChannels == 1 ? 0 : channel;
+                if (sourceChannel >= sourceChannels)
+                    continue;
+
+                const float* data = source.getReadPointer(sourceChannel);
+                float value = readInterpolated(data, loopLength, phase);
+
+                if (seamRemaining > 0)
+                    value = value * seamIn
+                          + (readInterpolated(data, loopLength, seamPhase) + seamOffset[(size_t)channel]) * (1.0f - seamIn);
+
+                if (fadeRemaining > 0)
+                    value = value * fadeIn + readInterpolated(data, loopLength, fadePhase) * (1.0f - fadeIn);
+
+                destData[(size_t)channel][i] += value;
+            }
+
+            if (fadeRemaining > 0)
+            {
+                --fadeRemaining;
+                fadePhase = wrap(fadePhase + increment, loopLength);
+            }
+
+            if (seamRemaining > 0)
+            {
+                if (!headPending)
+                    --seamRemaining;
+
+                seamPhase = wrap(seamPhase + increment, loopLength);
+            }
+
+            const double tailPhase = phase;
+            phase += increment;
+
+            if (tailPhase < seamStart && phase >= seamStart)
+                startSeamCrossfade(source, channelsToRender, tailPhase, increment);
+
+            if (phase >= (double)loopLength)
+                phase -= (double)loopLength;
+        }
+    }
+
+private:
+    static double wrap(double value, int length) noexcept
+    {
+        value = std::fmod(value, (double)length);
+        return value < 0.0 ? value + (double)length : value;
+    }
+
+    static double circularDistance(double a, double b, int length) noexcept
+    {
+        const double difference = std::abs(a - b);
+        return juce::jmin(difference, (double)length - difference);
+    }
+
+    static float readInterpolated(const float* data, int length, double position) noexcept
+    {
+        const int index = (int)position;
+        const float t = (float)(position - (double)index);
+
+        const float y0 = data[index > 0 ? index - 1 : length - 1];
+        const float y1 = data[index];
+        const float y2 = data[index + 1 < length ? index + 1 : 0];
+        const float y3 = data[(index + 2) % length];
+
+        // 4-point, 3rd-order Hermite
+        const float c1 = 0.5f * (y2 - y0);
+        const float c2 = y0 - 2.5f * y1 + 2.0f * y2 - 0.5f * y3;
+        const float c3 = 0.5f * (y3 - y0) + 1.5f * (y1 - y2);
+        return ((c3 * t + c2) * t + c1) * t + y1;
+    }
+
+    void jumpTo(double newPhase) noexcept
+    {
+        // The jump crossfade takes over from any seam in progress
+        seamRemaining = 0;
+
+        if (hasPhase)
+        {
+            fadePhase = phase;
+            fadeRemaining = crossfadeSamples;
+        }
+
+        phase = newPhase;
+        hasPhase = true;
+    }
+
+    // The head rarely starts where the tail ended. There is nothing past the
+    // end of the loop to fade out under the head, so a stretch of the tail
+    // is replayed in its place: picked up one step after tailPhase, the last
+    // position played, offset so it joins the tail without a step, and faded
+    // out as the head fades in. The loop keeps its length, so the host lock
+    // is undisturbed.
+    void startSeamCrossfade(const juce::AudioBuffer<float>& source, int channelsToRender,
+                            double tailPhase, double increment) noexcept
+    {
+        const int loopLength = source.getNumSamples();
+        const int sourceChannels = source.getNumChannels();
+
+        // Long enough that the replay ends before the tail's own last
+        // samples, so its reads never wrap into the head either
+        const double replayLength = juce::jmin((double)(crossfadeSamples + 4) * increment + 4.0,
+                                               (double)loopLength - 1.0);
+        const double replayPhase = wrap(tailPhase - replayLength, loopLength);
+
+        for (int channel = 0; channel < channelsToRender; ++channel)
+        {
+            const int sourceChannel = juce::jmin(sourceChannels == 1 ? 0 : channel, sourceChannels - 1);
+            const float* data = source.getReadPointer(sourceChannel);
+            seamOffset[(size_t)channel] = readInterpolated(data, loopLength, tailPhase)
+                                        - readInterpolated(data, loopLength, replayPhase);
+        }
+
+        seamPhase = wrap(replayPhase + increment, loopLength);
+        seamRemaining = crossfadeSamples;
+    }
+
+    static constexpr double crossfadeSeconds = 0.005;
+    static constexpr double resyncToleranceSamples = 2.0;
+
+    double sampleRate = 44100.0;
+    int crossfadeSamples = 220;
+
+    double phase = 0.0;
+    bool hasPhase = false;
+    double fadePhase = 0.0;
+    int fadeRemaining = 0;
+    int seamRemaining = 0;
+    double seamPhase = 0.0;                     // Where the replayed tail reads
+    std::array<float, maxChannels> seamOffset{};
+};
@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// PeakKernel.h
+#pragma once
+#include <JuceHeader.h>
+#include <cmath>
+
+// Min/max/RMS of a channel-averaged span of audio, shared by every waveform
+// summary: the peak pyramid, the live recording feed and the displays that
+// still read raw samples when zoomed in close.
+//
+// Work goes a block at a time. The channel average is mixed into a small
+// stack buffer with FloatVectorOperations (a mono source is read in place),
+// the extremes of the block come from findMinAndMax, and the sum of squares
+// runs four independent accumulators so it isn't one serial chain of adds.
+// Results match the per-sample loops it replaced apart from float rounding
+// in the average and the sum of squares.
+class PeakKernel
+{
+public:
+    struct Summary
+    {
+        float min = 0.0f;       // Extremes include 0, matching how the waveforms have always drawn
+        float max = 0.0f;
+        float sumSquares = 0.0f;
+        int count = 0;
+
+        float getRms() const noexcept
+        {
+            return count > 0 ? std::sqrt(sumSquares / (float)count) : 0.0f;
+        }
+    };
+
+    static constexpr int blockSamples = 256;
+
+    // Summary of source[startSample, startSample + numSamples), averaging the
+    // first numChannels channels. The range must lie within the buffer.
+    static Summary summarise(const juce::AudioBuffer<float>& source, int startSample, int numSamples,
+                             int numChannels) noexcept
+    {
+        Summary summary;
+        const int channels = juce::jmin(numChannels, source.getNumChannels());
+        if (channels <= 0 || numSamples <= 0)
+            return summary;
+
+        jassert(startSample >= 0 && startSample + numSamples <= source.getNumSamples());
+
+        const float channelScale = 1.0f / (float)channels;
+        float mixed[blockSamples];
+
+        for (int done = 0; done < numSamples;)
+        {
+            const int count = juce::jmin(blockSamples, numSamples - done);
+            const int position = startSample + done;
+            const float* values = source.getReadPointer(0, position);
+
+            if (channels > 1)
+            {
+                juce::FloatVectorOperations::copyWithMultiply(mixed, values, channelScale, count);
+                for (int channel = 1; channel < channels; ++channel)
+                    juce::FloatVectorOperations::addWithMultiply(mixed, source.getReadPointer(channel, position),
+                                                                 channelScale, count);
+                values = mixed;
+            }
+
+            const auto range = juce::FloatVectorOperations::findMinAndMax(values, count);
+            summary.min = juce::jmin(summary.min, range.getStart());
+            summary.max = juce::jmax(summary.max, range.getEnd());
+            summary.sumSquares += sumOfSquares(values, count);
+            done += count;
+        }
+
+        summary.count = numSamples;
+        return summary;
+    }
+
+private:
+    static float sumOfSquares(const float* values, int count) noexcept
+    {
+        float lane0 = 0.0f, lane1 = 0.0f, lane2 = 0.0f, lane3 = 0.0f;
+        int i = 0;
+
+        for (; i + 4 <= count; i += 4)
+        {
+            lane0 += values[i] * values[i];
+            lane1 += values[i + 1] * values[i + 1];
+            lane2 += values[i + 2] * values[i + 2];
+            lane3 += values[i + 3] * values[i + 3];
+        }
+
+        float sum = (lane0 + lane1) + (lane2 + lane3);
+        for (; i < count; ++i)
+            sum += values[i] * values[i];
+        return sum;
+    }
+};
@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// PeakPyramid.h
+#pragma once
+#include <JuceHeader.h>
+#include "PeakKernel.h"
+#include <array>
+#include <cmath>
+#include <vector>
+
+// Min/max/RMS summary of a mono (channel-averaged) signal at power-of-two
+// resolutions, so a waveform can be drawn in time proportional to its width
+// rather than its length.
+//
+// Level 0 holds one bucket per baseBlockSamples; each level above merges
+// pairs from the one below. Samples are fed in with refresh(), which only
+// recomputes the level-0 buckets the range touches and the parents above
+// them, so appending a block of a live recording or patching part of a
+// buffer costs the size of the change, not of the whole signal. Buckets
+// summarised on another thread can be added whole with appendBucket().
+//
+// A query picks the coarsest level whose buckets still fit several times into
+// the requested span, so it reads a handful of buckets whatever the span is.
+// Bucket edges need not line up with the span, so a result can include up to
+// one bucket either side of it; at that level a bucket is a fraction of a
+// pixel. Spans shorter than baseBlockSamples should be read from the audio.
+class PeakPyramid
+{
+public:
+    struct Peak
+    {
+        float min = 0.0f;
+        float max = 0.0f;
+        float rms = 0.0f;
+    };
+
+    static constexpr int baseBlockSamples = 64;
+    static constexpr int maxLevels = 20;
+
+    void reset()
+    {
+        for (auto& level : levels)
+            level.clear();
+        numSamples = 0;
+    }
+
+    int getNumSamples() const noexcept { return numSamples; }
+    bool isEmpty() const noexcept { return numSamples <= 0; }
+
+    // Reads source[startSample, startSample + count) as the pyramid's samples
+    // at those same positions, growing it if the range runs past the end.
+    // Whole level-0 buckets are recomputed, so the samples either side of the
+    // range within those buckets must also be valid in source.
+    void refresh(const juce::AudioBuffer<float>& source, int startSample, int count)
+    {
+        const int channels = source.getNumChannels();
+        startSample = juce::jmax(0, startSample);
+        const int end = juce::jmin(startSample + count, source.getNumSamples());
+        if (channels <= 0 || end <= startSample)
+            return;
+
+        numSamples = juce::jmax(numSamples, end);
+
+        const int firstBucket = startSample / baseBlockSamples;
+        const int lastBucket = (end - 1) / baseBlockSamples;
+        auto& base = levels[0];
+        base.resize((size_t)bucketsFor(numSamples, 0));
+
+        for (int bucket = firstBucket; bucket <= lastBucket; ++bucket)
+        {
+            const int from = bucket * baseBlockSamples;
+            const int to = juce::jmin(from + baseBlockSamples, numSamples);
+            const auto summary = PeakKernel::summarise(source, from, to - from, channels);
+
+            auto& stored = base[(size_t)bucket];
+            stored.min = summary.min;
+            stored.max = summary.max;
+            stored.sumSquares = summary.sumSquares;
+            stored.count = summary.count;
+        }
+
+        propagate(firstBucket, lastBucket);
+    }
+
+    // Adds one level-0 bucket that was summarised elsewhere. The pyramid must
+    // end on a bucket boundary; only the last bucket of a signal may be short.
+    void appendBucket(float min, float max, float sumSquares, int count)
+    {
+        jassert(numSamples % baseBlockSamples == 0 && count > 0 && count <= baseBlockSamples);
+
+        Bucket summary;
+        summary.min = juce::jmin(0.0f, min);
+        summary.max = juce::jmax(0.0f, max);
+        summary.sumSquares = sumSquares;
+        summary.count = count;
+
+        const int bucket = numSamples / baseBlockSamples;
+        numSamples += count;
+        levels[0].push_back(summary);
+        propagate(bucket, bucket);
+    }
+
+    // Summary of [startSample, endSample).
+    Peak getPeak(int startSample, int endSample) const
+    {
+        startSample = juce::jmax(0, startSample);
+        endSample = juce::jmin(endSample, numSamples);
+        if (endSample <= startSample)
+            return {};
+
+        // Coarsest level with at least four buckets to the span
+        const int span = endSample - startSample;
+        int level = 0;
+        while (level + 1 < maxLevels && (baseBlockSamples << (level + 1)) * 4 <= span)
+            ++level;
+
+        const int bucketSamples = baseBlockSamples << level;
+        const auto& buckets = levels[(size_t)level];
+        const int first = startSample / bucketSamples;
+        const int last = juce::jmin((int)buckets.size(), (endSample + bucketSamples - 1) / bucketSamples);
+
+        Bucket merged;
+        for (int bucket = first; bucket < last; ++bucket)
+            merged.merge(buckets[(size_t)bucket]);
+
+        Peak peak;
+        peak.min = merged.min;
+        peak.max = merged.max;
+        peak.rms = merged.count > 0 ? std::sqrt(merged.sumSquares / (float)merged.count) : 0.0f;
+        return peak;
+    }
+
+private:
+    struct Bucket
+    {
+        float min = 0.0f;       // Extremes include 0, matching how the waveforms have always drawn
+        float max = 0.0f;
+        float sumSquares = 0.0f;
+        int count = 0;
+
+        void merge(const Bucket& other) noexcept
+        {
+            min = juce::jmin(min, other.min);
+            max = juce::jmax(max, other.max);
+            sumSquares += other.sumSquares;
+            count += other.count;
+        }
+    };
+
+    static int bucketsFor(int samples, int level) noexcept
+    {
+        const int bucketSamples = baseBlockSamples << level;
+        return (samples + bucketSamples - 1) / bucketSamples;
+    }
+
+    // Rebuilds the parents of level-0 buckets [firstBucket, lastBucket].
+    void propagate(int firstBucket, int lastBucket)
+    {
+        for (int level = 1; level < maxLevels; ++level)
+        {
+            const auto& below = levels[(size_t)(level - 1)];
+            auto& current = levels[(size_t)level];
+            current.resize((size_t)bucketsFor(numSamples, level));
+
+            firstBucket /= 2;
+            lastBucket /= 2;
+
+            for (int bucket = firstBucket; bucket <= lastBucket && bucket < (int)current.size(); ++bucket)
+            {
+                Bucket merged;
+                const int child = bucket * 2;
+                if (child < (int)below.size())
+                    merged.merge(below[(size_t)child]);
+                if (child + 1 < (int)below.size())
+                    merged.merge(below[(size_t)child + 1]);
+                current[(size_t)bucket] = merged;
+            }
+        }
+    }
+
+    std::array<std::vector<Bucket>, maxLevels> levels;
+    int numSamples = 0;
+};
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// RealtimeHandoff.h
+#pragma once
+#include <JuceHeader.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Publishes immutable objects to the audio thread without locks or refcounts.
+//
+// The audio thread brackets each block with a ScopedRead, which bumps an epoch
+// counter to odd on entry and back to even on exit. Publishing swaps the raw
+// pointer and parks the previous object in a retire list stamped with the
+// epoch seen at swap time. A retired object is only freed once the reader was
+// outside a block at swap time or has since moved to another epoch, and the
+// freeing always happens on the publisher's thread or the message-thread timer,
+// never inside processBlock.
+//
+// There must be exactly one realtime reader. Other threads that need to look
+// at the current object use readLocked().
+template <typename Object>
+class RealtimeHandoff : private juce::Timer
+{
+public:
+    RealtimeHandoff() = default;
+
+    ~RealtimeHandoff() override
+    {
+        stopTimer();
+
+        const juce::ScopedLock lock(publishLock);
+        retired.clear();
+        std::unique_ptr<Object> last(current.exchange(nullptr));
+    }
+
+    // Any non-realtime thread. Ownership moves to the handoff.
+    void publish(std::unique_ptr<Object> next)
+    {
+        const juce::ScopedLock lock(publishLock);
+
+        auto* previous = current.exchange(next.release(), std::memory_order_seq_cst);
+        if (previous != nullptr)
+            retired.push_back({ std::unique_ptr<Object>(previous), readerEpoch.load(std::memory_order_seq_cst) });
+
+        collectRetired();
+
+        if (!retired.empty())
+            startTimer(collectIntervalMs);
+    }
+
+    // Runs fn(const Object*) with the current object held stable. Not for the audio thread.
+    template <typename Function>
+    void readLocked(Function&& function) const
+    {
+        const juce::ScopedLock lock(publishLock);
+        function(static_cast<const Object*>(current.load(std::memory_order_acquire)));
+    }
+
+    int getNumRetired() const
+    {
+        const juce::ScopedLock lock(publishLock);
+        return (int)retired.size();
+    }
+
+    // Audio thread only: holds the current object for the lifetime of the scope.
+    class ScopedRead
+    {
+    public:
+        explicit ScopedRead(RealtimeHandoff& ownerToUse) noexcept
+            : owner(ownerToUse)
+        {
+            owner.readerEpoch.fetch_add(1, std::memory_order_seq_cst);
+            object = owner.current.load(std::memory_order_seq_cst);
+        }
+
+        ~ScopedRead() noexcept
+        {
+            owner.readerEpoch.fetch_add(1, std::memory_order_release);
+        }
+
+        const Object* get() const noexcept { return object; }
+        const Object* operator->() const noexcept { return object; }
+        explicit operator bool() const noexcept { return object != nullptr; }
+
+    private:
+        RealtimeHandoff& owner;
+        const Object* object = nullptr;
+
+        JUCE_DECLARE_NON_COPYABLE(ScopedRead)
+    };
+
+private:
+    struct Retired
+    {
+        std::unique_ptr<Object> object;
+        std::uint64_t epochAtRetire = 0;
+    };
+
+    void timerCallback() override
+    {
+        const juce::ScopedLock lock(publishLock);
+        collectRetired();
+
+        if (retired.empty())
+            stopTimer();
+    }
+
+    // Caller holds publishLock.
+    void collectRetired()
+    {
+        const auto epochNow = readerEpoch.load(std::memory_order_seq_cst);
+
+        retired.erase(std::remove_if(retired.begin(), retired.end(),
+            [epochNow](const Retired& entry)
+            {
+                const bool readerWasIdle = (entry.epochAtRetire & 1) == 0;
+                return readerWasIdle || entry.epochAtRetire != epochNow;
+            }),
+            retired.end());
+    }
+
+    static constexpr int collectIntervalMs = 50;
+
+    std::atomic<Object*> current{ nullptr };
+    std::atomic<std::uint64_t> readerEpoch{ 0 };
+    mutable juce::CriticalSection publishLock;
+    std::vector<Retired> retired;
+
+    JUCE_DECLARE_NON_COPYABLE(RealtimeHandoff)
+};
@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// RecordingPeakFeed.h
+#pragma once
+#include <JuceHeader.h>
+#include "PeakKernel.h"
+#include "PeakPyramid.h"
+#include <array>
+#include <atomic>
+
+// Waveform summaries of a take as it is recorded, passed from the thread that
+// writes the take to the editor without locks.
+//
+// The writer feeds in the samples it appends to the recording buffer; each
+// time PeakPyramid::baseBlockSamples of them have arrived, one bucket goes
+// into the FIFO. Every bucket carries the take's content revision and where
+// it starts, so the reader can tell a new take from the current one. Buckets
+// that don't fit because the FIFO is full (nobody reading, say, with the
+// editor closed) are counted; a reader that sees the count move rebuilds from
+// a locked snapshot and carries on from the feed. The count matters most at
+// the end of a long take, where no later bucket arrives to show the hole.
+//
+// One writer at a time (the processor serialises them with its writer lock)
+// and one reader, the message thread.
+class RecordingPeakFeed
+{
+public:
+    struct Bucket
+    {
+        juce::uint32 revision = 0;
+        int startSample = 0;
+        int numSamples = 0;
+        float min = 0.0f;
+        float max = 0.0f;
+        float sumSquares = 0.0f;
+    };
+
+    static constexpr int capacity = 8192;   // About 10 s of audio at 48 kHz
+
+    //==========================================================================
+    // Writer side
+
+    void beginTake(juce::uint32 revision) noexcept
+    {
+        pending = {};
+        pending.revision = revision;
+    }
+
+    // Averages the first numChannels channels, like the pyramid it feeds.
+    void add(const juce::AudioBuffer<float>& source, int startSample, int numSamples, int numChannels) noexcept
+    {
+        while (numSamples > 0)
+        {
+            const int count = juce::jmin(numSamples, PeakPyramid::baseBlockSamples - pending.numSamples);
+            const auto summary = PeakKernel::summarise(source, startSample, count, numChannels);
+
+            pending.min = juce::jmin(pending.min, summary.min);
+            pending.max = juce::jmax(pending.max, summary.max);
+            pending.sumSquares += summary.sumSquares;
+            pending.numSamples += count;
+            startSample += count;
+            numSamples -= count;
+
+            if (pending.numSamples == PeakPyramid::baseBlockSamples)
+                emit();
+        }
+    }
+
+    // Silence padded into the take leaves the extremes alone.
+    void addSilence(int numSamples) noexcept
+    {
+        while (numSamples > 0)
+        {
+            const int count = juce::jmin(numSamples, PeakPyramid::baseBlockSamples - pending.numSamples);
+            pending.numSamples += count;
+            numSamples -= count;
+
+            if (pending.numSamples == PeakPyramid::baseBlockSamples)
+                emit();
+        }
+    }
+
+    // Sends the partial bucket at the end of a take.
+    void endTake() noexcept
+    {
+        if (pending.numSamples > 0)
+            emit();
+    }
+
+    //==========================================================================
+    // Reader side
+
+    // Buckets dropped so far. Read it before draining: if it differs from
+    // the value seen last time, the summary built from the feed has a hole.
+    juce::uint32 getNumDropped() const noexcept { return dropped.load(std::memory_order_acquire); }
+
+    template <typename Function>
+    void drain(Function&& function)
+    {
+        const auto scope = fifo.read(fifo.getNumReady());
+        for (int i = 0; i < scope.blockSize1; ++i)
+            function(buckets[(size_t)(scope.startIndex1 + i)]);
+        for (int i = 0; i < scope.blockSize2; ++i)
+            function(buckets[(size_t)(scope.startIndex2 + i)]);
+    }
+
+private:
+    void emit() noexcept
+    {
+        // A full FIFO drops the bucket; the reader sees the count and resyncs
+        if (fifo.getFreeSpace() > 0)
+        {
+            const auto scope = fifo.write(1);
+            buckets[(size_t)(scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2)] = pending;
+        }
+        else
+        {
+            dropped.fetch_add(1, std::memory_order_release);
+        }
+
+        const auto revision = pending.revision;
+        const int nextStart = pending.startSample + pending.numSamples;
+        pending = {};
+        pending.revision = revision;
+        pending.startSample = nextStart;
+    }
+
+    juce::AbstractFifo fifo { capacity };
+    std::array<Bucket, (size_t)capacity> buckets {};
+    Bucket pending;     // Writer only
+    std::atomic<juce::uint32> dropped { 0 };
+};
@@ -0,0 +1,247 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// RecordingRing.h
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+// Single-producer / single-consumer chunk ring between processBlock and the
+// recording writer thread. The audio thread only ever copies into preallocated
+// chunks and bumps an AbstractFifo index; it never locks, allocates or waits.
+// Take boundaries travel through the same ring as markers so the writer sees
+// them in exactly the order the audio thread produced them.
+//
+// If the writer stalls long enough for the ring to fill, the audio that could
+// not be queued is counted and a Gap marker carrying its length goes into the
+// ring ahead of the next audio chunk. The writer pads the gap with silence, so
+// a stall costs audio but never shifts the rest of the take in time.
+class RecordingRing
+{
+public:
+    enum class ChunkKind : int
+    {
+        Audio,
+        TakeStart,
+        TakeStop,
+        Gap         // numSamples of input that were dropped at this point
+    };
+
+    struct Chunk
+    {
+        ChunkKind kind = ChunkKind::Audio;
+        int numSamples = 0;
+    };
+
+    RecordingRing() = default;
+
+    // Message thread only, while the writer is idle and processBlock is not running.
+    void prepare(int numChannelsToUse, int samplesPerChunk, int numChunksToUse)
+    {
+        numChannels = juce::jmax(1, numChannelsToUse);
+        chunkSamples = juce::jmax(32, samplesPerChunk);
+        numChunks = juce::jmax(2, numChunksToUse);
+
+        storage.setSize(numChannels, chunkSamples * numChunks, false, true, false);
+        storage.clear();
+        chunks.assign((size_t)numChunks, Chunk{});
+
+        fifo = std::make_unique<juce::AbstractFifo>(numChunks);
+        resetCounters();
+    }
+
+    bool isPrepared() const noexcept { return fifo != nullptr; }
+    int getNumChannels() const noexcept { return numChannels; }
+    int getChunkSamples() const noexcept { return chunkSamples; }
+    int getCapacitySamples() const noexcept { return chunkSamples * numChunks; }
+
+    // Discards anything still queued. Only valid while both sides are quiescent.
+    void reset() noexcept
+    {
+        if (fifo != nullptr)
+            fifo->reset();
+
+        resetCounters();
+    }
+
+    //==========================================================================
+    // Producer side (audio thread)
+
+    // Take boundaries. Loss still pending at a boundary belonged to the take
+    // being closed, so it is not carried into the next one.
+    bool pushMarker(ChunkKind kind) noexcept
+    {
+        jassert(kind == ChunkKind::TakeStart || kind == ChunkKind::TakeStop);
+
+        if (!pushChunk(kind, 0))
+            return false;
+
+        pendingGapSamples = 0;
+        return true;
+    }
+
+    // Returns the number of samples actually queued; anything short of
+    // numSamples is counted in getDroppedSamples() and reported to the writer
+    // as a Gap before the next audio that does fit.
+    int pushAudio(const juce::AudioBuffer<float>& source, int numSourceChannels, int numSamples) noexcept
+    {
+        if (pendingGapSamples > 0)
+        {
+            if (!pushChunk(ChunkKind::Gap, pendingGapSamples))
+            {
+                recordDrop(numSamples);
+                return 0;
+            }
+
+            pendingGapSamples = 0;
+        }
+
+        int written = 0;
+
+        while (written < numSamples)
+        {
+            const int index = reserveChunk();
+            if (index < 0)
+                break;
+
+            const int count = juce::jmin(chunkSamples, numSamples - written);
+            const int storageStart = index * chunkSamples;
+
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                auto* dest = storage.getWritePointer(channel, storageStart);
+
+                if (channel < numSourceChannels && channel < source.getNumChannels())
+                    juce::FloatVectorOperations::copy(dest, source.getReadPointer(channel, written), count);
+                else
+                    juce::FloatVectorOperations::clear(dest, count);
+            }
+
+            chunks[(size_t)index] = { ChunkKind::Audio, count };
+            fifo->finishedWrite(1);
+            written += count;
+        }
+
+        if (written < numSamples)
+            recordDrop(numSamples - written);
+
+        const int queued = fifo != nullptr ? fifo->getNumReady() : 0;
+        if (queued > peakQueuedChunks.load(std::memory_order_relaxed))
+            peakQueuedChunks.store(queued, std::memory_order_relaxed);
+
+        return written;
+    }
+
+    //==========================================================================
+    // Consumer side (writer thread)
+
+    int getNumReady() const noexcept
+    {
+        return fifo != nullptr ? fifo->getNumReady() : 0;
+    }
+
+    // Calls visitor(const Chunk&, const juce::AudioBuffer<float>& storage, int storageStart)
+    // for up to maxChunks queued chunks in order, releasing each one once visited.
+    // The visitor returns false to leave the chunk queued and stop draining.
+    template <typename Visitor>
+    int drain(Visitor&& visitor, int maxChunks = std::numeric_limits<int>::max())
+    {
+        if (fifo == nullptr)
+            return 0;
+
+        int consumed = 0;
+
+        while (consumed < maxChunks)
+        {
+            int start1 = 0, size1 = 0, start2 = 0, size2 = 0;
+            fifo->prepareToRead(1, start1, size1, start2, size2);
+            if (size1 <= 0)
+                break;
+
+            if (!visitor(chunks[(size_t)start1], static_cast<const juce::AudioBuffer<float>&>(storage),
+                         start1 * chunkSamples))
+                break;
+
+            fifo->finishedRead(1);
+            ++consumed;
+        }
+
+        return consumed;
+    }
+
+    //==========================================================================
+    // Overflow accounting (any thread)
+
+    juce::int64 getDroppedSamples() const noexcept
+    {
+        return droppedSamples.load(std::memory_order_acquire);
+    }
+
+    // Number of separate stalls that lost audio.
+    int getOverflowCount() const noexcept
+    {
+        return overflowCount.load(std::memory_order_acquire);
+    }
+
+    // Deepest the ring has been since prepare() or reset(), from 0 to 1.
+    float getPeakFill() const noexcept
+    {
+        return numChunks > 0 ? (float)peakQueuedChunks.load(std::memory_order_relaxed) / (float)numChunks : 0.0f;
+    }
+
+private:
+    bool pushChunk(ChunkKind kind, int numSamples) noexcept
+    {
+        const int index = reserveChunk();
+        if (index < 0)
+            return false;
+
+        chunks[(size_t)index] = { kind, numSamples };
+        fifo->finishedWrite(1);
+        return true;
+    }
+
+    void recordDrop(int numSamples) noexcept
+    {
+        if (pendingGapSamples == 0)
+            overflowCount.fetch_add(1, std::memory_order_relaxed);
+
+        // A Gap chunk carries an int; a stall that long has bigger problems.
+        pendingGapSamples = (int)juce::jmin((juce::int64)std::numeric_limits<int>::max() / 2,
+                                            (juce::int64)pendingGapSamples + numSamples);
+        droppedSamples.fetch_add(numSamples, std::memory_order_relaxed);
+    }
+
+    void resetCounters() noexcept
+    {
+        pendingGapSamples = 0;
+        droppedSamples.store(0, std::memory_order_release);
+        overflowCount.store(0, std::memory_order_release);
+        peakQueuedChunks.store(0, std::memory_order_release);
+    }
+
+    int reserveChunk() noexcept
+    {
+        if (fifo == nullptr)
+            return -1;
+
+        int start1 = 0, size1 = 0, start2 = 0, size2 = 0;
+        fifo->prepareToWrite(1, start1, size1, start2, size2);
+        return size1 > 0 ? start1 : -1;
+    }
+
+    juce::AudioBuffer<float> storage;
+    std::vector<Chunk> chunks;
+    std::unique_ptr<juce::AbstractFifo> fifo;
+    int numChannels = 0;
+    int chunkSamples = 0;
+    int numChunks = 0;
+    int pendingGapSamples = 0;   // Producer side
+    std::atomic<juce::int64> droppedSamples{ 0 };
+    std::atomic<int> overflowCount{ 0 };
+    std::atomic<int> peakQueuedChunks{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE(RecordingRing)
+};
@@ -0,0 +1,293 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// ResultIngest.h
+#pragma once
+#include <JuceHeader.h>
+#include "PeakPyramid.h"
+#include "StreamingResampler.h"
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+
+// Turns a generated result into everything the editor and the playback engine
+// need, on a background thread.
+//
+// A job reads its source once into memory, installs those bytes at the
+// destination, and decodes the audio from the same memory block. From that
+// one decode it builds the waveform summary and, for outputs short enough to
+// hold in memory, a copy at the host rate that playback can use without
+// opening the file again. Decoding and resampling go a block at a time and
+// give up as soon as the thread is asked to stop, so shutdown never waits on
+// a long file.
+//
+// The finished Result is immutable and shared: the editor draws from it and
+// the processor plays from it through the same Handle. Jobs run in the order
+// they were queued, so an older install can never land on top of a newer one;
+// the owner drops callbacks it no longer wants by serial.
+class ResultIngest : private juce::Thread
+{
+public:
+    struct Result
+    {
+        juce::File file;                        // Where the output now lives
+        juce::AudioBuffer<float> audio;         // At the file's own rate
+        double sampleRate = 44100.0;
+
+        PeakPyramid peaks;                      // Channel-averaged, for drawing
+
+        // Host-rate copy for playback. Empty when the file is already at the
+        // host rate (audio is used directly) or too long to keep in memory.
+        juce::AudioBuffer<float> resampled;
+        double playbackRate = 0.0;              // 0 if playback has to stream the file
+
+        int getNumSamples() const noexcept { return audio.getNumSamples(); }
+        double getDurationSeconds() const noexcept { return (double)audio.getNumSamples() / sampleRate; }
+
+        // nullptr if playback has to stream the file
+        const juce::AudioBuffer<float>* getPlaybackBuffer() const noexcept
+        {
+            if (playbackRate <= 0.0)
+                return nullptr;
+            return resampled.getNumSamples() > 0 ? &resampled : &audio;
+        }
+    };
+
+    using Handle = std::shared_ptr<const Result>;
+
+    // Runs on the ingest thread. handle is nullptr if the job failed.
+    using Callback = std::function<void(Handle handle, const juce::String& error)>;
+
+    static constexpr double maxInMemorySeconds = 120.0;
+
+    ResultIngest() : juce::Thread("gary4juce result ingest") {}
+
+    ~ResultIngest() override
+    {
+        stopThread(4000);
+    }
+
+    // Installs a decoded temporary file at destination. The temporary is kept
+    // alive until the job has read it.
+    void ingestFile(std::shared_ptr<const juce::TemporaryFile> source, const juce::File& destination,
+                    double hostRate, Callback callback)
+    {
+        Job job;
+        job.temporary = std::move(source);
+        job.destination = destination;
+        queue(std::move(job), hostRate, std::move(callback));
+    }
+
+    // Decodes a temporary file ahead of time without touching destination.
+    // The result already names destination as its file; install() puts the
+    // bytes there once the result is actually wanted.
+    void prepareFile(std::shared_ptr<const juce::TemporaryFile> source, const juce::File& destination,
+                     double hostRate, Callback callback)
+    {
+        Job job;
+        job.temporary = std::move(source);
+        job.destination = destination;
+        job.deferInstall = true;
+        queue(std::move(job), hostRate, std::move(callback));
+    }
+
+    // Installs the temporary a prepared result was decoded from at the
+    // result's file. The callback gets the same handle back, or nullptr if
+    // the copy failed.
+    void install(Handle prepared, std::shared_ptr<const juce::TemporaryFile> source, Callback callback)
+    {
+        Job job;
+        job.temporary = std::move(source);
+        job.destination = prepared != nullptr ? prepared->file : juce::File();
+        job.prepared = std::move(prepared);
+        queue(std::move(job), 0.0, std::move(callback));
+    }
+
+    // Reads a file that is already in place (startup, restore, crop).
+    void reload(const juce::File& file, double hostRate, Callback callback)
+    {
+        Job job;
+        job.destination = file;
+        queue(std::move(job), hostRate, std::move(callback));
+    }
+
+    // Builds a result from audio that is already decoded, for callers that
+    // have just written it to file themselves.
+    static Handle fromBuffer(const juce::File& file, juce::AudioBuffer<float> audio,
+                             double sampleRate, double hostRate)
+    {
+        auto result = std::make_shared<Result>();
+        result->file = file;
+        result->audio = std::move(audio);
+        result->sampleRate = sampleRate;
+        finish(*result, hostRate);
+        return result;
+    }
+
+private:
+    struct Job
+    {
+        std::shared_ptr<const juce::TemporaryFile> temporary;
+        juce::File destination;
+        bool deferInstall = false;
+        Handle prepared;                        // Set for install-only jobs
+        double hostRate = 44100.0;
+        Callback callback;
+    };
+
+    void queue(Job job, double hostRate, Callback callback)
+    {
+        job.hostRate = hostRate;
+        job.callback = std::move(callback);
+
+        {
+            const juce::ScopedLock lock(jobLock);
+            jobs.push_back(std::move(job));
+        }
+
+        if (!isThreadRunning())
+            startThread(juce::Thread::Priority::background);
+        notify();
+    }
+
+    void run() override
+    {
+        while (!threadShouldExit())
+        {
+            Job job;
+            bool haveJob = false;
+
+            {
+                const juce::ScopedLock lock(jobLock);
+                if (!jobs.empty())
+                {
+                    job = std::move(jobs.front());
+                    jobs.pop_front();
+                    haveJob = true;
+                }
+            }
+
+            if (!haveJob)
+            {
+                wait(-1);
+                continue;
+            }
+
+            juce::String error;
+            auto handle = process(job, error);
+
+            if (!threadShouldExit() && job.callback)
+                job.callback(std::move(handle), error);
+        }
+    }
+
+    Handle process(const Job& job, juce::String& error)
+    {
+        // The only read of the source
+        juce::MemoryBlock bytes;
+        const bool needsInstall = job.temporary != nullptr && !job.deferInstall;
+        const auto source = job.temporary != nullptr ? job.temporary->getFile() : job.destination;
+
+        if (job.prepared != nullptr)
+        {
+            if (job.temporary == nullptr || !source.loadFileAsData(bytes) || bytes.isEmpty()
+                || !install(bytes, job.destination))
+            {
+                error = "couldn't save audio";
+                return nullptr;
+            }
+
+            return job.prepared;
+        }
+
+        if (!source.loadFileAsData(bytes))
+        {
+            error = "couldn't read audio";
+            return nullptr;
+        }
+
+        if (bytes.isEmpty())
+        {
+            error = "no audio received";
+            return nullptr;
+        }
+
+        if (needsInstall && !install(bytes, job.destination))
+        {
+            error = "couldn't save audio";
+            return nullptr;
+        }
+
+        juce::AudioFormatManager formatManager;
+        formatManager.registerBasicFormats();
+        std::unique_ptr<juce::AudioFormatReader> reader(
+            formatManager.createReaderFor(std::make_unique<juce::MemoryInputStream>(bytes, false)));
+
+        if (reader == nullptr || reader->sampleRate <= 0.0
+            || reader->numChannels == 0 || reader->lengthInSamples <= 0
+            || reader->lengthInSamples > std::numeric_limits<int>::max())
+        {
+            error = "couldn't read audio";
+            return nullptr;
+        }
+
+        auto result = std::make_shared<Result>();
+        result->file = job.destination;
+        result->sampleRate = reader->sampleRate;
+
+        const int numSamples = (int)reader->lengthInSamples;
+        result->audio.setSize((int)reader->numChannels, numSamples);
+
+        for (int position = 0; position < numSamples; position += decodeBlockSamples)
+        {
+            if (threadShouldExit())
+                return nullptr;
+
+            reader->read(&result->audio, position, juce::jmin(decodeBlockSamples, numSamples - position),
+                         position, true, true);
+        }
+
+        reader.reset();
+
+        const auto shouldStop = [this] { return threadShouldExit(); };
+        finish(*result, job.hostRate, shouldStop);
+
+        if (threadShouldExit())
+            return nullptr;
+
+        return result;
+    }
+
+    static bool install(const juce::MemoryBlock& bytes, const juce::File& destination)
+    {
+        if (!destination.getParentDirectory().createDirectory().wasOk())
+            return false;
+
+        juce::TemporaryFile temporary(destination);
+        if (!temporary.getFile().replaceWithData(bytes.getData(), bytes.getSize()))
+            return false;
+
+        return temporary.overwriteTargetFileWithTemporary();
+    }
+
+    // shouldStop cuts the resample short; the caller then drops the result.
+    static void finish(Result& result, double hostRate, const std::function<bool()>& shouldStop = {})
+    {
+        result.peaks.refresh(result.audio, 0, result.audio.getNumSamples());
+
+        if (hostRate <= 0.0 || result.getDurationSeconds() > maxInMemorySeconds)
+            return;
+
+        if (hostRate != result.sampleRate)
+            result.resampled = StreamingResampler::resampleBuffer(result.audio, result.sampleRate, hostRate,
+                                                                  StreamingResampler::Quality::High, shouldStop);
+
+        result.playbackRate = hostRate;
+    }
+
+    static constexpr int decodeBlockSamples = 1 << 16;
+
+    juce::CriticalSection jobLock;
+    std::deque<Job> jobs;
+};
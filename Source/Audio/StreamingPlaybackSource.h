@@ -0,0 +1,479 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// StreamingPlaybackSource.h
+#pragma once
+#include <JuceHeader.h>
+#include "StreamingResampler.h"
+#include "TransportSnapshot.h"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+// Disk-backed playback of a generated output at the host sample rate.
+//
+// A TimeSliceThread client reads the file a few chunks at a time, resamples
+// them block by block and queues host-rate chunks in a lock-free ring. The
+// audio thread only copies out of that ring. Opening a source reads the file
+// header and nothing else, so playback can start as soon as the first chunk
+// lands, whatever the file length.
+//
+// The reader is opened once, memory-mapped where the format allows, and kept
+// between read-ahead passes. It is let go once the whole file has been read or
+// read-ahead has sat idle for readerIdleMs, so a stopped or finished take
+// never holds the file while the editor replaces myOutput.wav, and is opened
+// again when there is more to read. If the file changes underneath us the
+// stream simply ends where it got to.
+//
+// Seeks take effect through a generation counter: chunks carry the
+// generation they were rendered for and the audio thread drops anything
+// stale. Only the message thread posts seeks. While playing, a seek is cued:
+// read-ahead renders the new position behind the material already queued,
+// and the audio thread switches to it at the sample the seek is due, or as
+// soon after that as the first chunks are ready. Until then the old material
+// keeps playing, so a seek never leaves a gap.
+class StreamingPlaybackSource : private juce::TimeSliceClient
+{
+public:
+    ~StreamingPlaybackSource() override
+    {
+        readAheadThread.removeTimeSliceClient(this);
+    }
+
+    // Returns nullptr if the file cannot be read. Message thread.
+    static std::unique_ptr<StreamingPlaybackSource> open(const juce::File& file,
+                                                         double hostSampleRate,
+                                                         juce::TimeSliceThread& thread)
+    {
+        auto source = std::unique_ptr<StreamingPlaybackSource>(
+            new StreamingPlaybackSource(file, hostSampleRate, thread));
+
+        if (!source->isValid())
+            return nullptr;
+
+        thread.addTimeSliceClient(source.get());
+        return source;
+    }
+
+    int getNumChannels() const noexcept { return numChannels; }
+    double getSampleRate() const noexcept { return hostRate; }
+    double getFileSampleRate() const noexcept { return fileRate; }
+    juce::int64 getTotalLength() const noexcept { return totalLength; }
+
+    // Message thread: move to a host-rate sample position at the start of the
+    // next addNextBlock(). For a stream that is not playing.
+    void seek(juce::int64 hostSamplePosition)
+    {
+        hostSamplePosition = clampPosition(hostSamplePosition);
+
+        // Already there with nothing pending: keep what is queued
+        const auto current = seekRequest.load();
+        if (current.generation == consumerGenerationSeen.load(std::memory_order_acquire)
+            && hostSamplePosition == playbackPosition.load(std::memory_order_acquire))
+            return;
+
+        postSeek(hostSamplePosition, true);
+    }
+
+    // Message thread: start rendering from a host-rate sample position
+    // without disturbing what is playing. The audio thread moves to it with
+    // switchToCue().
+    void cue(juce::int64 hostSamplePosition)
+    {
+        postSeek(clampPosition(hostSamplePosition), false);
+    }
+
+    // Audio thread: play the latest cue from here on. If its first chunks are
+    // not queued yet the current material carries on and the switch happens
+    // in whichever later addNextBlock() finds them ready.
+    void switchToCue() noexcept
+    {
+        switchPending = true;
+    }
+
+    // Audio thread: take the latest seek or cue now, ready or not. For when
+    // nothing is playing, so there is no material to hold on to.
+    void jumpToCue() noexcept
+    {
+        applySeek(seekRequest.load());
+    }
+
+    juce::int64 getPlaybackPosition() const noexcept
+    {
+        return playbackPosition.load(std::memory_order_acquire);
+    }
+
+    bool isFinished() const noexcept
+    {
+        return playbackPosition.load(std::memory_order_acquire) >= playableLength.load(std::memory_order_acquire);
+    }
+
+    // Audio thread: adds up to numSamples of queued audio into dest starting at
+    // destStartSample and returns how many were available. A short return is an
+    // underrun (or the end of the stream); the position only advances by what
+    // was actually played.
+    int addNextBlock(juce::AudioBuffer<float>& dest, int destStartSample, int numSamples, int numDestChannels) noexcept
+    {
+        const auto request = seekRequest.load();
+        if (request.generation != consumerGeneration
+            && (request.immediate
+                || (switchPending && readyGeneration.load(std::memory_order_acquire) == request.generation)))
+            applySeek(request);
+
+        int mixed = 0;
+
+        while (mixed < numSamples)
+        {
+            int start1 = 0, size1 = 0, start2 = 0, size2 = 0;
+            fifo.prepareToRead(1, start1, size1, start2, size2);
+            if (size1 <= 0)
+                break;
+
+            const auto& chunk = chunks[(size_t)start1];
+            if (chunk.generation != consumerGeneration)
+            {
+                // Rendered for a cue not switched to yet
+                if ((std::int32_t)(chunk.generation - consumerGeneration) > 0)
+                    break;
+
+                fifo.finishedRead(1);
+                frontChunkOffset = 0;
+                continue;
+            }
+
+            if (frontChunkOffset == 0)
+                consumerPosition = chunk.startPosition;
+
+            const int count = juce::jmin(chunk.numSamples - frontChunkOffset, numSamples - mixed);
+            const int storageStart = start1 * chunkSamples + frontChunkOffset;
+
+            for (int channel = 0; channel < numDestChannels; ++channel)
+            {
+                // Mono sources feed every output channel
+                const int sourceChannel = numChannels == 1 ? 0 : channel;
+                if (sourceChannel < numChannels)
+                    juce::FloatVectorOperations::add(dest.getWritePointer(channel, destStartSample + mixed),
+                                                     storage.getReadPointer(sourceChannel, storageStart),
+                                                     count);
+            }
+
+            mixed += count;
+            frontChunkOffset += count;
+            consumerPosition += count;
+
+            if (frontChunkOffset >= chunk.numSamples)
+            {
+                fifo.finishedRead(1);
+                frontChunkOffset = 0;
+            }
+        }
+
+        playbackPosition.store(consumerPosition, std::memory_order_release);
+        return mixed;
+    }
+
+private:
+    struct Chunk
+    {
+        std::uint32_t generation = 0;
+        juce::int64 startPosition = 0;
+        int numSamples = 0;
+    };
+
+    // Written by the message thread only, read by both other threads
+    struct SeekRequest
+    {
+        juce::int64 target = 0;
+        std::uint32_t generation = 0;
+        bool immediate = true;
+    };
+
+    juce::int64 clampPosition(juce::int64 hostSamplePosition) const noexcept
+    {
+        return juce::jlimit((juce::int64)0, juce::jmax((juce::int64)0, totalLength - 1), hostSamplePosition);
+    }
+
+    void postSeek(juce::int64 hostSamplePosition, bool immediate)
+    {
+        SeekRequest request;
+        request.target = hostSamplePosition;
+        request.generation = ++lastSeekGeneration;
+        request.immediate = immediate;
+        seekRequest.store(request);
+        readAheadThread.moveToFrontOfQueue(this);
+    }
+
+    void applySeek(const SeekRequest& request) noexcept
+    {
+        switchPending = false;
+        if (request.generation == consumerGeneration)
+            return;
+
+        // Chunks still queued for the old position are dropped as they
+        // reach the front
+        consumerGeneration = request.generation;
+        consumerPosition = request.target;
+        frontChunkOffset = 0;
+        playbackPosition.store(consumerPosition, std::memory_order_release);
+        consumerGenerationSeen.store(request.generation, std::memory_order_release);
+    }
+
+    StreamingPlaybackSource(const juce::File& fileToUse, double hostSampleRate, juce::TimeSliceThread& thread)
+        : file(fileToUse),
+          readAheadThread(thread),
+          fifo(numChunks)
+    {
+        formatManager.registerBasicFormats();
+
+        reader = openReader();
+        if (reader == nullptr || reader->sampleRate <= 0.0 || reader->numChannels == 0
+            || (int)reader->numChannels > maxChannels
+            || reader->lengthInSamples <= 0 || hostSampleRate <= 0.0)
+            return;
+
+        numChannels = (int)reader->numChannels;
+        fileRate = reader->sampleRate;
+        hostRate = hostSampleRate;
+        fileLength = reader->lengthInSamples;
+        speedRatio = fileRate / hostRate;
+        fileModificationTime = file.getLastModificationTime();
+
+        storage.setSize(numChannels, chunkSamples * numChunks);
+        storage.clear();
+        chunks.assign((size_t)numChunks, Chunk{});
+
+        resampler.prepare(numChannels, fileRate, hostRate, StreamingResampler::Quality::Standard);
+        totalLength = resampler.getOutputLength(fileLength);
+        playableLength.store(totalLength, std::memory_order_release);
+
+        // One file block in, and whatever the resampler produced beyond the
+        // chunk being rendered carried over to the next one.
+        sourceBlock.setSize(numChannels, sourceBlockSamples);
+        sourceBlock.clear();
+        pendingOutput.setSize(numChannels, chunkSamples + resampler.getMaxOutputSamples(sourceBlockSamples));
+        pendingOutput.clear();
+        jassert(resampler.getPrimingLength() <= sourceBlockSamples);
+    }
+
+    std::unique_ptr<juce::AudioFormatReader> openReader() const
+    {
+        // Mapped reads are plain memory copies, with no file calls per pass
+        if (auto* format = formatManager.findFormatForFileExtension(file.getFileExtension()))
+        {
+            std::unique_ptr<juce::MemoryMappedAudioFormatReader> mapped(format->createMemoryMappedReader(file));
+            if (mapped != nullptr && mapped->mapEntireFile())
+                return mapped;
+        }
+
+        return std::unique_ptr<juce::AudioFormatReader>(formatManager.createReaderFor(file));
+    }
+
+    bool isValid() const noexcept { return totalLength > 0; }
+
+    int useTimeSlice() override
+    {
+        const auto request = seekRequest.load();
+        if (request.generation != producerGeneration || !producerStarted)
+        {
+            producerGeneration = request.generation;
+            producerStarted = true;
+            producedInGeneration = 0;
+            resetProducer(request.target);
+        }
+
+        if (producerPosition >= playableLength.load(std::memory_order_acquire))
+        {
+            reader.reset();
+            readyGeneration.store(producerGeneration, std::memory_order_release);
+            return idleIntervalMs;
+        }
+
+        if (fifo.getFreeSpace() <= getReservedChunks())
+        {
+            if (reader != nullptr && juce::Time::getMillisecondCounter() - lastReadMs > (juce::uint32)readerIdleMs)
+                reader.reset();
+
+            return fullIntervalMs;
+        }
+
+        if (file.getLastModificationTime() != fileModificationTime)
+        {
+            DBG("Streaming playback source changed on disk - ending stream at "
+                + juce::String(producerPosition));
+            reader.reset();
+            playableLength.store(producerPosition, std::memory_order_release);
+            return idleIntervalMs;
+        }
+
+        if (reader == nullptr)
+            reader = openReader();
+
+        if (reader == nullptr)
+        {
+            playableLength.store(producerPosition, std::memory_order_release);
+            return idleIntervalMs;
+        }
+
+        lastReadMs = juce::Time::getMillisecondCounter();
+
+        for (int rendered = 0; rendered < maxChunksPerSlice; ++rendered)
+        {
+            if (seekRequest.load().generation != producerGeneration)
+                return 0;
+
+            if (producerPosition >= totalLength)
+            {
+                readyGeneration.store(producerGeneration, std::memory_order_release);
+                return 0;
+            }
+
+            if (fifo.getFreeSpace() <= getReservedChunks())
+                return fullIntervalMs;
+
+            int start1 = 0, size1 = 0, start2 = 0, size2 = 0;
+            fifo.prepareToWrite(1, start1, size1, start2, size2);
+            if (size1 <= 0)
+                return fullIntervalMs;
+
+            const int count = (int)juce::jmin((juce::int64)chunkSamples, totalLength - producerPosition);
+            renderChunk(start1 * chunkSamples, count);
+
+            chunks[(size_t)start1] = { producerGeneration, producerPosition, count };
+            fifo.finishedWrite(1);
+            producerPosition += count;
+
+            if (++producedInGeneration == cueChunks)
+                readyGeneration.store(producerGeneration, std::memory_order_release);
+        }
+
+        return 0;
+    }
+
+    // Steady read-ahead leaves room in the ring for the first chunks of a
+    // cue, so they can queue behind the old material without waiting for it
+    // to play out.
+    int getReservedChunks() const noexcept
+    {
+        return producedInGeneration < cueChunks ? 0 : cueChunks;
+    }
+
+    // The resampler is primed by the first chunk rendered, once a reader is open
+    void resetProducer(juce::int64 hostPosition)
+    {
+        const double sourcePosition = (double)hostPosition * speedRatio;
+        producerPosition = hostPosition;
+        sourceReadPosition = (juce::int64)sourcePosition;
+        sourceStartFraction = sourcePosition - (double)sourceReadPosition;
+        pendingSamples = 0;
+        primePending = true;
+    }
+
+    void renderChunk(int storageStart, int count)
+    {
+        if (resampler.isBypassed())
+        {
+            reader->read(&storage, storageStart, count, producerPosition, true, true);
+            return;
+        }
+
+        if (primePending)
+        {
+            // The samples before the start point; the reader pads ahead of
+            // the file's start with silence
+            const int primingLength = resampler.getPrimingLength();
+            reader->read(&sourceBlock, 0, primingLength, sourceReadPosition - primingLength, true, true);
+            resampler.resetAt(sourceBlock.getArrayOfReadPointers(), sourceStartFraction);
+            primePending = false;
+        }
+
+        while (pendingSamples < count)
+        {
+            // Past the end of the file the reader pads with silence, which
+            // pushes the last real samples out through the kernel.
+            reader->read(&sourceBlock, 0, sourceBlockSamples, sourceReadPosition, true, true);
+            sourceReadPosition += sourceBlockSamples;
+
+            float* outputs[maxChannels] = {};
+            for (int channel = 0; channel < numChannels; ++channel)
+                outputs[channel] = pendingOutput.getWritePointer(channel, pendingSamples);
+
+            pendingSamples += resampler.process(sourceBlock.getArrayOfReadPointers(), sourceBlockSamples,
+                                                outputs, pendingOutput.getNumSamples() - pendingSamples);
+        }
+
+        const int remaining = pendingSamples - count;
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            juce::FloatVectorOperations::copy(storage.getWritePointer(channel, storageStart),
+                                              pendingOutput.getReadPointer(channel), count);
+
+            if (remaining > 0)
+                std::memmove(pendingOutput.getWritePointer(channel),
+                             pendingOutput.getReadPointer(channel, count),
+                             (size_t)remaining * sizeof(float));
+        }
+
+        pendingSamples = remaining;
+    }
+
+    static constexpr int chunkSamples = 2048;
+    static constexpr int numChunks = 64;
+    static constexpr int maxChunksPerSlice = 8;
+    static constexpr int cueChunks = 4;
+    static constexpr int idleIntervalMs = 50;
+    static constexpr int fullIntervalMs = 10;
+    static constexpr int readerIdleMs = 250;
+    static constexpr int sourceBlockSamples = 1024;
+    static constexpr int maxChannels = 32;
+
+    const juce::File file;
+    juce::TimeSliceThread& readAheadThread;
+    juce::AudioFormatManager formatManager;
+    juce::Time fileModificationTime;
+
+    int numChannels = 0;
+    double fileRate = 0.0;
+    double hostRate = 0.0;
+    double speedRatio = 1.0;
+    juce::int64 fileLength = 0;
+    juce::int64 totalLength = 0;
+    std::atomic<juce::int64> playableLength{ 0 };
+
+    // Ring shared between the read-ahead thread and the audio thread
+    juce::AbstractFifo fifo;
+    juce::AudioBuffer<float> storage;
+    std::vector<Chunk> chunks;
+
+    SeqLockValue<SeekRequest> seekRequest;
+    std::atomic<std::uint32_t> readyGeneration{ 0 };
+    std::atomic<std::uint32_t> consumerGenerationSeen{ 0 };
+    std::atomic<juce::int64> playbackPosition{ 0 };
+
+    // Message thread state
+    std::uint32_t lastSeekGeneration = 0;
+
+    // Read-ahead thread state
+    std::uint32_t producerGeneration = 0;
+    bool producerStarted = false;
+    int producedInGeneration = 0;
+    juce::int64 producerPosition = 0;
+    std::unique_ptr<juce::AudioFormatReader> reader;
+    juce::uint32 lastReadMs = 0;
+    juce::int64 sourceReadPosition = 0;
+    double sourceStartFraction = 0.0;
+    bool primePending = true;
+    StreamingResampler resampler;
+    juce::AudioBuffer<float> sourceBlock;
+    juce::AudioBuffer<float> pendingOutput;
+    int pendingSamples = 0;
+
+    // Audio thread state
+    std::uint32_t consumerGeneration = 0;
+    juce::int64 consumerPosition = 0;
+    int frontChunkOffset = 0;
+    bool switchPending = false;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StreamingPlaybackSource)
+};
@@ -0,0 +1,386 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// StreamingResampler.h
+#pragma once
+#include <JuceHeader.h>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+// Block-wise windowed-sinc sample rate converter shared by every import and
+// playback path.
+//
+// Input is pushed in chunks of any size and output is produced as soon as the
+// kernel has enough look-ahead, so memory stays constant no matter how long the
+// source is. The kernel is a Kaiser-windowed sinc stored as a polyphase table;
+// coefficients for the fractional position are interpolated between adjacent
+// phases once per output sample and shared by all channels. Rows are stored
+// oldest-tap-first, the same order as the history window, so the inner loop is
+// a straight dot product over two contiguous arrays. It runs four independent
+// accumulators (tap counts are kept a multiple of four) so it isn't one
+// serial chain of adds and the compiler can vectorise it.
+//
+// Output sample m sits at input time m * sourceRate / destRate, so there is no
+// timeline offset; the kernel's look-ahead is drained by flush().
+class StreamingResampler
+{
+public:
+    enum class Quality
+    {
+        Draft,     // 8 taps, for previews
+        Standard,  // 24 taps, realtime playback
+        High       // 64 taps, offline imports
+    };
+
+    StreamingResampler() = default;
+
+    void prepare(int numChannelsToUse, double sourceRate, double destRate, Quality qualityToUse)
+    {
+        jassert(sourceRate > 0.0 && destRate > 0.0);
+
+        numChannels = juce::jmax(1, numChannelsToUse);
+        step = sourceRate / destRate;
+        bypass = std::abs(sourceRate - destRate) < 1.0e-6;
+
+        if (!bypass && (quality != qualityToUse || cutoff != computeCutoff(step) || kernel.empty()))
+        {
+            quality = qualityToUse;
+            cutoff = computeCutoff(step);
+            buildKernel();
+        }
+
+        quality = qualityToUse;
+        history.assign((size_t)numChannels, std::vector<float>((size_t)(2 * numTaps), 0.0f));
+        coefficients.assign((size_t)numTaps, 0.0f);
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        for (auto& channelHistory : history)
+            std::fill(channelHistory.begin(), channelHistory.end(), 0.0f);
+
+        writeIndex = 0;
+        inputCount = 0;
+        nextOutputTime = 0.0;
+    }
+
+    // Source samples before a start point that resetAt() wants.
+    int getPrimingLength() const noexcept { return bypass ? 0 : numTaps / 2; }
+
+    // Starts over partway through a source, e.g. after a seek. input holds
+    // the getPrimingLength() samples just before the start point, which fill
+    // the history so the kernel runs on real audio rather than fading in from
+    // silence. The first output falls startFraction of a sample after the
+    // start point.
+    void resetAt(const float* const* input, double startFraction) noexcept
+    {
+        reset();
+        if (bypass)
+            return;
+
+        const int count = getPrimingLength();
+        for (int i = 0; i < count; ++i)
+            for (int channel = 0; channel < numChannels; ++channel)
+                push(channel, input[channel][i]);
+
+        nextOutputTime = (double)count + startFraction;
+    }
+
+    int getNumChannels() const noexcept { return numChannels; }
+    double getSpeedRatio() const noexcept { return step; }
+    bool isBypassed() const noexcept { return bypass; }
+
+    // Upper bound of samples process() can produce for this many inputs.
+    int getMaxOutputSamples(int numInputSamples) const noexcept
+    {
+        return bypass ? numInputSamples : (int)std::ceil((double)numInputSamples / step) + 2;
+    }
+
+    // Output length that corresponds to a source of the given length.
+    juce::int64 getOutputLength(juce::int64 numSourceSamples) const noexcept
+    {
+        return bypass ? numSourceSamples : (juce::int64)std::floor((double)numSourceSamples / step + 1.0e-7);
+    }
+
+    // Consumes every input sample and writes what it can into output, which
+    // must have room for getMaxOutputSamples(numInputSamples). Returns the
+    // number of samples written per channel.
+    int process(const float* const* input, int numInputSamples, float* const* output, int outputCapacity) noexcept
+    {
+        if (bypass)
+        {
+            const int count = juce::jmin(numInputSamples, outputCapacity);
+            for (int channel = 0; channel < numChannels; ++channel)
+                juce::FloatVectorOperations::copy(output[channel], input[channel], count);
+            return count;
+        }
+
+        int produced = 0;
+
+        for (int i = 0; i < numInputSamples; ++i)
+        {
+            for (int channel = 0; channel < numChannels; ++channel)
+                push(channel, input[channel][i]);
+
+            produced = emitReady(output, produced, outputCapacity);
+        }
+
+        return produced;
+    }
+
+    // Feeds silence through the look-ahead so the last real samples come out.
+    int flush(float* const* output, int outputCapacity) noexcept
+    {
+        if (bypass)
+            return 0;
+
+        int produced = 0;
+
+        for (int i = 0; i < numTaps / 2; ++i)
+        {
+            for (int channel = 0; channel < numChannels; ++channel)
+                push(channel, 0.0f);
+
+            produced = emitReady(output, produced, outputCapacity);
+        }
+
+        return produced;
+    }
+
+    //==========================================================================
+    // Whole-source helpers. Both feed the resampler in fixed-size chunks, so
+    // the only allocation proportional to the source is the result itself.
+    // shouldStop is asked between chunks; if it says yes the result is empty.
+
+    static juce::AudioBuffer<float> resampleReader(juce::AudioFormatReader& reader,
+                                                   juce::int64 startSample,
+                                                   juce::int64 numSamples,
+                                                   double destRate,
+                                                   Quality quality = Quality::High)
+    {
+        const int channels = (int)reader.numChannels;
+        StreamingResampler resampler;
+        resampler.prepare(channels, reader.sampleRate, destRate, quality);
+
+        juce::AudioBuffer<float> inputChunk(channels, chunkSize);
+        return resampler.run(numSamples, [&](juce::int64 position, int count) -> const juce::AudioBuffer<float>&
+        {
+            reader.read(&inputChunk, 0, count, startSample + position, true, true);
+            return inputChunk;
+        });
+    }
+
+    static juce::AudioBuffer<float> resampleBuffer(const juce::AudioBuffer<float>& source,
+                                                   double sourceRate,
+                                                   double destRate,
+                                                   Quality quality = Quality::High,
+                                                   const std::function<bool()>& shouldStop = {})
+    {
+        const int channels = source.getNumChannels();
+        StreamingResampler resampler;
+        resampler.prepare(channels, sourceRate, destRate, quality);
+
+        juce::AudioBuffer<float> inputChunk(channels, chunkSize);
+        return resampler.run(source.getNumSamples(), [&](juce::int64 position, int count) -> const juce::AudioBuffer<float>&
+        {
+            for (int channel = 0; channel < channels; ++channel)
+                inputChunk.copyFrom(channel, 0, source, channel, (int)position, count);
+            return inputChunk;
+        }, shouldStop);
+    }
+
+private:
+    static double computeCutoff(double speedRatio) noexcept
+    {
+        // Normalised to the source Nyquist; leaves a little transition band
+        // below the lower of the two Nyquist frequencies.
+        return 0.97 * juce::jmin(1.0, 1.0 / speedRatio);
+    }
+
+    void buildKernel()
+    {
+        double beta = 0.0;
+        switch (quality)
+        {
+            case Quality::Draft:    numTaps = 8;  numPhases = 64;  beta = 5.0; break;
+            case Quality::Standard: numTaps = 24; numPhases = 256; beta = 7.5; break;
+            case Quality::High:     numTaps = 64; numPhases = 512; beta = 9.5; break;
+        }
+
+        // When downsampling the sinc widens by 1 / cutoff; keep the same
+        // number of zero crossings by widening the kernel accordingly.
+        if (cutoff < 1.0)
+            numTaps = juce::jmin(256, (int)std::ceil(numTaps / cutoff / 4.0) * 4);
+
+        jassert(numTaps % 4 == 0);
+
+        const int half = numTaps / 2;
+        const double besselBeta = besselI0(beta);
+        kernel.assign((size_t)((numPhases + 1) * numTaps), 0.0f);
+
+        for (int phase = 0; phase <= numPhases; ++phase)
+        {
+            const double fraction = (double)phase / (double)numPhases;
+            auto* row = kernel.data() + (size_t)(phase * numTaps);
+            double sum = 0.0;
+
+            for (int tap = 0; tap < numTaps; ++tap)
+            {
+                // Row entry k is applied to the input k - half samples
+                // after the output's integer position.
+                const double x = (double)(tap - half) - fraction;
+                const double normalised = x / (double)half;
+                const double window = std::abs(normalised) >= 1.0
+                    ? 0.0 : besselI0(beta * std::sqrt(1.0 - normalised * normalised)) / besselBeta;
+                const double value = cutoff * sinc(cutoff * x) * window;
+                row[tap] = (float)value;
+                sum += value;
+            }
+
+            // Unity DC gain for every phase
+            if (sum != 0.0)
+                for (int tap = 0; tap < numTaps; ++tap)
+                    row[tap] = (float)(row[tap] / sum);
+        }
+    }
+
+    static double sinc(double x) noexcept
+    {
+        if (std::abs(x) < 1.0e-9)
+            return 1.0;
+
+        const double px = juce::MathConstants<double>::pi * x;
+        return std::sin(px) / px;
+    }
+
+    static double besselI0(double x) noexcept
+    {
+        double sum = 1.0, term = 1.0;
+        const double halfX = x * 0.5;
+
+        for (int k = 1; k < 64; ++k)
+        {
+            term *= (halfX / k) * (halfX / k);
+            sum += term;
+            if (term < sum * 1.0e-12)
+                break;
+        }
+
+        return sum;
+    }
+
+    void push(int channel, float sample) noexcept
+    {
+        auto& channelHistory = history[(size_t)channel];
+        channelHistory[(size_t)writeIndex] = sample;
+        channelHistory[(size_t)(writeIndex + numTaps)] = sample;
+
+        if (channel == numChannels - 1)
+        {
+            writeIndex = (writeIndex + 1) % numTaps;
+            ++inputCount;
+        }
+    }
+
+    int emitReady(float* const* output, int produced, int outputCapacity) noexcept
+    {
+        // The window holds inputs [i - half, i + half) for i = inputCount - half,
+        // which is exactly what outputs with floor(t) == i need. Earlier outputs
+        // were emitted on earlier pushes.
+        const int half = numTaps / 2;
+        const double windowEnd = (double)(inputCount - half + 1);
+
+        while (nextOutputTime < windowEnd && produced < outputCapacity)
+        {
+            const double fraction = nextOutputTime - std::floor(nextOutputTime);
+            const double phasePosition = fraction * numPhases;
+            const int phase = juce::jmin(numPhases - 1, (int)phasePosition);
+            const float phaseFraction = (float)(phasePosition - phase);
+
+            const float* rowA = kernel.data() + (size_t)(phase * numTaps);
+            const float* rowB = rowA + numTaps;
+            float* coeffs = coefficients.data();
+
+            for (int tap = 0; tap < numTaps; ++tap)
+                coeffs[tap] = rowA[tap] + phaseFraction * (rowB[tap] - rowA[tap]);
+
+            // history[writeIndex .. writeIndex + numTaps) is oldest-to-newest,
+            // like the kernel rows
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                const float* window = history[(size_t)channel].data() + writeIndex;
+                float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+
+                for (int tap = 0; tap < numTaps; tap += 4)
+                {
+                    sum0 += window[tap] * coeffs[tap];
+                    sum1 += window[tap + 1] * coeffs[tap + 1];
+                    sum2 += window[tap + 2] * coeffs[tap + 2];
+                    sum3 += window[tap + 3] * coeffs[tap + 3];
+                }
+
+                output[channel][produced] = (sum0 + sum1) + (sum2 + sum3);
+            }
+
+            ++produced;
+            nextOutputTime += step;
+        }
+
+        return produced;
+    }
+
+    template <typename ReadChunk>
+    juce::AudioBuffer<float> run(juce::int64 numSourceSamples, ReadChunk&& readChunk,
+                                 const std::function<bool()>& shouldStop = {})
+    {
+        const auto outputLength = getOutputLength(numSourceSamples);
+        juce::AudioBuffer<float> result(numChannels, (int)outputLength);
+        result.clear();
+
+        juce::AudioBuffer<float> outputChunk(numChannels, getMaxOutputSamples(chunkSize) + numTaps);
+        int written = 0;
+
+        const auto append = [&](int produced)
+        {
+            const int toCopy = (int)juce::jmin((juce::int64)produced, outputLength - written);
+            for (int channel = 0; channel < numChannels && toCopy > 0; ++channel)
+                result.copyFrom(channel, written, outputChunk, channel, 0, toCopy);
+            written += juce::jmax(0, toCopy);
+        };
+
+        for (juce::int64 position = 0; position < numSourceSamples; position += chunkSize)
+        {
+            if (shouldStop && shouldStop())
+                return {};
+
+            const int count = (int)juce::jmin((juce::int64)chunkSize, numSourceSamples - position);
+            const auto& inputChunk = readChunk(position, count);
+            append(process(inputChunk.getArrayOfReadPointers(), count,
+                           outputChunk.getArrayOfWritePointers(), outputChunk.getNumSamples()));
+        }
+
+        append(flush(outputChunk.getArrayOfWritePointers(), outputChunk.getNumSamples()));
+        return result;
+    }
+
+    static constexpr int chunkSize = 16384;
+
+    Quality quality = Quality::Standard;
+    int numChannels = 1;
+    int numTaps = 24;
+    int numPhases = 256;
+    double step = 1.0;
+    double cutoff = 0.0;
+    bool bypass = true;
+
+    std::vector<float> kernel;
+    std::vector<float> coefficients;
+    std::vector<std::vector<float>> history;
+    int writeIndex = 0;
+    juce::int64 inputCount = 0;
+    double nextOutputTime = 0.0;
+
+    JUCE_DECLARE_NON_COPYABLE(StreamingResampler)
+};
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// TransportSnapshot.h
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <cmath>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Single-writer sequence lock for small trivially copyable values.
+//
+// The writer never waits: it bumps the sequence to odd, stores the payload as
+// relaxed atomic words and bumps it back to even. Readers retry until they see
+// the same even sequence on both sides of their copy. Suitable for publishing
+// a few dozen bytes from the audio thread to the UI once per block.
+template <typename Value>
+class SeqLockValue
+{
+public:
+    static_assert(std::is_trivially_copyable<Value>::value, "SeqLockValue needs a trivially copyable type");
+
+    SeqLockValue() noexcept { store(Value{}); }
+
+    void store(const Value& value) noexcept
+    {
+        std::array<std::uint64_t, numWords> words{};
+        std::memcpy(words.data(), &value, sizeof(Value));
+
+        const auto sequenceNow = sequence.load(std::memory_order_relaxed);
+        sequence.store(sequenceNow + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (size_t i = 0; i < numWords; ++i)
+            storage[i].store(words[i], std::memory_order_relaxed);
+
+        sequence.store(sequenceNow + 2, std::memory_order_release);
+    }
+
+    Value load() const noexcept
+    {
+        std::array<std::uint64_t, numWords> words{};
+
+        for (;;)
+        {
+            const auto before = sequence.load(std::memory_order_acquire);
+            if ((before & 1) != 0)
+                continue;
+
+            for (size_t i = 0; i < numWords; ++i)
+                words[i] = storage[i].load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before)
+                break;
+        }
+
+        Value value;
+        std::memcpy(&value, words.data(), sizeof(Value));
+        return value;
+    }
+
+private:
+    static constexpr size_t numWords = (sizeof(Value) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    std::atomic<std::uint32_t> sequence{ 0 };
+    std::array<std::atomic<std::uint64_t>, numWords> storage{};
+
+    JUCE_DECLARE_NON_COPYABLE(SeqLockValue)
+};
+
+// Where output playback got to at the end of the most recent audio block,
+// stamped with the wall-clock time that sample is due. The editor extrapolates
+// from here instead of polling.
+struct OutputTransportSnapshot
+{
+    juce::int64 readPosition = 0;      // Playback sample at block end
+    juce::int64 hostSampleTime = 0;    // Processor sample clock at block end
+    juce::int64 totalSamples = 0;
+    double sampleRate = 0.0;
+    double timestampMs = 0.0;          // Block start in Time::getMillisecondCounterHiRes() plus block duration
+    int blockSize = 0;
+    std::uint32_t seekSerial = 0;      // Last seek request the audio thread applied
+    bool playing = false;
+    bool looping = false;              // Position wraps at totalSamples
+
+    // Estimated playback position at the given wall-clock time. Hosts run
+    // blocks early, so the estimate may sit up to a block behind the snapshot;
+    // it runs at most two blocks past it so a stalled host freezes the cursor
+    // instead of letting it drift away.
+    double getPositionSecondsAt(double nowMs) const noexcept
+    {
+        if (sampleRate <= 0.0)
+            return 0.0;
+
+        double position = (double)readPosition;
+
+        if (playing)
+        {
+            const double block = (double)juce::jmax(1, blockSize);
+            const double elapsed = juce::jlimit(-block, block * 2.0, (nowMs - timestampMs) * 0.001 * sampleRate);
+            position += elapsed;
+
+            if (looping && totalSamples > 0)
+            {
+                position = std::fmod(position, (double)totalSamples);
+                if (position < 0.0)
+                    position += (double)totalSamples;
+            }
+            else
+            {
+                position = juce::jlimit(0.0, (double)totalSamples, position);
+            }
+        }
+
+        return position / sampleRate;
+    }
+
+    // Estimated processor sample clock at the given wall-clock time.
+    juce::int64 getHostSampleTimeAt(double nowMs) const noexcept
+    {
+        if (sampleRate <= 0.0)
+            return hostSampleTime;
+
+        return hostSampleTime + (juce::int64)((nowMs - timestampMs) * 0.001 * sampleRate);
+    }
+};
+
+// A seek posted from the message thread. The audio thread applies it at
+// hostSampleTime, which usually lands inside the next block.
+struct OutputSeekRequest
+{
+    juce::int64 targetSample = 0;
+    juce::int64 hostSampleTime = 0;
+    std::uint32_t serial = 0;
+};
@@ -8,6 +8,7 @@
 */
 
 #include "AudioSelectionDialog.h"
+#include "../Audio/PeakKernel.h"
 #include "../Utils/Theme.h"
 #include <cmath>
 
@@ -382,22 +383,11 @@ void AudioSelectionDialog::drawWaveform(juce::Graphics& g, const juce::Rectangle
 
         if (endSample > startSample)
         {
-            // Find min/max in this pixel's worth of samples
-            float minVal = 0.0f, maxVal = 0.0f;
-
-            for (int sample = startSample; sample < endSample; ++sample)
-            {
-                // Average across channels
-                float sampleValue = 0.0f;
-                for (int ch = 0; ch < audioBuffer.getNumChannels(); ++ch)
-                {
-                    sampleValue += audioBuffer.getSample(ch, sample);
-                }
-                sampleValue /= audioBuffer.getNumChannels();
-
-                minVal = juce::jmin(minVal, sampleValue);
-                maxVal = juce::jmax(maxVal, sampleValue);
-            }
+            // Find min/max in this pixel's worth of samples, averaged across channels
+            const auto peak = PeakKernel::summarise(audioBuffer, startSample, endSample - startSample,
+                                                    audioBuffer.getNumChannels());
+            const float minVal = peak.min;
+            const float maxVal = peak.max;
 
             // Scale to display area
             const int minY = juce::jlimit(area.getY(), area.getBottom(),
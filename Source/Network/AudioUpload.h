@@ -0,0 +1,288 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// AudioUpload.h
+#pragma once
+#include <JuceHeader.h>
+#include "Base64Codec.h"
+#include "HttpClient.h"
+#include "LocalConnectionPool.h"
+#include <memory>
+#include <mutex>
+#include <set>
+
+// Sends conditioning audio to a backend endpoint as a file, not base64 JSON.
+//
+// The request goes out as multipart/form-data: a "request" part holding the
+// JSON fields and a file part holding the WAV under the field name the JSON
+// body used to carry it in. Localhost requests stream straight from disk in
+// fixed-size blocks; remote ones go through juce::URL's file upload, which at
+// least skips the base64 string and the JSON copy of it.
+//
+// Backends that don't accept multipart answer with a 404/405/415/422. The
+// request is then repeated once as the old base64 JSON body, and the endpoint
+// is remembered so later uploads go straight to JSON.
+class AudioUpload
+{
+public:
+    // The audio to send, copied aside when the request is made so a new
+    // recording or output can't change it mid-upload. The copy is deleted when
+    // the last holder lets go.
+    using Source = std::shared_ptr<const juce::TemporaryFile>;
+
+    static Source snapshot(const juce::File& audioFile)
+    {
+        if (!audioFile.existsAsFile() || audioFile.getSize() <= 0)
+            return nullptr;
+
+        auto copy = std::make_shared<juce::TemporaryFile>(audioFile.getFileExtension());
+        if (!audioFile.copyFileTo(copy->getFile()))
+            return nullptr;
+
+        return copy;
+    }
+
+    // Posts fields plus audio to endpoint. Returns the response stream like
+    // URL::createInputStream, filling options' status code and response
+    // headers when given. fields is left without the audio property.
+    static std::unique_ptr<juce::InputStream> post(const juce::URL& endpoint,
+                                                   juce::DynamicObject& fields,
+                                                   const juce::String& audioField,
+                                                   const Source& audio,
+                                                   const juce::URL::InputStreamOptions& options)
+    {
+        if (audio == nullptr)
+            return nullptr;
+
+        const auto endpointKey = endpoint.toString(false);
+        const auto baseHeaders = withoutContentType(options.getExtraHeaders());
+
+        int statusCode = 0;
+        const auto statusOptions = options.withStatusCode(&statusCode);
+
+        if (!acceptsOnlyJson(endpointKey))
+        {
+            auto stream = postMultipart(endpoint, fields, audioField, audio->getFile(),
+                                        statusOptions.withExtraHeaders(baseHeaders));
+
+            if (stream == nullptr || !isMultipartRejection(statusCode))
+                return finish(std::move(stream), statusCode, options);
+
+            DBG("[upload] " + endpointKey + " rejected multipart (" + juce::String(statusCode)
+                + "), retrying as base64 JSON");
+
+            if (auto* responseHeaders = options.getResponseHeaders())
+                responseHeaders->clear();
+            statusCode = 0;
+
+            auto fallback = postBase64Json(endpoint, fields, audioField, audio->getFile(), statusOptions, baseHeaders);
+            if (fallback != nullptr && statusCode > 0 && statusCode < 400)
+                rememberJsonOnly(endpointKey);
+
+            return finish(std::move(fallback), statusCode, options);
+        }
+
+        auto stream = postBase64Json(endpoint, fields, audioField, audio->getFile(), statusOptions, baseHeaders);
+        return finish(std::move(stream), statusCode, options);
+    }
+
+private:
+    // Plays a few in-memory and file streams back to back, so the multipart
+    // body can be sent without assembling it.
+    class ConcatenatedInputStream final : public juce::InputStream
+    {
+    public:
+        void add(std::unique_ptr<juce::InputStream> part)
+        {
+            totalLength += juce::jmax((juce::int64)0, part->getTotalLength());
+            parts.push_back(std::move(part));
+        }
+
+        juce::int64 getTotalLength() override { return totalLength; }
+        juce::int64 getPosition() override { return position; }
+        bool isExhausted() override { return position >= totalLength; }
+
+        int read(void* destBuffer, int maxBytesToRead) override
+        {
+            auto* dest = static_cast<char*>(destBuffer);
+            int bytesRead = 0;
+
+            while (bytesRead < maxBytesToRead && current < parts.size())
+            {
+                const int got = parts[current]->read(dest + bytesRead, maxBytesToRead - bytesRead);
+                if (got <= 0)
+                {
+                    ++current;
+                    continue;
+                }
+
+                bytesRead += got;
+            }
+
+            position += bytesRead;
+            return bytesRead;
+        }
+
+        bool setPosition(juce::int64 newPosition) override
+        {
+            if (newPosition != 0)
+                return newPosition == position;
+
+            for (auto& part : parts)
+                if (!part->setPosition(0))
+                    return false;
+
+            current = 0;
+            position = 0;
+            return true;
+        }
+
+    private:
+        std::vector<std::unique_ptr<juce::InputStream>> parts;
+        size_t current = 0;
+        juce::int64 position = 0;
+        juce::int64 totalLength = 0;
+    };
+
+    static std::unique_ptr<juce::InputStream> postMultipart(const juce::URL& endpoint,
+                                                            juce::DynamicObject& fields,
+                                                            const juce::String& audioField,
+                                                            const juce::File& audioFile,
+                                                            const juce::URL::InputStreamOptions& options)
+    {
+        const auto json = juce::JSON::toString(juce::var(&fields), true);
+
+        if (!LocalConnectionPool::isLocalUrl(endpoint))
+        {
+            // juce::URL builds the multipart body itself.
+            const auto uploadUrl = endpoint.withParameter("request", json)
+                                           .withFileToUpload(audioField, audioFile, "audio/wav");
+
+            return HttpClient::openStream(uploadUrl, juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inPostData)
+                                                         .withConnectionTimeoutMs(options.getConnectionTimeoutMs())
+                                                         .withExtraHeaders(options.getExtraHeaders())
+                                                         .withResponseHeaders(options.getResponseHeaders())
+                                                         .withStatusCode(options.getStatusCode()));
+        }
+
+        auto fileStream = std::make_unique<juce::FileInputStream>(audioFile);
+        if (!fileStream->openedOk())
+            return nullptr;
+
+        const auto boundary = "----gary4juce" + juce::String::toHexString(juce::Random::getSystemRandom().nextInt64());
+
+        juce::String preamble;
+        preamble << "--" << boundary << "\r\n"
+                 << "Content-Disposition: form-data; name=\"request\"\r\n"
+                 << "Content-Type: application/json\r\n\r\n"
+                 << json << "\r\n"
+                 << "--" << boundary << "\r\n"
+                 << "Content-Disposition: form-data; name=\"" << audioField
+                 << "\"; filename=\"" << audioFile.getFileName() << "\"\r\n"
+                 << "Content-Type: audio/wav\r\n\r\n";
+
+        const juce::String epilogue = "\r\n--" + boundary + "--\r\n";
+
+        ConcatenatedInputStream body;
+        body.add(std::make_unique<juce::MemoryInputStream>(preamble.toRawUTF8(), preamble.getNumBytesAsUTF8(), true));
+        body.add(std::move(fileStream));
+        body.add(std::make_unique<juce::MemoryInputStream>(epilogue.toRawUTF8(), epilogue.getNumBytesAsUTF8(), true));
+
+        auto headers = options.getExtraHeaders();
+        if (headers.isNotEmpty() && !headers.endsWith("\r\n"))
+            headers << "\r\n";
+        headers << "Content-Type: multipart/form-data; boundary=" << boundary;
+
+        juce::SharedResourcePointer<LocalConnectionPool> pool;
+        auto response = pool->perform("POST", endpoint, headers, body, options.getConnectionTimeoutMs(),
+                                      HttpClient::cancelCheckFor(HttpClient::getCurrentJobToken()));
+        if (!response.succeeded)
+            return nullptr;
+
+        if (auto* statusCode = options.getStatusCode())
+            *statusCode = response.statusCode;
+
+        if (auto* responseHeaders = options.getResponseHeaders())
+            responseHeaders->addArray(response.headers);
+
+        return std::move(response.body);
+    }
+
+    static std::unique_ptr<juce::InputStream> postBase64Json(const juce::URL& endpoint,
+                                                             juce::DynamicObject& fields,
+                                                             const juce::String& audioField,
+                                                             const juce::File& audioFile,
+                                                             const juce::URL::InputStreamOptions& options,
+                                                             const juce::String& baseHeaders)
+    {
+        juce::MemoryBlock audioData;
+        if (!audioFile.loadFileAsData(audioData))
+            return nullptr;
+
+        fields.setProperty(audioField, Base64Codec::encode(audioData.getData(), audioData.getSize()));
+        audioData.reset();
+
+        const auto json = juce::JSON::toString(juce::var(&fields), true);
+        fields.removeProperty(audioField);
+
+        auto headers = baseHeaders;
+        if (headers.isNotEmpty() && !headers.endsWith("\r\n"))
+            headers << "\r\n";
+        headers << "Content-Type: application/json";
+
+        return HttpClient::openStream(endpoint.withPOSTData(json), options.withExtraHeaders(headers));
+    }
+
+    static std::unique_ptr<juce::InputStream> finish(std::unique_ptr<juce::InputStream> stream,
+                                                     int statusCode,
+                                                     const juce::URL::InputStreamOptions& options)
+    {
+        if (auto* callerStatus = options.getStatusCode())
+            *callerStatus = statusCode;
+
+        return stream;
+    }
+
+    static bool isMultipartRejection(int statusCode)
+    {
+        return statusCode == 404 || statusCode == 405 || statusCode == 415 || statusCode == 422;
+    }
+
+    static juce::String withoutContentType(const juce::String& headers)
+    {
+        juce::StringArray lines;
+        lines.addLines(headers);
+
+        juce::StringArray kept;
+        for (const auto& line : lines)
+            if (line.trim().isNotEmpty() && !line.trimStart().startsWithIgnoreCase("Content-Type:"))
+                kept.add(line.trim());
+
+        return kept.joinIntoString("\r\n");
+    }
+
+    // Endpoints that answered multipart with a rejection and JSON with success.
+    static std::mutex& jsonOnlyLock()
+    {
+        static std::mutex lock;
+        return lock;
+    }
+
+    static std::set<juce::String>& jsonOnlyEndpoints()
+    {
+        static std::set<juce::String> endpoints;
+        return endpoints;
+    }
+
+    static bool acceptsOnlyJson(const juce::String& endpointKey)
+    {
+        const std::lock_guard<std::mutex> lock(jsonOnlyLock());
+        return jsonOnlyEndpoints().count(endpointKey) > 0;
+    }
+
+    static void rememberJsonOnly(const juce::String& endpointKey)
+    {
+        const std::lock_guard<std::mutex> lock(jsonOnlyLock());
+        jsonOnlyEndpoints().insert(endpointKey);
+    }
+};
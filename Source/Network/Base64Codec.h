@@ -0,0 +1,452 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// Base64Codec.h
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+ #include <arm_neon.h>
+ #define GARY4JUCE_BASE64_NEON 1
+#elif defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+ #include <tmmintrin.h>
+ #define GARY4JUCE_BASE64_SSSE3 1
+ // The SSSE3 loops are compiled for SSSE3 on their own, so the exporters
+ // don't need arch flags; they only run once the CPU has been checked.
+ #if defined(__GNUC__) || defined(__clang__)
+  #define GARY4JUCE_BASE64_SSSE3_TARGET __attribute__((target("ssse3")))
+ #else
+  #define GARY4JUCE_BASE64_SSSE3_TARGET
+ #endif
+#endif
+
+// Base64 for the audio transport path.
+//
+// Every request and result that carries audio as base64 goes through here
+// instead of juce::Base64, which works a byte at a time. Bulk runs are handled
+// 12 bytes <-> 16 characters per step with SSSE3 (x86, picked at run time
+// when the CPU has it) or 48 <-> 64 with NEON (AArch64), and a table-driven
+// scalar loop covers other targets, the tail, and anything the vector paths
+// reject (whitespace, the URL-safe alphabet, padding).
+//
+// The decoder is incremental: text can arrive in any chunking (straight off a
+// network stream) and decoded bytes are written to an OutputStream in blocks,
+// so a response never has to sit in memory as one string.
+class Base64Codec
+{
+public:
+    static juce::String encode(const void* data, size_t size)
+    {
+        const auto* in = static_cast<const uint8_t*>(data);
+        const size_t outLength = (size + 2) / 3 * 4;
+        juce::HeapBlock<char> out(outLength + 1);
+
+        size_t consumed = 0;
+        size_t written = encodeVector(in, size, out.get(), consumed);
+
+        const auto* alphabet = getAlphabet();
+        for (; consumed + 3 <= size; consumed += 3, written += 4)
+        {
+            const uint32_t triple = ((uint32_t)in[consumed] << 16) | ((uint32_t)in[consumed + 1] << 8) | in[consumed + 2];
+            out[written] = alphabet[(triple >> 18) & 63];
+            out[written + 1] = alphabet[(triple >> 12) & 63];
+            out[written + 2] = alphabet[(triple >> 6) & 63];
+            out[written + 3] = alphabet[triple & 63];
+        }
+
+        if (const auto remaining = size - consumed; remaining > 0)
+        {
+            const uint32_t triple = ((uint32_t)in[consumed] << 16)
+                                    | (remaining > 1 ? (uint32_t)in[consumed + 1] << 8 : 0u);
+            out[written] = alphabet[(triple >> 18) & 63];
+            out[written + 1] = alphabet[(triple >> 12) & 63];
+            out[written + 2] = remaining > 1 ? alphabet[(triple >> 6) & 63] : '=';
+            out[written + 3] = '=';
+            written += 4;
+        }
+
+        out[written] = 0;
+        return juce::String(juce::CharPointer_ASCII(out.get()));
+    }
+
+    class Decoder
+    {
+    public:
+        // Returns false once the input holds a character outside the alphabet.
+        bool write(const char* text, size_t length, juce::OutputStream& out)
+        {
+            if (failed)
+                return false;
+
+            const auto& table = getDecodeTable();
+            size_t i = 0;
+
+            while (i < length)
+            {
+                // Whole groups straight into the block while the input is clean
+                if (quadLength == 0 && !padded)
+                {
+                    const size_t room = (blockBytes - blockUsed) / 3 * 4;
+                    size_t produced = 0;
+                    const size_t consumed = decodeRun(text + i, juce::jmin(length - i, room),
+                                                      reinterpret_cast<uint8_t*>(block.data()) + blockUsed, produced);
+                    i += consumed;
+                    blockUsed += produced;
+
+                    if (blockUsed + 3 > blockBytes && !flush(out))
+                        return fail();
+
+                    if (consumed > 0)
+                        continue;
+                }
+
+                const auto value = table[(uint8_t)text[i++]];
+
+                if (value < 64)
+                {
+                    if (padded)
+                        return fail();
+
+                    accumulator = (accumulator << 6) | value;
+                    if (++quadLength == 4)
+                    {
+                        block[blockUsed++] = (char)(accumulator >> 16);
+                        block[blockUsed++] = (char)(accumulator >> 8);
+                        block[blockUsed++] = (char)accumulator;
+                        quadLength = 0;
+                        accumulator = 0;
+
+                        if (blockUsed + 3 > blockBytes && !flush(out))
+                            return fail();
+                    }
+                }
+                else if (value == padding)
+                {
+                    padded = true;
+                }
+                else if (value != whitespace)
+                {
+                    return fail();
+                }
+            }
+
+            return true;
+        }
+
+        // Writes any trailing partial group. False if the input was malformed.
+        bool finish(juce::OutputStream& out)
+        {
+            if (failed || quadLength == 1)
+                return fail();
+
+            if (quadLength == 2)
+            {
+                block[blockUsed++] = (char)(accumulator >> 4);
+            }
+            else if (quadLength == 3)
+            {
+                block[blockUsed++] = (char)(accumulator >> 10);
+                block[blockUsed++] = (char)(accumulator >> 2);
+            }
+
+            quadLength = 0;
+            accumulator = 0;
+            return flush(out) || fail();
+        }
+
+        juce::int64 getNumBytesWritten() const noexcept { return bytesWritten; }
+
+    private:
+        bool flush(juce::OutputStream& out)
+        {
+            if (blockUsed == 0)
+                return true;
+
+            const bool ok = out.write(block.data(), blockUsed);
+            bytesWritten += (juce::int64)blockUsed;
+            blockUsed = 0;
+            return ok;
+        }
+
+        bool fail()
+        {
+            failed = true;
+            return false;
+        }
+
+        static constexpr size_t blockBytes = 48 * 1024;
+
+        // The vector decoders store 16 bytes for every 12 they produce.
+        std::array<char, blockBytes + 4> block{};
+        size_t blockUsed = 0;
+        uint32_t accumulator = 0;
+        int quadLength = 0;
+        bool padded = false;
+        bool failed = false;
+        juce::int64 bytesWritten = 0;
+    };
+
+    // Decodes a whole string; false if it isn't valid base64.
+    static bool decode(const juce::String& text, juce::OutputStream& out)
+    {
+        Decoder decoder;
+        return decoder.write(text.toRawUTF8(), text.getNumBytesAsUTF8(), out) && decoder.finish(out);
+    }
+
+private:
+    static constexpr uint8_t padding = 64;
+    static constexpr uint8_t whitespace = 65;
+    static constexpr uint8_t invalid = 255;
+
+    static const char* getAlphabet() noexcept
+    {
+        return "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    }
+
+    static const std::array<uint8_t, 256>& getDecodeTable()
+    {
+        static const auto table = []
+        {
+            std::array<uint8_t, 256> result{};
+            result.fill(invalid);
+
+            const char* alphabet = getAlphabet();
+            for (uint8_t i = 0; i < 64; ++i)
+                result[(uint8_t)alphabet[i]] = i;
+
+            result[(uint8_t)'-'] = 62;
+            result[(uint8_t)'_'] = 63;
+            result[(uint8_t)'='] = padding;
+
+            for (auto c : { ' ', '\t', '\r', '\n' })
+                result[(uint8_t)c] = whitespace;
+
+            return result;
+        }();
+
+        return table;
+    }
+
+    // Decodes whole 4-character groups from the start of text until one holds
+    // anything but alphabet characters. Returns the characters consumed; dest
+    // needs 4 bytes of slack past the decoded output.
+    static size_t decodeRun(const char* text, size_t length, uint8_t* dest, size_t& produced)
+    {
+        size_t consumed = decodeVector(text, length, dest, produced);
+        const auto& table = getDecodeTable();
+
+        while (consumed + 4 <= length)
+        {
+            const uint32_t a = table[(uint8_t)text[consumed]];
+            const uint32_t b = table[(uint8_t)text[consumed + 1]];
+            const uint32_t c = table[(uint8_t)text[consumed + 2]];
+            const uint32_t d = table[(uint8_t)text[consumed + 3]];
+
+            if (((a | b | c | d) & 0xc0) != 0)
+                break;
+
+            const uint32_t triple = (a << 18) | (b << 12) | (c << 6) | d;
+            dest[produced] = (uint8_t)(triple >> 16);
+            dest[produced + 1] = (uint8_t)(triple >> 8);
+            dest[produced + 2] = (uint8_t)triple;
+            produced += 3;
+            consumed += 4;
+        }
+
+        return consumed;
+    }
+
+   #if GARY4JUCE_BASE64_SSSE3
+    static bool hasSsse3() noexcept
+    {
+       #if defined(__SSSE3__) || defined(__AVX__)
+        return true;
+       #else
+        static const bool supported = juce::SystemStats::hasSSSE3();
+        return supported;
+       #endif
+    }
+
+    static size_t encodeVector(const uint8_t* in, size_t size, char* out, size_t& consumed)
+    {
+        if (hasSsse3())
+            return encodeSsse3(in, size, out, consumed);
+
+        consumed = 0;
+        return 0;
+    }
+
+    static size_t decodeVector(const char* text, size_t length, uint8_t* dest, size_t& produced)
+    {
+        if (hasSsse3())
+            return decodeSsse3(text, length, dest, produced);
+
+        produced = 0;
+        return 0;
+    }
+
+    GARY4JUCE_BASE64_SSSE3_TARGET
+    static size_t encodeSsse3(const uint8_t* in, size_t size, char* out, size_t& consumed)
+    {
+        // 16-byte loads use 12 bytes, so stop while a full load still fits.
+        size_t written = 0;
+        consumed = 0;
+
+        const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+        const __m128i shiftLut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                               '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                               '/' - 63, 'A', 0, 0);
+
+        while (consumed + 16 <= size)
+        {
+            __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + consumed));
+            input = _mm_shuffle_epi8(input, shuffle);
+
+            const __m128i t0 = _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00));
+            const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+            const __m128i t2 = _mm_and_si128(input, _mm_set1_epi32(0x003f03f0));
+            const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+            const __m128i indices = _mm_or_si128(t1, t3);
+
+            __m128i offsets = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+            const __m128i lessThan26 = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+            offsets = _mm_or_si128(offsets, _mm_and_si128(lessThan26, _mm_set1_epi8(13)));
+
+            const __m128i characters = _mm_add_epi8(_mm_shuffle_epi8(shiftLut, offsets), indices);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + written), characters);
+
+            consumed += 12;
+            written += 16;
+        }
+
+        return written;
+    }
+
+    GARY4JUCE_BASE64_SSSE3_TARGET
+    static size_t decodeSsse3(const char* text, size_t length, uint8_t* dest, size_t& produced)
+    {
+        size_t consumed = 0;
+        produced = 0;
+
+        const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+        const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                                            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+        while (consumed + 16 <= length)
+        {
+            const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + consumed));
+            const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(input, 4), _mm_set1_epi8(0x0f));
+            const __m128i loNibbles = _mm_and_si128(input, _mm_set1_epi8(0x0f));
+
+            // Any character outside the standard alphabet: leave it to the scalar loop.
+            const __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+            const __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+            if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0)
+                break;
+
+            const __m128i isSlash = _mm_cmpeq_epi8(input, _mm_set1_epi8(0x2f));
+            const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(isSlash, hiNibbles));
+            const __m128i values = _mm_add_epi8(input, roll);
+
+            const __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+            const __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + produced), _mm_shuffle_epi8(packed, pack));
+
+            consumed += 16;
+            produced += 12;
+        }
+
+        return consumed;
+    }
+   #elif GARY4JUCE_BASE64_NEON
+    static size_t encodeVector(const uint8_t* in, size_t size, char* out, size_t& consumed)
+    {
+        size_t written = 0;
+        consumed = 0;
+
+        const uint8x16x4_t alphabet = vld1q_u8_x4(reinterpret_cast<const uint8_t*>(getAlphabet()));
+        const uint8x16_t mask6 = vdupq_n_u8(0x3f);
+
+        while (consumed + 48 <= size)
+        {
+            const uint8x16x3_t bytes = vld3q_u8(in + consumed);
+
+            uint8x16x4_t indices;
+            indices.val[0] = vshrq_n_u8(bytes.val[0], 2);
+            indices.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[0], 4), vshrq_n_u8(bytes.val[1], 4)), mask6);
+            indices.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(bytes.val[1], 2), vshrq_n_u8(bytes.val[2], 6)), mask6);
+            indices.val[3] = vandq_u8(bytes.val[2], mask6);
+
+            uint8x16x4_t characters;
+            for (int i = 0; i < 4; ++i)
+                characters.val[i] = vqtbl4q_u8(alphabet, indices.val[i]);
+
+            vst4q_u8(reinterpret_cast<uint8_t*>(out + written), characters);
+            consumed += 48;
+            written += 64;
+        }
+
+        return written;
+    }
+
+    static size_t decodeVector(const char* text, size_t length, uint8_t* dest, size_t& produced)
+    {
+        size_t consumed = 0;
+        produced = 0;
+
+        // The decode table's first 128 entries as 64-byte lookup halves; bytes
+        // past 127 fall outside both lookups and come back as zero, so they
+        // are caught separately.
+        const auto& table = getDecodeTable();
+        const uint8x16x4_t lowTable = vld1q_u8_x4(table.data());
+        const uint8x16x4_t highTable = vld1q_u8_x4(table.data() + 64);
+        const uint8x16_t offset64 = vdupq_n_u8(64);
+
+        while (consumed + 64 <= length)
+        {
+            const uint8x16x4_t input = vld4q_u8(reinterpret_cast<const uint8_t*>(text + consumed));
+
+            uint8x16x4_t values;
+            uint8x16_t bad = vdupq_n_u8(0);
+            for (int i = 0; i < 4; ++i)
+            {
+                values.val[i] = vqtbx4q_u8(vqtbl4q_u8(lowTable, input.val[i]), highTable, vsubq_u8(input.val[i], offset64));
+                bad = vorrq_u8(bad, vorrq_u8(values.val[i], vandq_u8(input.val[i], vdupq_n_u8(0x80))));
+            }
+
+            // Values are 0..63 for alphabet characters; anything else sets a high bit.
+            if (vmaxvq_u8(vandq_u8(bad, vdupq_n_u8(0xc0))) != 0)
+                break;
+
+            uint8x16x3_t bytes;
+            bytes.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+            bytes.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+            bytes.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+
+            vst3q_u8(dest + produced, bytes);
+            consumed += 64;
+            produced += 48;
+        }
+
+        return consumed;
+    }
+   #else
+    static size_t encodeVector(const uint8_t*, size_t, char*, size_t& consumed)
+    {
+        consumed = 0;
+        return 0;
+    }
+
+    static size_t decodeVector(const char*, size_t, uint8_t*, size_t& produced)
+    {
+        produced = 0;
+        return 0;
+    }
+   #endif
+};
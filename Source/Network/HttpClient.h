@@ -0,0 +1,511 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// HttpClient.h
+#pragma once
+#include <JuceHeader.h>
+#include "LocalConnectionPool.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Shared worker pool for every backend request the plugin makes.
+//
+// Jobs are queued with a priority and the host they talk to. A fixed set of
+// workers always takes the highest-priority job whose host is below its
+// concurrency limit (FIFO within a priority), so a burst of metadata fetches
+// can't hold up a generation request and one slow backend can't tie up every
+// worker. Each job gets a cancellation token: cancelled jobs that haven't
+// started are dropped, running ones see isCancelled() and should bail out at
+// their next check. Streams a job opens through openStream() watch its token
+// too: a cancelled job's connect and reads give up within moments, so even a
+// job that never checks its token is only held up briefly.
+//
+// Jobs that hold a worker for minutes (a submit followed by its own poll
+// loop) go through submitLongRunning() instead. They run on a separate lane
+// of workers, FIFO and outside the per-host limits, since they spend most of
+// their time waiting between polls, so they can never take the pool's
+// workers away from everything else.
+class HttpClient
+{
+public:
+    enum class Priority
+    {
+        Generation = 0,   // Submissions the user is waiting on
+        Polling,          // Progress and result polls
+        Metadata          // Model lists, LoRAs, prompts, health, updates
+    };
+
+    class CancellationToken
+    {
+    public:
+        CancellationToken() : state(std::make_shared<State>()) {}
+
+        void cancel() const
+        {
+            state->flag.store(true, std::memory_order_release);
+
+            const std::lock_guard<std::mutex> lock(state->hookLock);
+            for (auto& hook : state->hooks)
+                hook.second();
+        }
+
+        bool isCancelled() const noexcept { return state->flag.load(std::memory_order_acquire); }
+
+        bool operator==(const CancellationToken& other) const noexcept { return state == other.state; }
+
+    private:
+        friend class HttpClient;
+
+        struct State
+        {
+            std::atomic<bool> flag{ false };
+            std::mutex hookLock;
+            std::map<int, std::function<void()>> hooks;
+            int nextHookId = 0;
+        };
+
+        // Hooks run on the cancelling thread, under hookLock, so a removed
+        // hook is never running or about to run.
+        int addCancelHook(std::function<void()> hook) const
+        {
+            const std::lock_guard<std::mutex> lock(state->hookLock);
+            const int id = state->nextHookId++;
+            state->hooks[id] = std::move(hook);
+            return id;
+        }
+
+        void removeCancelHook(int id) const
+        {
+            const std::lock_guard<std::mutex> lock(state->hookLock);
+            state->hooks.erase(id);
+        }
+
+        std::shared_ptr<State> state;
+    };
+
+    using JobFunction = std::function<void(const CancellationToken&)>;
+
+    static constexpr int defaultNumWorkers = 8;
+    static constexpr int defaultMaxRequestsPerHost = 4;
+    static constexpr int defaultNumLongRunningWorkers = 2;
+
+    explicit HttpClient(int numWorkers = defaultNumWorkers,
+                        int maxRequestsPerHostToUse = defaultMaxRequestsPerHost,
+                        int numLongRunningWorkers = defaultNumLongRunningWorkers)
+        : pool(std::make_shared<Pool>(juce::jmax(1, maxRequestsPerHostToUse)))
+    {
+        for (int i = 0; i < juce::jmax(1, numWorkers); ++i)
+            startWorker("gary4juce http " + juce::String(i), false);
+
+        for (int i = 0; i < numLongRunningWorkers; ++i)
+            startWorker("gary4juce http long " + juce::String(i), true);
+    }
+
+    ~HttpClient()
+    {
+        {
+            const std::lock_guard<std::mutex> lock(pool->mutex);
+            pool->stopping = true;
+            pool->cancelEverything();
+        }
+
+        pool->jobAvailable.notify_all();
+
+        // Cancelling makes the jobs' streams and waits give up, so joining
+        // only waits for each job to unwind. Every worker is joined: a job
+        // may reference its owner (a MetadataCache landing, the editor) or
+        // code in the plugin binary, neither of which outlives this client.
+        for (auto& worker : workers)
+            worker.join();
+    }
+
+    CancellationToken submit(Priority priority, const juce::URL& url, JobFunction function)
+    {
+        return enqueue(priority, url, std::move(function), false);
+    }
+
+    CancellationToken submit(Priority priority, const juce::String& url, JobFunction function)
+    {
+        return submit(priority, juce::URL(url), std::move(function));
+    }
+
+    // For jobs that keep their worker for the whole of a long generation.
+    CancellationToken submitLongRunning(const juce::URL& url, JobFunction function)
+    {
+        return enqueue(Priority::Generation, url, std::move(function), true);
+    }
+
+    CancellationToken submitLongRunning(const juce::String& url, JobFunction function)
+    {
+        return submitLongRunning(juce::URL(url), std::move(function));
+    }
+
+    // Cancels everything queued or running, e.g. when the editor goes away.
+    // Dropped jobs never run, so only use this once nothing waits on them.
+    void cancelAll()
+    {
+        const std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->cancelEverything();
+    }
+
+    int getNumInFlight() const
+    {
+        const std::lock_guard<std::mutex> lock(pool->mutex);
+        return (int)pool->runningTokens.size();
+    }
+
+    int getNumQueued() const
+    {
+        const std::lock_guard<std::mutex> lock(pool->mutex);
+        return (int)pool->queue.size();
+    }
+
+    // Concurrency is limited per scheme, host and port, so each local
+    // service gets its own budget.
+    static juce::String getHostKey(const juce::URL& url)
+    {
+        const auto text = url.toString(false);
+        const auto scheme = text.upToFirstOccurrenceOf("://", false, false).toLowerCase();
+        return scheme + "://" + url.getDomain().toLowerCase() + ":" + juce::String(url.getPort());
+    }
+
+    // The token of the job running on the calling thread. Off the pool it is
+    // a token nothing cancels.
+    static CancellationToken getCurrentJobToken()
+    {
+        if (const auto* token = currentJobToken())
+            return *token;
+
+        return {};
+    }
+
+    // Drop-in for url.createInputStream(options), cancelled along with the
+    // job it is opened from.
+    static std::unique_ptr<juce::InputStream> openStream(const juce::URL& url,
+                                                         const juce::URL::InputStreamOptions& options)
+    {
+        return openStream(url, options, getCurrentJobToken());
+    }
+
+    // Plain-http localhost requests reuse a pooled keep-alive connection and
+    // stream the body off it; the status code and headers are only reported
+    // through options, as the stream is not a WebInputStream. Anything else,
+    // or anything the pool can't express (form-encoded or multipart bodies,
+    // upload progress), goes through a WebInputStream set up the way
+    // juce::URL would. Either way, cancelling the token fails the connect or
+    // the read in progress and every read after it.
+    static std::unique_ptr<juce::InputStream> openStream(const juce::URL& url,
+                                                         const juce::URL::InputStreamOptions& options,
+                                                         const CancellationToken& cancellation)
+    {
+        if (cancellation.isCancelled())
+            return nullptr;
+
+        const bool formEncoded = options.getParameterHandling() == juce::URL::ParameterHandling::inPostData;
+
+        if (!LocalConnectionPool::isLocalUrl(url) || formEncoded || options.getProgressCallback() != nullptr)
+            return openWebStream(url, options, cancellation);
+
+        auto requestBody = url.getPostDataAsMemoryBlock();
+        auto method = options.getHttpRequestCmd();
+        if (method.isEmpty())
+            method = requestBody.getSize() > 0 ? "POST" : "GET";
+
+        juce::SharedResourcePointer<LocalConnectionPool> localPool;
+        auto response = localPool->perform(method, url, options.getExtraHeaders(), requestBody,
+                                           options.getConnectionTimeoutMs(), cancelCheckFor(cancellation));
+
+        if (!response.succeeded)
+            return nullptr;
+
+        if (auto* statusCode = options.getStatusCode())
+            *statusCode = response.statusCode;
+
+        if (auto* responseHeaders = options.getResponseHeaders())
+            responseHeaders->addArray(response.headers);
+
+        return std::move(response.body);
+    }
+
+    // For handing a token to LocalConnectionPool::perform directly.
+    static LocalConnectionPool::CancelCheck cancelCheckFor(const CancellationToken& cancellation)
+    {
+        return [cancellation] { return cancellation.isCancelled(); };
+    }
+
+private:
+    // A WebInputStream that a cancelled token interrupts, whether it is
+    // connecting or blocked in a read.
+    class CancellableWebStream final : public juce::InputStream
+    {
+    public:
+        CancellableWebStream(const juce::URL& url, bool usePost, const CancellationToken& cancellationToUse)
+            : stream(url, usePost),
+              cancellation(cancellationToUse),
+              hookId(cancellation.addCancelHook([this] { stream.cancel(); }))
+        {
+            // Cancelled before the hook went in
+            if (cancellation.isCancelled())
+                stream.cancel();
+        }
+
+        ~CancellableWebStream() override
+        {
+            cancellation.removeCancelHook(hookId);
+        }
+
+        juce::WebInputStream& getStream() noexcept { return stream; }
+
+        juce::int64 getTotalLength() override { return stream.getTotalLength(); }
+        bool isExhausted() override { return cancellation.isCancelled() || stream.isExhausted(); }
+        juce::int64 getPosition() override { return stream.getPosition(); }
+        bool setPosition(juce::int64 newPosition) override { return stream.setPosition(newPosition); }
+
+        int read(void* destBuffer, int maxBytesToRead) override
+        {
+            if (cancellation.isCancelled())
+                return 0;
+
+            return stream.read(destBuffer, maxBytesToRead);
+        }
+
+    private:
+        juce::WebInputStream stream;
+        const CancellationToken cancellation;
+        const int hookId;
+    };
+
+    // Mirrors URL::createInputStream, with the stream registered on the token
+    // before it connects.
+    static std::unique_ptr<juce::InputStream> openWebStream(const juce::URL& url,
+                                                            const juce::URL::InputStreamOptions& options,
+                                                            const CancellationToken& cancellation)
+    {
+        if (url.isLocalFile())
+            return url.createInputStream(options);
+
+        const bool usePost = options.getParameterHandling() == juce::URL::ParameterHandling::inPostData;
+        auto result = std::make_unique<CancellableWebStream>(url, usePost, cancellation);
+        auto& stream = result->getStream();
+
+        if (options.getExtraHeaders().isNotEmpty())
+            stream.withExtraHeaders(options.getExtraHeaders());
+        if (options.getConnectionTimeoutMs() != 0)
+            stream.withConnectionTimeout(options.getConnectionTimeoutMs());
+        if (options.getHttpRequestCmd().isNotEmpty())
+            stream.withCustomRequestCommand(options.getHttpRequestCmd());
+        stream.withNumRedirectsToFollow(options.getNumRedirectsToFollow());
+
+        struct ProgressListener final : public juce::WebInputStream::Listener
+        {
+            explicit ProgressListener(std::function<bool(int, int)> callbackToUse) : callback(std::move(callbackToUse)) {}
+
+            bool postDataSendProgress(juce::WebInputStream&, int bytesSent, int totalBytes) override
+            {
+                return callback(bytesSent, totalBytes);
+            }
+
+            std::function<bool(int, int)> callback;
+        };
+
+        std::unique_ptr<ProgressListener> listener;
+        if (auto progressCallback = options.getProgressCallback())
+            listener = std::make_unique<ProgressListener>(std::move(progressCallback));
+
+        const bool connected = stream.connect(listener.get());
+
+        if (auto* statusCode = options.getStatusCode())
+            *statusCode = stream.getStatusCode();
+
+        if (auto* responseHeaders = options.getResponseHeaders())
+            *responseHeaders = stream.getResponseHeaders();
+
+        if (!connected || stream.isError() || cancellation.isCancelled())
+            return nullptr;
+
+        return result;
+    }
+
+    struct QueuedJob
+    {
+        Priority priority = Priority::Metadata;
+        juce::uint64 sequence = 0;
+        juce::String host;
+        bool longRunning = false;
+        CancellationToken token;
+        JobFunction function;
+    };
+
+    // Everything the workers touch, shared by the client and each worker.
+    struct Pool
+    {
+        explicit Pool(int maxRequestsPerHostToUse) : maxRequestsPerHost(maxRequestsPerHostToUse) {}
+
+        // Caller holds mutex.
+        void cancelEverything()
+        {
+            for (auto& job : queue)
+                job.token.cancel();
+            queue.clear();
+
+            for (auto& token : runningTokens)
+                token.cancel();
+        }
+
+        // Index of the best job in the given lane that may start now, or -1.
+        // Drops cancelled jobs.
+        int findRunnableJob(bool longRunning)
+        {
+            int best = -1;
+
+            for (int i = 0; i < (int)queue.size();)
+            {
+                auto& job = queue[(size_t)i];
+                if (job.token.isCancelled())
+                {
+                    queue.erase(queue.begin() + i);
+                    continue;
+                }
+
+                if (job.longRunning != longRunning)
+                {
+                    ++i;
+                    continue;
+                }
+
+                const auto active = activePerHost.find(job.host);
+                const bool hostHasRoom = longRunning || active == activePerHost.end() || active->second < maxRequestsPerHost;
+
+                if (hostHasRoom && (best < 0
+                    || job.priority < queue[(size_t)best].priority
+                    || (job.priority == queue[(size_t)best].priority && job.sequence < queue[(size_t)best].sequence)))
+                    best = i;
+
+                ++i;
+            }
+
+            return best;
+        }
+
+        bool waitForJob(QueuedJob& job, bool longRunning)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            int index = -1;
+
+            jobAvailable.wait(lock, [this, &index, longRunning]
+            {
+                if (stopping)
+                    return true;
+
+                index = findRunnableJob(longRunning);
+                return index >= 0;
+            });
+
+            if (stopping)
+                return false;
+
+            job = std::move(queue[(size_t)index]);
+            queue.erase(queue.begin() + index);
+            if (!job.longRunning)
+                ++activePerHost[job.host];
+            runningTokens.push_back(job.token);
+            return true;
+        }
+
+        void finishJob(const QueuedJob& job)
+        {
+            {
+                const std::lock_guard<std::mutex> lock(mutex);
+
+                auto active = job.longRunning ? activePerHost.end() : activePerHost.find(job.host);
+                if (active != activePerHost.end() && --active->second <= 0)
+                    activePerHost.erase(active);
+
+                runningTokens.erase(std::find(runningTokens.begin(), runningTokens.end(), job.token));
+            }
+
+            // A host slot opened up; any waiting worker may now have a job.
+            jobAvailable.notify_all();
+        }
+
+        const int maxRequestsPerHost;
+
+        std::mutex mutex;
+        std::condition_variable jobAvailable;
+        std::vector<QueuedJob> queue;
+        std::map<juce::String, int> activePerHost;
+        std::vector<CancellationToken> runningTokens;
+        juce::uint64 nextSequence = 0;
+        bool stopping = false;
+    };
+
+    CancellationToken enqueue(Priority priority, const juce::URL& url, JobFunction function, bool longRunning)
+    {
+        QueuedJob job;
+        job.priority = priority;
+        job.host = getHostKey(url);
+        job.longRunning = longRunning;
+        job.function = std::move(function);
+        const auto token = job.token;
+
+        {
+            const std::lock_guard<std::mutex> lock(pool->mutex);
+            if (pool->stopping)
+            {
+                token.cancel();
+                return token;
+            }
+
+            job.sequence = pool->nextSequence++;
+            pool->queue.push_back(std::move(job));
+        }
+
+        // Workers only take jobs from their own lane, so wake them all
+        pool->jobAvailable.notify_all();
+        return token;
+    }
+
+    static const CancellationToken*& currentJobToken() noexcept
+    {
+        thread_local const CancellationToken* token = nullptr;
+        return token;
+    }
+
+    void startWorker(const juce::String& name, bool longRunning)
+    {
+        workers.emplace_back([sharedPool = pool, name, longRunning]
+        {
+            juce::Thread::setCurrentThreadName(name);
+            QueuedJob job;
+
+            while (sharedPool->waitForJob(job, longRunning))
+            {
+                if (!job.token.isCancelled())
+                {
+                    currentJobToken() = &job.token;
+                    job.function(job.token);
+                    currentJobToken() = nullptr;
+                }
+
+                sharedPool->finishJob(job);
+                job = {};
+            }
+        });
+    }
+
+    std::shared_ptr<Pool> pool;
+    std::vector<std::thread> workers;
+
+    // Keeps the shared connection pool (and its idle sockets) alive between
+    // requests for as long as a client exists.
+    juce::SharedResourcePointer<LocalConnectionPool> localConnections;
+
+    JUCE_DECLARE_NON_COPYABLE(HttpClient)
+};
@@ -0,0 +1,300 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// JsonAudioStream.h
+#pragma once
+#include <JuceHeader.h>
+#include "Base64Codec.h"
+#include <memory>
+
+// Reads a JSON response whose audio arrives as a base64 string property.
+//
+// The stream is scanned a block at a time. When the value of one of the audio
+// keys starts, its characters are fed through the incremental base64 decoder
+// into a temporary file instead of being kept; everything else is copied into
+// the returned JSON text with that value left as "". Peak memory is one read
+// block plus the (small) rest of the response, and the caller gets a file it
+// can install rather than a multi-megabyte string. A Scanner does the same for
+// JSON that arrives in pieces rather than as one stream.
+class JsonAudioStream
+{
+public:
+    // Decoded audio on disk; deleted when the last holder lets go.
+    using DecodedFile = std::shared_ptr<const juce::TemporaryFile>;
+
+    struct Result
+    {
+        bool complete = false;      // Read to the end with balanced braces
+        juce::String json;          // The response with the audio value emptied
+        DecodedFile audio;          // nullptr if no audio key held valid data
+    };
+
+    static Result read(juce::InputStream& input, const juce::StringArray& audioKeys)
+    {
+        Scanner scanner(audioKeys);
+        char chunk[readBlockBytes];
+
+        for (;;)
+        {
+            const int bytesRead = input.read(chunk, (int)sizeof(chunk));
+            if (bytesRead <= 0)
+                break;
+
+            scanner.write(chunk, (size_t)bytesRead);
+        }
+
+        return scanner.finish();
+    }
+
+    // For payloads that already arrived as a string.
+    static DecodedFile decodeToFile(const juce::String& base64)
+    {
+        auto file = std::make_shared<juce::TemporaryFile>(".wav");
+        juce::FileOutputStream out(file->getFile());
+        if (!out.openedOk())
+            return nullptr;
+
+        Base64Codec::Decoder decoder;
+        const auto* text = base64.toRawUTF8();
+        if (!decoder.write(text, base64.getNumBytesAsUTF8(), out) || !decoder.finish(out))
+            return nullptr;
+
+        out.flush();
+        if (out.getStatus().failed() || decoder.getNumBytesWritten() == 0)
+            return nullptr;
+
+        return file;
+    }
+
+    // Takes the response a piece at a time, in pieces of any size; finish()
+    // once the last one is in.
+    class Scanner
+    {
+    public:
+        explicit Scanner(const juce::StringArray& keysToDecode) : keys(keysToDecode) {}
+
+        void write(const char* data, size_t length)
+        {
+            size_t runStart = 0;
+
+            for (size_t i = 0; i < length; ++i)
+            {
+                const char c = data[i];
+
+                if (inAudio)
+                {
+                    // Plain base64 runs go to the decoder in one call.
+                    if (audioEscape == 0 && c != '\\' && c != '"')
+                    {
+                        size_t end = i + 1;
+                        while (end < length && data[end] != '\\' && data[end] != '"')
+                            ++end;
+
+                        writeAudio(data + i, end - i);
+                        i = end - 1;
+                        continue;
+                    }
+
+                    if (!consumeAudioChar(c))
+                        continue;
+
+                    // Closing quote: the value is done.
+                    runStart = i;
+                    inAudio = false;
+                    lastSignificant = '"';
+                    finishAudio();
+                    continue;
+                }
+
+                if (inString)
+                {
+                    if (escaped)
+                        escaped = false;
+                    else if (c == '\\')
+                        escaped = true;
+                    else if (c == '"')
+                    {
+                        inString = false;
+                        lastSignificant = '"';
+                    }
+                    else if (currentString.getDataSize() < (size_t)maxKeyLength + 1)
+                        currentString.write(&c, 1);
+
+                    continue;
+                }
+
+                switch (c)
+                {
+                    case '"':
+                        if (lastSignificant == ':' && isAudioKey(lastKey))
+                        {
+                            // Keep the opening quote, skip the value.
+                            json.write(data + runStart, i + 1 - runStart);
+                            runStart = i + 1;
+                            startAudio();
+                        }
+                        else
+                        {
+                            inString = true;
+                            currentString.reset();
+                        }
+                        break;
+
+                    case ':':
+                        lastKey = currentString.toString();
+                        break;
+
+                    case '{': case '[': ++depth; sawStructure = true; break;
+                    case '}': case ']': --depth; break;
+                    default: break;
+                }
+
+                if (!juce::CharacterFunctions::isWhitespace((juce::juce_wchar)(unsigned char)c))
+                    lastSignificant = c;
+            }
+
+            if (!inAudio && runStart < length)
+                json.write(data + runStart, length - runStart);
+        }
+
+        Result finish()
+        {
+            Result result;
+
+            if (inAudio)
+            {
+                // Truncated in the middle of the audio value.
+                audioFailed = true;
+                finishAudio();
+            }
+
+            result.complete = sawStructure && depth == 0 && !inString;
+            result.json = json.toString();
+            result.audio = std::move(decodedAudio);
+            return result;
+        }
+
+    private:
+        bool isAudioKey(const juce::String& key) const
+        {
+            return keys.contains(key);
+        }
+
+        void startAudio()
+        {
+            inAudio = true;
+            audioEscape = 0;
+            audioFailed = decodedAudio != nullptr; // Only the first audio value is kept
+            decoder = std::make_unique<Base64Codec::Decoder>();
+
+            if (!audioFailed)
+            {
+                pendingAudio = std::make_shared<juce::TemporaryFile>(".wav");
+                audioOut = std::make_unique<juce::FileOutputStream>(pendingAudio->getFile());
+                audioFailed = !audioOut->openedOk();
+            }
+        }
+
+        // Returns true on the closing quote.
+        bool consumeAudioChar(char c)
+        {
+            char decoded = c;
+
+            if (audioEscape > 0)
+            {
+                // \uXXXX: only ASCII code points can be part of base64.
+                if (audioEscape == 1)
+                {
+                    if (c == 'u')
+                    {
+                        audioEscape = 2;
+                        unicodeValue = 0;
+                        unicodeDigits = 0;
+                        return false;
+                    }
+
+                    audioEscape = 0;
+                    if (c == 'n' || c == 'r' || c == 't')
+                        return false;
+                }
+                else
+                {
+                    unicodeValue = unicodeValue * 16 + juce::CharacterFunctions::getHexDigitValue((juce::juce_wchar)(unsigned char)c);
+                    if (++unicodeDigits < 4)
+                        return false;
+
+                    audioEscape = 0;
+                    if (unicodeValue < 0 || unicodeValue > 127)
+                    {
+                        audioFailed = true;
+                        return false;
+                    }
+
+                    decoded = (char)unicodeValue;
+                }
+            }
+            else if (c == '\\')
+            {
+                audioEscape = 1;
+                return false;
+            }
+            else if (c == '"')
+            {
+                return true;
+            }
+
+            writeAudio(&decoded, 1);
+            return false;
+        }
+
+        void writeAudio(const char* text, size_t length)
+        {
+            if (!audioFailed && !decoder->write(text, length, *audioOut))
+                audioFailed = true;
+        }
+
+        void finishAudio()
+        {
+            if (!audioFailed && audioOut != nullptr)
+            {
+                audioFailed = !decoder->finish(*audioOut);
+                audioOut->flush();
+                audioFailed = audioFailed || audioOut->getStatus().failed() || decoder->getNumBytesWritten() == 0;
+            }
+
+            audioOut.reset();
+            decoder.reset();
+
+            if (!audioFailed && pendingAudio != nullptr)
+                decodedAudio = std::move(pendingAudio);
+
+            pendingAudio.reset();
+        }
+
+        static constexpr int maxKeyLength = 64;
+
+        const juce::StringArray keys;
+        juce::MemoryOutputStream json;
+
+        juce::MemoryOutputStream currentString;
+        juce::String lastKey;
+        char lastSignificant = 0;
+        bool inString = false;
+        bool escaped = false;
+        bool sawStructure = false;
+        int depth = 0;
+
+        bool inAudio = false;
+        bool audioFailed = false;
+        int audioEscape = 0;
+        int unicodeValue = 0;
+        int unicodeDigits = 0;
+        std::unique_ptr<Base64Codec::Decoder> decoder;
+        std::unique_ptr<juce::FileOutputStream> audioOut;
+        std::shared_ptr<juce::TemporaryFile> pendingAudio;
+        DecodedFile decodedAudio;
+    };
+
+private:
+    static constexpr int readBlockBytes = 64 * 1024;
+};
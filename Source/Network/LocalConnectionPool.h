@@ -0,0 +1,648 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// LocalConnectionPool.h
+#pragma once
+#include <JuceHeader.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// Keep-alive HTTP/1.1 connections to the gary4local services.
+//
+// juce::URL opens a new TCP connection for every request, which adds up when
+// six health probes and a poll hit localhost every few seconds. This pool
+// keeps finished connections per port and hands them to the next request.
+// Idle connections are dropped before the backend's own keep-alive timeout
+// (uvicorn closes after 5 s), and a connection the server already closed is
+// detected before reuse. Only plain-http localhost URLs are handled here;
+// everything else goes through juce::URL. Shared by every plugin instance in
+// the process through juce::SharedResourcePointer.
+//
+// A response body is not buffered: it is read off the socket as the caller
+// consumes it, whether framed by Content-Length, chunked, or running to the
+// end of the connection. The connection goes back to the pool when a framed
+// body has been read to its end and the stream is deleted; a body abandoned
+// part way closes it.
+//
+// timeoutMs means what juce::URL's connection timeout does, applied to
+// connecting and to each wait on the socket rather than to the whole
+// response: > 0 is the limit, 0 connects with a default limit and otherwise
+// waits as long as the system would, and -1 waits forever.
+//
+// A request can also be given a cancel check. Socket waits are then taken in
+// short slices, and once the check returns true the request, or the body
+// being read, fails at the next slice instead of running to its timeout.
+class LocalConnectionPool
+{
+public:
+    // Polled while waiting on the socket; true abandons the request.
+    using CancelCheck = std::function<bool()>;
+
+private:
+    struct Connection
+    {
+        juce::StreamingSocket socket;
+        int port = 0;
+        double lastUsedMs = 0.0;
+    };
+
+    // Kept apart from the pool so a body stream can hand its connection back
+    // even if it outlives the pool's last owner.
+    struct IdleConnections
+    {
+        void evict()
+        {
+            const juce::ScopedLock lock(mutex);
+            const auto now = juce::Time::getMillisecondCounterHiRes();
+
+            connections.erase(std::remove_if(connections.begin(), connections.end(), [now](const std::unique_ptr<Connection>& connection)
+            {
+                return now - connection->lastUsedMs > idleTimeoutMs;
+            }), connections.end());
+        }
+
+        void release(std::unique_ptr<Connection> connection)
+        {
+            connection->lastUsedMs = juce::Time::getMillisecondCounterHiRes();
+            evict();
+
+            const juce::ScopedLock lock(mutex);
+            const auto samePort = std::count_if(connections.begin(), connections.end(), [&connection](const std::unique_ptr<Connection>& other)
+            {
+                return other->port == connection->port;
+            });
+
+            if (samePort < maxIdlePerPort)
+                connections.push_back(std::move(connection));
+        }
+
+        std::unique_ptr<Connection> take(int port)
+        {
+            const juce::ScopedLock lock(mutex);
+            const auto now = juce::Time::getMillisecondCounterHiRes();
+
+            for (;;)
+            {
+                // Most recently used first: it is the least likely to have
+                // been closed by the server.
+                auto it = std::find_if(connections.rbegin(), connections.rend(), [port](const std::unique_ptr<Connection>& connection)
+                {
+                    return connection->port == port;
+                });
+
+                if (it == connections.rend())
+                    return nullptr;
+
+                auto connection = std::move(*it);
+                connections.erase(std::next(it).base());
+
+                // An idle socket that reads as ready has a pending EOF or reset.
+                if (now - connection->lastUsedMs <= idleTimeoutMs
+                    && connection->socket.isConnected()
+                    && connection->socket.waitUntilReady(true, 0) == 0)
+                    return connection;
+            }
+        }
+
+        int size() const
+        {
+            const juce::ScopedLock lock(mutex);
+            return (int)connections.size();
+        }
+
+        juce::CriticalSection mutex;
+        std::vector<std::unique_ptr<Connection>> connections;
+    };
+
+public:
+    // Response body, read off the connection as it is consumed.
+    class BodyStream final : public juce::InputStream
+    {
+    public:
+        enum class Framing
+        {
+            empty,          // No body (HEAD, 204, 304)
+            length,         // Content-Length
+            chunked,        // Transfer-Encoding: chunked
+            untilClose      // No framing: runs to EOF, connection not reusable
+        };
+
+        BodyStream(std::unique_ptr<Connection> connectionToUse,
+                   std::shared_ptr<IdleConnections> idleToUse,
+                   juce::MemoryBlock alreadyReceived,
+                   Framing framingToUse,
+                   juce::int64 contentLength,
+                   bool keepAliveToUse,
+                   int timeoutMs,
+                   CancelCheck isCancelledToUse)
+            : connection(std::move(connectionToUse)),
+              idle(std::move(idleToUse)),
+              pending(std::move(alreadyReceived)),
+              framing(framingToUse),
+              totalLength(framingToUse == Framing::length ? contentLength : (framingToUse == Framing::empty ? 0 : -1)),
+              remaining(framingToUse == Framing::length ? contentLength : 0),
+              keepAlive(keepAliveToUse && framingToUse != Framing::untilClose),
+              waitTimeoutMs(waitTimeoutFor(timeoutMs)),
+              isCancelled(std::move(isCancelledToUse))
+        {
+            if (framing == Framing::empty || (framing == Framing::length && remaining <= 0))
+                finished = true;
+        }
+
+        ~BodyStream() override
+        {
+            // Bytes past the body would be the start of a response nobody asked for
+            if (finished && !failed && keepAlive && pendingOffset == pending.getSize())
+                idle->release(std::move(connection));
+        }
+
+        juce::int64 getTotalLength() override { return totalLength; }
+        bool isExhausted() override { return finished || failed; }
+        juce::int64 getPosition() override { return position; }
+
+        // Forward only: skipping reads and discards.
+        bool setPosition(juce::int64 newPosition) override
+        {
+            if (newPosition < position)
+                return false;
+
+            skipNextBytes(newPosition - position);
+            return position == newPosition;
+        }
+
+        // Blocks until maxBytesToRead have arrived or the body ends.
+        int read(void* destBuffer, int maxBytesToRead) override
+        {
+            auto* dest = static_cast<char*>(destBuffer);
+            int total = 0;
+
+            while (total < maxBytesToRead && !finished && !failed)
+            {
+                if (framing == Framing::chunked && remaining == 0 && !startChunk())
+                    break;
+
+                int wanted = maxBytesToRead - total;
+                if (framing != Framing::untilClose)
+                    wanted = (int)juce::jmin((juce::int64)wanted, remaining);
+
+                const int got = receive(dest + total, wanted);
+                if (got <= 0)
+                {
+                    // EOF ends an unframed body; anywhere else it is a truncated one
+                    if (got == 0 && framing == Framing::untilClose)
+                        finished = true;
+                    else
+                        failed = true;
+                    break;
+                }
+
+                total += got;
+                position += got;
+
+                if (framing != Framing::untilClose && (remaining -= got) == 0 && framing == Framing::length)
+                    finished = true;
+            }
+
+            return total;
+        }
+
+    private:
+        // Reads the next chunk's size line, finishing the body at the last one.
+        bool startChunk()
+        {
+            juce::String line;
+
+            // The CRLF that closes the previous chunk's data
+            if (inChunk && (!readLine(line) || line.isNotEmpty()))
+                return fail();
+
+            if (!readLine(line))
+                return fail();
+
+            remaining = line.upToFirstOccurrenceOf(";", false, false).trim().getHexValue64();
+            inChunk = true;
+
+            if (remaining < 0)
+                return fail();
+
+            if (remaining == 0)
+            {
+                // Skip trailers up to the final blank line
+                do
+                {
+                    if (!readLine(line))
+                        return fail();
+                } while (line.isNotEmpty());
+
+                finished = true;
+                return false;
+            }
+
+            return true;
+        }
+
+        bool readLine(juce::String& line)
+        {
+            for (;;)
+            {
+                const auto* data = static_cast<const char*>(pending.getData());
+                for (size_t i = pendingOffset + 1; i < pending.getSize(); ++i)
+                {
+                    if (data[i - 1] == '\r' && data[i] == '\n')
+                    {
+                        line = juce::String::fromUTF8(data + pendingOffset, (int)(i - 1 - pendingOffset));
+                        pendingOffset = i + 1;
+                        return true;
+                    }
+                }
+
+                if (pending.getSize() - pendingOffset > maxLineBytes)
+                    return false;
+
+                char chunk[4096];
+                const int got = receiveFromSocket(chunk, (int)sizeof(chunk));
+                if (got <= 0)
+                    return false;
+
+                compactPending();
+                pending.append(chunk, (size_t)got);
+            }
+        }
+
+        // Bytes already received go first, then the socket.
+        int receive(char* dest, int wanted)
+        {
+            if (pendingOffset < pending.getSize())
+            {
+                const int count = (int)juce::jmin((size_t)wanted, pending.getSize() - pendingOffset);
+                std::memcpy(dest, static_cast<const char*>(pending.getData()) + pendingOffset, (size_t)count);
+                pendingOffset += (size_t)count;
+                return count;
+            }
+
+            return receiveFromSocket(dest, wanted);
+        }
+
+        // > 0 bytes read, 0 on EOF, -1 on error or timeout.
+        int receiveFromSocket(char* dest, int wanted)
+        {
+            if (waitForSocket(connection->socket, true, waitTimeoutMs, isCancelled) != 1)
+                return -1;
+
+            return connection->socket.read(dest, wanted, false);
+        }
+
+        void compactPending()
+        {
+            if (pendingOffset > 0)
+            {
+                pending.removeSection(0, pendingOffset);
+                pendingOffset = 0;
+            }
+        }
+
+        bool fail()
+        {
+            failed = true;
+            return false;
+        }
+
+        static constexpr size_t maxLineBytes = 64 * 1024;
+
+        std::unique_ptr<Connection> connection;
+        std::shared_ptr<IdleConnections> idle;
+        juce::MemoryBlock pending;
+        size_t pendingOffset = 0;
+
+        const Framing framing;
+        const juce::int64 totalLength;
+        juce::int64 remaining = 0;      // Of the body (length) or the current chunk (chunked)
+        juce::int64 position = 0;
+        const bool keepAlive;
+        const int waitTimeoutMs;
+        const CancelCheck isCancelled;
+        bool inChunk = false;
+        bool finished = false;
+        bool failed = false;
+
+        JUCE_DECLARE_NON_COPYABLE(BodyStream)
+    };
+
+    struct Response
+    {
+        bool succeeded = false;
+        int statusCode = 0;
+        juce::StringPairArray headers;
+        std::unique_ptr<juce::InputStream> body;    // A BodyStream when succeeded
+    };
+
+    LocalConnectionPool() = default;
+
+    static bool isLocalUrl(const juce::URL& url)
+    {
+        if (!url.toString(false).startsWithIgnoreCase("http://") || url.getPort() <= 0)
+            return false;
+
+        const auto host = url.getDomain();
+        return host.equalsIgnoreCase("localhost") || host == "127.0.0.1";
+    }
+
+    Response perform(const juce::String& method,
+                     const juce::URL& url,
+                     const juce::String& extraHeaders,
+                     const juce::MemoryBlock& requestBody,
+                     int timeoutMs,
+                     const CancelCheck& isCancelled = nullptr)
+    {
+        juce::MemoryInputStream body(requestBody, false);
+        return perform(method, url, extraHeaders, body, timeoutMs, isCancelled);
+    }
+
+    // Sends requestBody from its current position to the end, a block at a
+    // time, so large uploads never sit in memory in one piece. Returns once
+    // the response head has arrived.
+    Response perform(const juce::String& method,
+                     const juce::URL& url,
+                     const juce::String& extraHeaders,
+                     juce::InputStream& requestBody,
+                     int timeoutMs,
+                     const CancelCheck& isCancelled = nullptr)
+    {
+        const int port = url.getPort();
+        const bool idempotent = method == "GET" || method == "HEAD";
+        const auto bodyStart = requestBody.getPosition();
+        const auto bodyLength = juce::jmax((juce::int64)0, requestBody.getTotalLength() - bodyStart);
+        const auto head = buildRequestHead(method, url, extraHeaders, bodyLength);
+
+        for (int attempt = 0; attempt < 2; ++attempt)
+        {
+            bool reused = false;
+            auto connection = acquire(port, timeoutMs, reused);
+            if (connection == nullptr)
+                return {};
+
+            Response response;
+            bool receivedAnything = false;
+
+            if (attempt > 0 && !requestBody.setPosition(bodyStart))
+                return {};
+
+            if (send(*connection, head.getData(), head.getSize(), timeoutMs, isCancelled)
+                && sendBody(*connection, requestBody, timeoutMs, isCancelled)
+                && readResponse(connection, method, timeoutMs, isCancelled, response, receivedAnything))
+            {
+                response.succeeded = true;
+                return response;
+            }
+
+            // A kept-alive connection the server dropped between our check and
+            // the request fails without a byte of response; retry once fresh.
+            if (!(reused && !receivedAnything && idempotent) || (isCancelled != nullptr && isCancelled()))
+                return response;
+        }
+
+        return {};
+    }
+
+    void evictIdle()
+    {
+        idle->evict();
+    }
+
+    int getNumIdleConnections() const
+    {
+        return idle->size();
+    }
+
+    // Total TCP connections opened, for diagnostics.
+    juce::int64 getNumConnectionsOpened() const noexcept { return connectionsOpened.load(); }
+
+private:
+    static juce::MemoryBlock buildRequestHead(const juce::String& method,
+                                              const juce::URL& url,
+                                              const juce::String& extraHeaders,
+                                              juce::int64 bodyLength)
+    {
+        auto path = url.getSubPath(true);
+        if (!path.startsWithChar('/'))
+            path = "/" + path;
+
+        juce::String head;
+        head << method << " " << path << " HTTP/1.1\r\n"
+             << "Host: 127.0.0.1:" << url.getPort() << "\r\n"
+             << "Connection: keep-alive\r\n";
+
+        juce::StringArray headerLines;
+        headerLines.addLines(extraHeaders);
+        for (const auto& line : headerLines)
+            if (line.trim().isNotEmpty() && !line.startsWithIgnoreCase("Content-Length:")
+                && !line.startsWithIgnoreCase("Connection:") && !line.startsWithIgnoreCase("Host:"))
+                head << line.trim() << "\r\n";
+
+        if (bodyLength > 0 || method == "POST" || method == "PUT")
+            head << "Content-Length: " << bodyLength << "\r\n";
+
+        head << "\r\n";
+        return juce::MemoryBlock(head.toRawUTF8(), head.getNumBytesAsUTF8());
+    }
+
+    // StreamingSocket::connect fails at once on 0, so 0 gets a default.
+    static int connectTimeoutFor(int timeoutMs) noexcept
+    {
+        if (timeoutMs > 0)
+            return juce::jmax(100, timeoutMs);
+
+        return timeoutMs == 0 ? defaultConnectTimeoutMs : -1;
+    }
+
+    // waitUntilReady waits forever on -1.
+    static int waitTimeoutFor(int timeoutMs) noexcept
+    {
+        return timeoutMs > 0 ? timeoutMs : -1;
+    }
+
+    // waitUntilReady, checking isCancelled every cancelPollMs on the way.
+    // 1 when ready, 0 on timeout, -1 on error or cancellation.
+    static int waitForSocket(juce::StreamingSocket& socket, bool readyForReading, int waitTimeoutMs,
+                             const CancelCheck& isCancelled)
+    {
+        if (isCancelled == nullptr)
+            return socket.waitUntilReady(readyForReading, waitTimeoutMs);
+
+        const auto startMs = juce::Time::getMillisecondCounter();
+
+        for (;;)
+        {
+            if (isCancelled())
+                return -1;
+
+            int slice = cancelPollMs;
+            if (waitTimeoutMs >= 0)
+            {
+                const int left = waitTimeoutMs - (int)(juce::Time::getMillisecondCounter() - startMs);
+                slice = juce::jlimit(0, cancelPollMs, left);
+            }
+
+            const int ready = socket.waitUntilReady(readyForReading, slice);
+            if (ready != 0 || (waitTimeoutMs >= 0 && slice < cancelPollMs))
+                return ready;
+        }
+    }
+
+    std::unique_ptr<Connection> acquire(int port, int timeoutMs, bool& reused)
+    {
+        if (auto connection = idle->take(port))
+        {
+            reused = true;
+            return connection;
+        }
+
+        auto connection = std::make_unique<Connection>();
+        connection->port = port;
+        if (!connection->socket.connect("127.0.0.1", port, connectTimeoutFor(timeoutMs)))
+            return nullptr;
+
+        ++connectionsOpened;
+        reused = false;
+        return connection;
+    }
+
+    static bool send(Connection& connection, const void* bytes, size_t numBytes, int timeoutMs,
+                     const CancelCheck& isCancelled)
+    {
+        auto* data = static_cast<const char*>(bytes);
+        int remaining = (int)numBytes;
+
+        while (remaining > 0)
+        {
+            if (waitForSocket(connection.socket, false, waitTimeoutFor(timeoutMs), isCancelled) != 1)
+                return false;
+
+            const int written = connection.socket.write(data, remaining);
+            if (written <= 0)
+                return false;
+
+            data += written;
+            remaining -= written;
+        }
+
+        return true;
+    }
+
+    static bool sendBody(Connection& connection, juce::InputStream& body, int timeoutMs,
+                         const CancelCheck& isCancelled)
+    {
+        juce::HeapBlock<char> block(uploadBlockBytes);
+
+        while (!body.isExhausted())
+        {
+            const int bytesRead = body.read(block.get(), (int)uploadBlockBytes);
+            if (bytesRead < 0)
+                return false;
+            if (bytesRead == 0)
+                break;
+
+            if (!send(connection, block.get(), (size_t)bytesRead, timeoutMs, isCancelled))
+                return false;
+        }
+
+        return true;
+    }
+
+    static int findHeaderEnd(const juce::MemoryBlock& buffer)
+    {
+        const auto* data = static_cast<const char*>(buffer.getData());
+        for (size_t i = 3; i < buffer.getSize(); ++i)
+            if (data[i - 3] == '\r' && data[i - 2] == '\n' && data[i - 1] == '\r' && data[i] == '\n')
+                return (int)i + 1;
+
+        return -1;
+    }
+
+    // Reads the status line and headers; on success the connection moves
+    // into the response's body stream.
+    bool readResponse(std::unique_ptr<Connection>& connection, const juce::String& method, int timeoutMs,
+                      const CancelCheck& isCancelled, Response& response, bool& receivedAnything)
+    {
+        juce::MemoryBlock buffer;
+        int headerEnd = -1;
+        char chunk[16384];
+
+        while ((headerEnd = findHeaderEnd(buffer)) < 0)
+        {
+            if (buffer.getSize() > maxHeaderBytes
+                || waitForSocket(connection->socket, true, waitTimeoutFor(timeoutMs), isCancelled) != 1)
+                return false;
+
+            const int bytesRead = connection->socket.read(chunk, (int)sizeof(chunk), false);
+            if (bytesRead <= 0)
+                return false;
+
+            buffer.append(chunk, (size_t)bytesRead);
+            receivedAnything = true;
+        }
+
+        const auto head = juce::String::fromUTF8(static_cast<const char*>(buffer.getData()), headerEnd);
+        juce::StringArray lines;
+        lines.addLines(head);
+        lines.removeEmptyStrings();
+        if (lines.isEmpty())
+            return false;
+
+        const auto statusLine = lines[0];
+        response.statusCode = statusLine.fromFirstOccurrenceOf(" ", false, false).getIntValue();
+        bool keepAlive = statusLine.startsWith("HTTP/1.1");
+
+        for (int i = 1; i < lines.size(); ++i)
+        {
+            const auto key = lines[i].upToFirstOccurrenceOf(":", false, false).trim();
+            const auto value = lines[i].fromFirstOccurrenceOf(":", false, false).trim();
+            response.headers.set(key, value);
+        }
+
+        if (response.headers["Connection"].equalsIgnoreCase("close"))
+            keepAlive = false;
+
+        juce::MemoryBlock rest(static_cast<const char*>(buffer.getData()) + headerEnd, buffer.getSize() - (size_t)headerEnd);
+
+        auto framing = BodyStream::Framing::untilClose;
+        juce::int64 contentLength = 0;
+
+        if (method == "HEAD" || response.statusCode == 204 || response.statusCode == 304
+            || (response.statusCode >= 100 && response.statusCode < 200))
+        {
+            framing = BodyStream::Framing::empty;
+        }
+        else if (response.headers["Transfer-Encoding"].containsIgnoreCase("chunked"))
+        {
+            framing = BodyStream::Framing::chunked;
+        }
+        else if (response.headers["Content-Length"].isNotEmpty())
+        {
+            framing = BodyStream::Framing::length;
+            contentLength = response.headers["Content-Length"].getLargeIntValue();
+            if (contentLength < 0)
+                return false;
+        }
+
+        response.body = std::make_unique<BodyStream>(std::move(connection), idle, std::move(rest),
+                                                     framing, contentLength, keepAlive, timeoutMs, isCancelled);
+        return true;
+    }
+
+    static constexpr double idleTimeoutMs = 4000.0;
+    static constexpr int maxIdlePerPort = 4;
+    static constexpr int defaultConnectTimeoutMs = 5000;
+    static constexpr int cancelPollMs = 50;
+    static constexpr size_t uploadBlockBytes = 64 * 1024;
+    static constexpr size_t maxHeaderBytes = 64 * 1024;
+
+    std::shared_ptr<IdleConnections> idle = std::make_shared<IdleConnections>();
+    std::atomic<juce::int64> connectionsOpened{ 0 };
+
+    JUCE_DECLARE_NON_COPYABLE(LocalConnectionPool)
+};
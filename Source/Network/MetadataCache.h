@@ -0,0 +1,260 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// MetadataCache.h
+#pragma once
+#include <JuceHeader.h>
+#include "HttpClient.h"
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Responses from the metadata endpoints (model lists, LoRAs, checkpoints,
+// prompt banks, config), shared by every plugin instance in the process
+// through juce::SharedResourcePointer.
+//
+// A fetch is answered from the cache when the last good response is younger
+// than the caller's maxAgeMs. Otherwise it joins the request already on its
+// way for the same URL, POST body, headers and timeout, or starts one, so a
+// host full of instances opening at once asks each backend once. A refetch
+// sends the stored ETag as If-None-Match, and a 304 serves the stored body
+// again. Only 2xx responses with a body are stored; failures reach everyone
+// who was waiting but are never replayed.
+//
+// The shared request runs on the cache's own client rather than the first
+// caller's, so an editor that closes and cancels its client's jobs can't fail
+// the fetch for every other instance waiting on it.
+//
+// Callbacks always run on an HttpClient worker, never on the caller's thread,
+// so they can parse before posting anything to the message thread.
+class MetadataCache
+{
+public:
+    struct Response
+    {
+        int statusCode = 0;     // 0 if no answer came back
+        juce::String body;
+    };
+
+    using Callback = std::function<void(const Response&)>;
+
+    static constexpr int defaultTimeoutMs = 10000;
+
+    MetadataCache() = default;
+
+    // client only delivers cache hits; cancelling it drops this caller's
+    // callback but never the shared request.
+    void fetch(HttpClient& client,
+               const juce::URL& url,
+               int maxAgeMs,
+               Callback callback,
+               int connectionTimeoutMs = defaultTimeoutMs,
+               const juce::String& extraHeaders = {})
+    {
+        const auto urlKey = getUrlKey(url);
+        const auto key = urlKey + "\n" + extraHeaders + "\n" + juce::String(connectionTimeoutMs);
+        const auto now = juce::Time::getMillisecondCounter();
+        juce::String etag;
+        bool hit = false;
+        Response cached;
+
+        // Nothing is submitted with the lock held: a client that drops queued
+        // jobs does so under its own lock, and their Landings take this one.
+        {
+            const std::lock_guard<std::mutex> lock(mutex);
+            auto& entry = entries[key];
+            entry.urlKey = urlKey;
+
+            if (entry.valid && maxAgeMs > 0 && (int)(now - entry.fetchedMs) < maxAgeMs)
+            {
+                hit = true;
+                cached = { entry.statusCode, entry.body };
+            }
+            else
+            {
+                entry.waiters.push_back(std::move(callback));
+                if (entry.waiters.size() > 1)
+                    return;
+
+                etag = entry.etag;
+                evictOldest();
+            }
+        }
+
+        if (hit)
+        {
+            client.submit(HttpClient::Priority::Metadata, url, [callback, cached](const HttpClient::CancellationToken&)
+            {
+                callback(cached);
+            });
+            return;
+        }
+
+        auto landing = std::make_shared<Landing>(*this, key);
+        juce::String headers = extraHeaders;
+        if (etag.isNotEmpty())
+            headers = (headers.isNotEmpty() ? headers + "\r\n" : juce::String()) + "If-None-Match: " + etag;
+
+        fetchClient.submit(HttpClient::Priority::Metadata, url, [landing, url, headers, connectionTimeoutMs](const HttpClient::CancellationToken&)
+        {
+            int statusCode = 0;
+            juce::StringPairArray responseHeaders;
+            juce::String body;
+
+            try
+            {
+                auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
+                    .withConnectionTimeoutMs(connectionTimeoutMs)
+                    .withStatusCode(&statusCode)
+                    .withResponseHeaders(&responseHeaders)
+                    .withExtraHeaders(headers);
+
+                if (auto stream = HttpClient::openStream(url, options))
+                    body = stream->readEntireStreamAsString();
+                else
+                    statusCode = 0;
+            }
+            catch (...)
+            {
+                statusCode = 0;
+            }
+
+            landing->land(statusCode, body, responseHeaders["ETag"]);
+        });
+    }
+
+    // Forces the next fetch of url to go to the backend, e.g. after a request
+    // that changes what it returns. A fetch already under way still lands.
+    void invalidate(const juce::URL& url)
+    {
+        const auto urlKey = getUrlKey(url);
+        const std::lock_guard<std::mutex> lock(mutex);
+
+        for (auto& [key, entry] : entries)
+            if (entry.urlKey == urlKey)
+                entry.valid = false;
+    }
+
+private:
+    struct Entry
+    {
+        juce::String urlKey;    // URL and POST body, without the headers and timeout
+        bool valid = false;
+        int statusCode = 0;
+        juce::String body;
+        juce::String etag;
+        juce::uint32 fetchedMs = 0;
+        std::vector<Callback> waiters;
+    };
+
+    // Delivers a fetch's result. If the job is dropped before it runs (the
+    // cache is going away) any waiters still hear back, as a failure posted
+    // to the message thread rather than from inside the client's lock.
+    class Landing
+    {
+    public:
+        Landing(MetadataCache& cacheToUse, const juce::String& keyToUse) : cache(cacheToUse), key(keyToUse) {}
+
+        ~Landing()
+        {
+            if (landed)
+                return;
+
+            auto waiters = cache.takeWaiters(key);
+            if (!waiters.empty())
+                juce::MessageManager::callAsync([waiters]
+                {
+                    for (const auto& waiter : waiters)
+                        waiter(Response {});
+                });
+        }
+
+        void land(int statusCode, const juce::String& body, const juce::String& etag)
+        {
+            landed = true;
+            const auto response = cache.store(key, statusCode, body, etag);
+
+            for (const auto& waiter : cache.takeWaiters(key))
+                waiter(response);
+        }
+
+    private:
+        MetadataCache& cache;   // Its client, and so every Landing, goes first
+        const juce::String key;
+        bool landed = false;
+    };
+
+    static juce::String getUrlKey(const juce::URL& url)
+    {
+        const auto postData = url.getPostData();
+        return postData.isEmpty() ? url.toString(true) : url.toString(true) + "\n" + postData;
+    }
+
+    Response store(const juce::String& key, int statusCode, const juce::String& body, const juce::String& etag)
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        auto& entry = entries[key];
+
+        if (statusCode == 304 && entry.body.isNotEmpty())
+        {
+            entry.valid = true;
+            entry.fetchedMs = juce::Time::getMillisecondCounter();
+            return { entry.statusCode, entry.body };
+        }
+
+        if (statusCode >= 200 && statusCode < 300 && body.isNotEmpty())
+        {
+            entry.valid = true;
+            entry.statusCode = statusCode;
+            entry.body = body;
+            entry.etag = etag;
+            entry.fetchedMs = juce::Time::getMillisecondCounter();
+        }
+
+        return { statusCode, body };
+    }
+
+    std::vector<Callback> takeWaiters(const juce::String& key)
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        std::vector<Callback> waiters;
+
+        const auto it = entries.find(key);
+        if (it != entries.end())
+            waiters.swap(it->second.waiters);
+
+        return waiters;
+    }
+
+    // Keeps the cache to maxEntries, dropping the longest-unrefreshed entry
+    // that nobody is waiting on. Called with the lock held.
+    void evictOldest()
+    {
+        if (entries.size() <= maxEntries)
+            return;
+
+        const auto now = juce::Time::getMillisecondCounter();
+        auto oldest = entries.end();
+
+        for (auto it = entries.begin(); it != entries.end(); ++it)
+            if (it->second.waiters.empty()
+                && (oldest == entries.end() || now - it->second.fetchedMs > now - oldest->second.fetchedMs))
+                oldest = it;
+
+        if (oldest != entries.end())
+            entries.erase(oldest);
+    }
+
+    static constexpr size_t maxEntries = 64;
+
+    static constexpr int numFetchWorkers = 4;
+
+    std::mutex mutex;
+    std::map<juce::String, Entry> entries;
+
+    // Declared last so its jobs are cancelled and joined while the entries
+    // their Landings touch still exist.
+    HttpClient fetchClient { numFetchWorkers, HttpClient::defaultMaxRequestsPerHost, 0 };
+};
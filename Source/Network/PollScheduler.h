@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// PollScheduler.h
+#pragma once
+#include <JuceHeader.h>
+#include <cstdint>
+
+// Decides when the next status poll for a running job is due.
+//
+// The first poll goes out after the fastest interval, so a job that finishes
+// in well under a second comes back almost at once. After that the interval
+// follows what the backend reports:
+//  - progress moving: about a third of the time the progress rate says is
+//    left, so polls close in as the job nears completion, and spread out
+//    again if it overruns that estimate;
+//  - queued or warming: half the reported wait, otherwise backing off
+//    towards the slowest interval;
+//  - nothing reported yet: growing from the fastest to the normal interval.
+//
+// It only keeps deadlines. Callers ask isDue() from their own timer or loop,
+// so nothing ever has to sleep to space polls out.
+class PollScheduler
+{
+public:
+    struct Intervals
+    {
+        int fastestMs = 250;    // Floor, and the delay before the first poll
+        int normalMs = 3000;    // Ceiling while running
+        int slowestMs = 8000;   // Ceiling while queued or warming
+    };
+
+    PollScheduler() = default;
+    explicit PollScheduler(Intervals intervalsToUse)
+        : intervals(intervalsToUse), intervalMs(intervalsToUse.fastestMs) {}
+
+    // A new job: forget the last one and poll soon.
+    void start()
+    {
+        state = State::unknown;
+        intervalMs = intervals.fastestMs;
+        lastPercent = -1;
+        msPerPercent = 0.0;
+        lastPolledMs = lastChangeMs = now();
+    }
+
+    // True once the current interval (or minimumIntervalMs, if longer) has
+    // passed since the last poll.
+    bool isDue(int minimumIntervalMs = 0) const
+    {
+        return getMsUntilDue(minimumIntervalMs) == 0;
+    }
+
+    int getMsUntilDue(int minimumIntervalMs = 0) const
+    {
+        const int elapsed = (int)(now() - lastPolledMs);
+        return juce::jmax(0, juce::jmax(intervalMs, minimumIntervalMs) - elapsed);
+    }
+
+    int getIntervalMs() const noexcept { return intervalMs; }
+
+    // Call as each poll goes out.
+    void notePolled()
+    {
+        lastPolledMs = now();
+
+        // No rate to go on yet: ease off gradually
+        if (state == State::unknown || (state == State::running && msPerPercent <= 0.0))
+            intervalMs = juce::jmin(intervals.normalMs, intervalMs * 8 / 5);
+    }
+
+    // The job is running at percent (0-100).
+    void noteProgress(int percent)
+    {
+        const auto time = now();
+        percent = juce::jlimit(0, 100, percent);
+
+        if (state != State::running || percent < lastPercent)
+        {
+            lastPercent = percent;
+            lastChangeMs = time;
+            msPerPercent = 0.0;
+        }
+        else if (percent > lastPercent)
+        {
+            // Smoothed time per percent point
+            const double sample = (double)(time - lastChangeMs) / (double)(percent - lastPercent);
+            msPerPercent = msPerPercent > 0.0 ? msPerPercent * 0.6 + sample * 0.4 : sample;
+            lastPercent = percent;
+            lastChangeMs = time;
+        }
+
+        state = State::running;
+
+        if (msPerPercent <= 0.0)
+        {
+            intervalMs = juce::jlimit(intervals.fastestMs, intervals.normalMs, intervalMs);
+            return;
+        }
+
+        const double expectedLeftMs = msPerPercent * (100 - lastPercent) - (double)(time - lastChangeMs);
+        const double nextMs = expectedLeftMs > 0.0 ? expectedLeftMs / 3.0 : -expectedLeftMs / 2.0;
+        intervalMs = juce::jlimit(intervals.fastestMs, intervals.normalMs, (int)nextMs);
+    }
+
+    // The job is queued or the model is loading; estimatedSeconds if the
+    // backend gave a wait, 0 if not.
+    void noteWaiting(int estimatedSeconds = 0)
+    {
+        if (estimatedSeconds > 0)
+            intervalMs = juce::jlimit(intervals.fastestMs, intervals.slowestMs, estimatedSeconds * 500);
+        else if (state != State::waiting)
+            intervalMs = juce::jmax(intervalMs, intervals.normalMs / 2);
+        else
+            intervalMs = juce::jmin(intervals.slowestMs, intervalMs * 3 / 2);
+
+        state = State::waiting;
+        lastPercent = -1;
+        msPerPercent = 0.0;
+    }
+
+private:
+    enum class State { unknown, running, waiting };
+
+    static uint32_t now() noexcept { return juce::Time::getMillisecondCounter(); }
+
+    Intervals intervals;
+    State state = State::unknown;
+    int intervalMs = Intervals().fastestMs;
+    int lastPercent = -1;
+    double msPerPercent = 0.0;
+    uint32_t lastPolledMs = 0;
+    uint32_t lastChangeMs = 0;
+};
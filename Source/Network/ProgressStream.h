@@ -0,0 +1,439 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// ProgressStream.h
+#pragma once
+#include <JuceHeader.h>
+#include "HttpClient.h"
+#include "JsonAudioStream.h"
+#include "PollScheduler.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <set>
+
+// Server-pushed status for an endpoint that is otherwise polled.
+//
+// The status URL is requested once with "Accept: text/event-stream". A backend
+// that has opted in answers with a text/event-stream body and sends a Server-
+// Sent Event whenever the status changes, each event's data being the same
+// JSON a poll would return (":" comment lines work as heartbeats). Anything
+// else means the backend doesn't push: a 2xx body is still queued as one
+// ordinary status, and the endpoint (the URL up to its last path segment) is
+// remembered so later requests go straight to polling.
+//
+// Events are read on the stream's own thread and queued; callers drain them
+// from their timer or worker loop and keep polling whenever isPushing() is
+// false. Audio keys in an event are decoded to disk, and its JSON parsed, on
+// the way in, so neither happens on the thread that drains them.
+class ProgressStream : private juce::Thread
+{
+public:
+    struct Event
+    {
+        juce::String json;                      // One status, as a poll would return it
+        juce::var status;                       // The same, already parsed
+        JsonAudioStream::DecodedFile audio;     // Decoded audio value, if any
+    };
+
+    explicit ProgressStream(const juce::URL& statusUrl,
+                            const juce::StringArray& audioKeysToDecode = {},
+                            int connectionTimeoutMs = 8000)
+        : juce::Thread("gary4juce progress stream"),
+          url(statusUrl),
+          endpointKey(statusUrl.toString(false).upToLastOccurrenceOf("/", true, false)),
+          audioKeys(audioKeysToDecode),
+          connectTimeoutMs(connectionTimeoutMs)
+    {
+        if (isKnownUnsupported(url))
+            ended.store(true, std::memory_order_release);
+        else
+            startThread();
+    }
+
+    ~ProgressStream() override
+    {
+        signalThreadShouldExit();
+
+        {
+            const std::lock_guard<std::mutex> lock(streamLock);
+            if (activeStream != nullptr)
+                activeStream->cancel();
+        }
+
+        stopThread(4000);
+    }
+
+    // True while the connection is open and delivering events.
+    bool isPushing() const noexcept { return pushing.load(std::memory_order_acquire); }
+
+    // True if the backend streamed at all, even if it has stopped since.
+    bool hasPushed() const noexcept { return pushed.load(std::memory_order_acquire); }
+
+    // True once the stream has closed and every queued event has been taken.
+    bool hasEnded() const
+    {
+        const std::lock_guard<std::mutex> lock(queueLock);
+        return ended.load(std::memory_order_acquire) && queue.empty();
+    }
+
+    // Takes the oldest undelivered status, if there is one.
+    bool popEvent(Event& event)
+    {
+        const std::lock_guard<std::mutex> lock(queueLock);
+        return takeFront(event);
+    }
+
+    // As popEvent, but waits up to timeoutMs for one. Returns false at once
+    // when the stream has ended with nothing left to deliver.
+    bool waitForEvent(Event& event, int timeoutMs)
+    {
+        std::unique_lock<std::mutex> lock(queueLock);
+        queueChanged.wait_for(lock, std::chrono::milliseconds(juce::jmax(0, timeoutMs)), [this]
+        {
+            return !queue.empty() || ended.load(std::memory_order_acquire);
+        });
+
+        return takeFront(event);
+    }
+
+    static bool isKnownUnsupported(const juce::URL& statusUrl)
+    {
+        const std::lock_guard<std::mutex> lock(unsupportedLock());
+        return unsupportedEndpoints().count(statusUrl.toString(false).upToLastOccurrenceOf("/", true, false)) > 0;
+    }
+
+private:
+    void run() override
+    {
+        auto stream = std::make_unique<juce::WebInputStream>(url, false);
+        stream->withExtraHeaders("Accept: text/event-stream\r\nCache-Control: no-cache")
+              .withConnectionTimeout(connectTimeoutMs)
+              .withNumRedirectsToFollow(3);
+
+        {
+            const std::lock_guard<std::mutex> lock(streamLock);
+            activeStream = stream.get();
+        }
+
+        const bool connected = !threadShouldExit() && stream->connect(nullptr);
+        const int statusCode = stream->getStatusCode();
+        const auto contentType = stream->getResponseHeaders()["Content-Type"];
+
+        if (connected && statusCode > 0 && !threadShouldExit())
+        {
+            if (contentType.containsIgnoreCase("text/event-stream") && statusCode < 300)
+            {
+                DBG("[progress] pushing from " + endpointKey);
+                pushed.store(true, std::memory_order_release);
+                pushing.store(true, std::memory_order_release);
+                readEvents(*stream);
+            }
+            else
+            {
+                rememberUnsupported();
+
+                if (statusCode >= 200 && statusCode < 300)
+                {
+                    auto response = JsonAudioStream::read(*stream, audioKeys);
+                    if (response.complete)
+                        enqueue({ response.json, juce::JSON::parse(response.json), response.audio });
+                }
+            }
+        }
+
+        {
+            const std::lock_guard<std::mutex> lock(streamLock);
+            activeStream = nullptr;
+        }
+
+        finish();
+    }
+
+    // WebInputStream::read waits for the whole request to arrive, so the
+    // stream is read a byte at a time to hand each event over as soon as its
+    // closing blank line does. Data lines go straight into a JSON scanner as
+    // they arrive, a small block at a time, so a pushed result's audio is
+    // decoded to disk on the way in and never held whole as base64.
+    void readEvents(juce::InputStream& stream)
+    {
+        std::unique_ptr<JsonAudioStream::Scanner> scanner;
+        char pendingData[dataBlockBytes];
+        size_t numPendingData = 0;
+        juce::String field;
+        int dataLines = 0;
+        bool inValue = false;
+        bool valueIsData = false;
+        bool skipSpace = false;
+        bool lastWasCR = false;
+
+        const auto flushData = [&]
+        {
+            if (numPendingData > 0)
+            {
+                scanner->write(pendingData, numPendingData);
+                numPendingData = 0;
+            }
+        };
+
+        const auto writeData = [&](char byte)
+        {
+            pendingData[numPendingData++] = byte;
+            if (numPendingData == sizeof(pendingData))
+                flushData();
+        };
+
+        // Lines of one event are joined with newlines
+        const auto startDataLine = [&]
+        {
+            if (dataLines++ > 0)
+                writeData('\n');
+            else
+                scanner = std::make_unique<JsonAudioStream::Scanner>(audioKeys);
+        };
+
+        const auto endLine = [&]
+        {
+            if (field.isEmpty() && !inValue)
+            {
+                // Blank line: dispatch the event collected so far
+                if (dataLines > 0)
+                {
+                    flushData();
+                    auto response = scanner->finish();
+                    if (response.complete)
+                        enqueue({ response.json, juce::JSON::parse(response.json), response.audio });
+                }
+
+                scanner.reset();
+                dataLines = 0;
+            }
+            else if (field == "data" && !inValue)
+            {
+                // "data" with no colon is an empty data line
+                startDataLine();
+            }
+
+            field.clear();
+            inValue = false;
+            valueIsData = false;
+        };
+
+        char c = 0;
+        while (!threadShouldExit() && stream.read(&c, 1) == 1)
+        {
+            if (c == '\n' && lastWasCR)
+            {
+                lastWasCR = false;
+                continue;
+            }
+
+            lastWasCR = (c == '\r');
+
+            if (c == '\r' || c == '\n')
+            {
+                endLine();
+            }
+            else if (inValue)
+            {
+                // One space after the colon isn't part of the value
+                if (valueIsData && !(skipSpace && c == ' '))
+                    writeData(c);
+
+                skipSpace = false;
+            }
+            else if (c == ':')
+            {
+                inValue = true;
+                skipSpace = true;
+                valueIsData = (field == "data");
+
+                if (valueIsData)
+                    startDataLine();
+            }
+            else if (field.length() < maxFieldLength)
+            {
+                field += c;
+            }
+        }
+
+        DBG("[progress] stream from " + endpointKey + " closed");
+    }
+
+    void enqueue(Event event)
+    {
+        {
+            const std::lock_guard<std::mutex> lock(queueLock);
+            queue.push_back(std::move(event));
+        }
+
+        queueChanged.notify_all();
+    }
+
+    void finish()
+    {
+        {
+            const std::lock_guard<std::mutex> lock(queueLock);
+            pushing.store(false, std::memory_order_release);
+            ended.store(true, std::memory_order_release);
+        }
+
+        queueChanged.notify_all();
+    }
+
+    bool takeFront(Event& event)
+    {
+        if (queue.empty())
+            return false;
+
+        event = std::move(queue.front());
+        queue.pop_front();
+        return true;
+    }
+
+    void rememberUnsupported()
+    {
+        DBG("[progress] " + endpointKey + " doesn't push - polling");
+        const std::lock_guard<std::mutex> lock(unsupportedLock());
+        unsupportedEndpoints().insert(endpointKey);
+    }
+
+    static std::mutex& unsupportedLock()
+    {
+        static std::mutex lock;
+        return lock;
+    }
+
+    static std::set<juce::String>& unsupportedEndpoints()
+    {
+        static std::set<juce::String> endpoints;
+        return endpoints;
+    }
+
+    static constexpr int maxFieldLength = 16;
+    static constexpr size_t dataBlockBytes = 4096;
+
+    const juce::URL url;
+    const juce::String endpointKey;
+    const juce::StringArray audioKeys;
+    const int connectTimeoutMs;
+
+    std::mutex streamLock;
+    juce::WebInputStream* activeStream = nullptr;
+
+    mutable std::mutex queueLock;
+    std::condition_variable queueChanged;
+    std::deque<Event> queue;
+    std::atomic<bool> pushing{ false };
+    std::atomic<bool> pushed{ false };
+    std::atomic<bool> ended{ false };
+};
+
+// Status source for worker loops that used to poll on a fixed interval.
+//
+// Statuses come from a ProgressStream while the backend pushes them, backed
+// up by a poll every backupPollMs. When the backend doesn't push, or the
+// stream drops, polls are paced by a PollScheduler that the caller feeds with
+// the progress it parses. Either way a status arrives already parsed, with
+// any audio key decoded to disk on the way in, so a finished result never
+// exists as one long string. Constructed on an HttpClient job, its waits end
+// early once that job is cancelled.
+class StatusFeed
+{
+public:
+    enum class Result
+    {
+        status,     // The event holds the next status
+        waiting,    // Nothing yet; call again
+        failed      // The poll request failed
+    };
+
+    static constexpr int backupPollMs = 20000;
+
+    StatusFeed(const juce::URL& statusUrl, PollScheduler::Intervals intervals, int connectionTimeoutMsToUse,
+               const juce::StringArray& audioKeysToDecode = {})
+        : url(statusUrl),
+          audioKeys(audioKeysToDecode),
+          push(statusUrl, audioKeysToDecode, connectionTimeoutMsToUse),
+          schedule(intervals),
+          maxWaitMs(intervals.normalMs),
+          connectionTimeoutMs(connectionTimeoutMsToUse)
+    {
+        schedule.start();
+    }
+
+    void noteProgress(int percent) { schedule.noteProgress(percent); }
+    void noteWaiting(int estimatedSeconds = 0) { schedule.noteWaiting(estimatedSeconds); }
+
+    // Blocks for one normal poll interval at most, and returns waiting at
+    // once when the job is cancelled.
+    Result next(ProgressStream::Event& status)
+    {
+        const int minimumIntervalMs = push.isPushing() ? backupPollMs : 0;
+
+        if (waitForEvent(status, juce::jmin(maxWaitMs, schedule.getMsUntilDue(minimumIntervalMs))))
+            return Result::status;
+
+        if (cancellation.isCancelled())
+            return Result::waiting;
+
+        if (!schedule.isDue(minimumIntervalMs))
+        {
+            if (push.isPushing() || !push.hasEnded())
+                return Result::waiting;
+
+            sleep(juce::jmin(maxWaitMs, schedule.getMsUntilDue()));
+            if (cancellation.isCancelled() || !schedule.isDue())
+                return Result::waiting;
+        }
+
+        schedule.notePolled();
+
+        int statusCode = 0;
+        auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
+            .withHttpRequestCmd("GET")
+            .withConnectionTimeoutMs(connectionTimeoutMs)
+            .withStatusCode(&statusCode)
+            .withExtraHeaders("Accept: application/json");
+
+        auto stream = HttpClient::openStream(url, options);
+        if (stream == nullptr || statusCode >= 400)
+            return Result::failed;
+
+        auto response = JsonAudioStream::read(*stream, audioKeys);
+        status = { response.json, juce::JSON::parse(response.json), response.audio };
+        return Result::status;
+    }
+
+private:
+    static constexpr int cancelPollMs = 50;
+
+    // push.waitForEvent in cancelPollMs slices.
+    bool waitForEvent(ProgressStream::Event& status, int timeoutMs)
+    {
+        for (int left = juce::jmax(0, timeoutMs);; left -= cancelPollMs)
+        {
+            if (push.waitForEvent(status, juce::jmin(left, cancelPollMs)))
+                return true;
+
+            if (left <= cancelPollMs || cancellation.isCancelled() || push.hasEnded())
+                return false;
+        }
+    }
+
+    void sleep(int timeoutMs)
+    {
+        for (int left = timeoutMs; left > 0 && !cancellation.isCancelled(); left -= cancelPollMs)
+            juce::Thread::sleep(juce::jmin(left, cancelPollMs));
+    }
+
+    const HttpClient::CancellationToken cancellation = HttpClient::getCurrentJobToken();
+    const juce::URL url;
+    const juce::StringArray audioKeys;
+    ProgressStream push;
+    PollScheduler schedule;
+    const int maxWaitMs;
+    const int connectionTimeoutMs;
+};
@@ -0,0 +1,458 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// VariationBatch.h
+#pragma once
+#include <JuceHeader.h>
+#include "HttpClient.h"
+#include "JsonAudioStream.h"
+#include "PollScheduler.h"
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Several variations of one request (seeds, terry variations) in flight at
+// once.
+//
+// Up to the concurrency limit, variations are submitted together; as each
+// finishes, its slot goes to the next one still waiting. The limit can change
+// after the batch has started, so it can begin at 1 and open up once the
+// backend's health answer says how many jobs it will run at a time.
+//
+// Every submitted variation keeps its own PollScheduler, and the ones that are
+// due are polled side by side rather than one after another. A completed
+// poll has its audio decoded to disk on the worker that read it, so a take
+// is ready to install the moment it is handed over. A variation whose
+// progress stops moving for too long is failed as stalled, the same way a
+// single generation is, so one wedged job can't hold its slot forever.
+//
+// Nothing blocks. The owner calls service() from its timer, which sends
+// whatever is due, and drains finished takes with popTake() in the order
+// they completed. Jobs keep the shared state alive, so a batch can be
+// destroyed with requests still running; their results are simply dropped.
+class VariationBatch
+{
+public:
+    // What a submit request came back with.
+    struct Submitted
+    {
+        juce::String sessionId;     // Empty if it failed
+        juce::String seed;          // The seed the backend says it will use
+        juce::String error;
+    };
+
+    // One status, as the owner's parser reads it.
+    struct Status
+    {
+        enum class State { running, waiting, completed, failed };
+
+        State state = State::running;
+        int progress = 0;
+        int estimatedSeconds = 0;   // Queue wait, if the backend gave one
+        juce::String seed;
+        juce::String error;
+    };
+
+    struct Variation
+    {
+        juce::String label;
+        juce::URL url;      // Where submit sends the request
+        std::function<Submitted(const HttpClient::CancellationToken&)> submit;  // Runs on a worker
+    };
+
+    struct Take
+    {
+        int index = 0;                          // Position in the variation list
+        juce::String label;
+        juce::String seed;
+        JsonAudioStream::DecodedFile audio;     // nullptr if the variation failed
+        juce::String error;
+    };
+
+    using PollUrlFunction = std::function<juce::URL(const juce::String& sessionId)>;
+    using StatusParser = std::function<Status(const juce::String& json)>;
+
+    static constexpr int pollTimeoutMs = 8000;
+    static constexpr int maxPollFailures = 5;
+
+    // How long a variation may go without its progress moving: generous
+    // while it is still at 0% (model loading), tighter once it has started.
+    // Queue updates count as movement.
+    static constexpr int startupStallMs = 90 * 1000;
+    static constexpr int progressStallMs = 30 * 1000;
+
+    VariationBatch(HttpClient& clientToUse,
+                   std::vector<Variation> variations,
+                   PollUrlFunction pollUrlFunction,
+                   StatusParser statusParser,
+                   const juce::StringArray& audioKeys,
+                   int concurrencyLimit = 1)
+        : client(clientToUse),
+          shared(std::make_shared<Shared>())
+    {
+        shared->pollUrl = std::move(pollUrlFunction);
+        shared->parse = std::move(statusParser);
+        shared->audioKeys = audioKeys;
+        shared->limit = juce::jmax(1, concurrencyLimit);
+
+        for (auto& variation : variations)
+        {
+            shared->slots.emplace_back();
+            shared->slots.back().variation = std::move(variation);
+        }
+    }
+
+    ~VariationBatch()
+    {
+        const std::lock_guard<std::mutex> lock(shared->mutex);
+        for (auto& slot : shared->slots)
+            slot.job.cancel();
+    }
+
+    void setConcurrencyLimit(int newLimit)
+    {
+        const std::lock_guard<std::mutex> lock(shared->mutex);
+        shared->limit = juce::jmax(1, newLimit);
+    }
+
+    // Sends the submits and polls that are due. Call from the owner's timer.
+    void service()
+    {
+        std::vector<int> toSubmit, toPoll;
+
+        {
+            const std::lock_guard<std::mutex> lock(shared->mutex);
+            const auto now = juce::Time::getMillisecondCounter();
+            int active = 0;
+
+            for (int i = 0; i < (int)shared->slots.size(); ++i)
+            {
+                auto& slot = shared->slots[(size_t)i];
+                if (slot.phase != Phase::polling)
+                    continue;
+
+                const int stallMs = slot.progress > 0 ? progressStallMs : startupStallMs;
+                if ((int)(now - slot.lastMovedMs) > stallMs)
+                {
+                    slot.job.cancel();
+                    shared->finish(i, nullptr, "stalled - no progress for "
+                                               + juce::String(stallMs / 1000) + " seconds");
+                }
+            }
+
+            for (const auto& slot : shared->slots)
+                if (slot.phase == Phase::submitting || slot.phase == Phase::polling)
+                    ++active;
+
+            for (int i = 0; i < (int)shared->slots.size(); ++i)
+            {
+                auto& slot = shared->slots[(size_t)i];
+
+                if (slot.phase == Phase::pending && active < shared->limit)
+                {
+                    slot.phase = Phase::submitting;
+                    toSubmit.push_back(i);
+                    ++active;
+                }
+                else if (slot.phase == Phase::polling && !slot.pollInFlight && slot.schedule.isDue())
+                {
+                    slot.pollInFlight = true;
+                    slot.schedule.notePolled();
+                    toPoll.push_back(i);
+                }
+            }
+        }
+
+        for (const int index : toSubmit)
+            submit(index);
+
+        for (const int index : toPoll)
+            poll(index);
+    }
+
+    // Takes the oldest finished variation not yet handed over.
+    bool popTake(Take& take)
+    {
+        const std::lock_guard<std::mutex> lock(shared->mutex);
+        if (shared->finished.empty())
+            return false;
+
+        take = std::move(shared->finished.front());
+        shared->finished.pop_front();
+        return true;
+    }
+
+    int getNumVariations() const
+    {
+        const std::lock_guard<std::mutex> lock(shared->mutex);
+        return (int)shared->slots.size();
+    }
+
+    // True once every variation has finished and been taken.
+    bool isFinished() const
+    {
+        const std::lock_guard<std::mutex> lock(shared->mutex);
+        if (!shared->finished.empty())
+            return false;
+
+        for (const auto& slot : shared->slots)
+            if (slot.phase != Phase::done)
+                return false;
+
+        return true;
+    }
+
+    // Progress of the furthest-along unfinished variation, 0-100.
+    int getProgress() const
+    {
+        const std::lock_guard<std::mutex> lock(shared->mutex);
+        int progress = 0;
+
+        for (const auto& slot : shared->slots)
+            if (slot.phase != Phase::done)
+                progress = juce::jmax(progress, slot.progress);
+
+        return progress;
+    }
+
+    // True while nothing submitted has started running yet.
+    bool isWaiting() const
+    {
+        const std::lock_guard<std::mutex> lock(shared->mutex);
+
+        for (const auto& slot : shared->slots)
+            if (slot.phase == Phase::polling && !slot.waiting)
+                return false;
+
+        return true;
+    }
+
+    // The backends share one submit answer: success, session_id, and the
+    // seed they picked.
+    static Submitted readSubmitResponse(const juce::String& responseText)
+    {
+        Submitted submitted;
+        const auto response = juce::JSON::parse(responseText);
+        auto* object = response.getDynamicObject();
+
+        if (object == nullptr)
+        {
+            submitted.error = responseText.isEmpty() ? "no response" : "invalid response";
+            return submitted;
+        }
+
+        if (!(bool)object->getProperty("success"))
+        {
+            submitted.error = object->getProperty("error").toString();
+            if (submitted.error.isEmpty())
+                submitted.error = "submit failed";
+            return submitted;
+        }
+
+        submitted.sessionId = object->getProperty("session_id").toString();
+        submitted.seed = object->getProperty("seed").toString();
+        if (submitted.sessionId.isEmpty())
+            submitted.error = "response missing session id";
+
+        return submitted;
+    }
+
+    // How many jobs a backend's /health says it will run at once, if it says.
+    static int readConcurrencyLimit(const juce::String& healthText, int fallback)
+    {
+        const auto health = juce::JSON::parse(healthText);
+        if (auto* object = health.getDynamicObject())
+        {
+            const auto advertised = object->getProperty("max_concurrent_jobs");
+            if (!advertised.isVoid() && (int)advertised > 0)
+                return (int)advertised;
+        }
+
+        return fallback;
+    }
+
+private:
+    enum class Phase { pending, submitting, polling, done };
+
+    struct Slot
+    {
+        Variation variation;
+        Phase phase = Phase::pending;
+        juce::String sessionId;
+        juce::String seed;
+        PollScheduler schedule { PollScheduler::Intervals() };
+        HttpClient::CancellationToken job;      // The submit or poll last sent
+        bool pollInFlight = false;
+        bool waiting = true;
+        int progress = 0;
+        int failedPolls = 0;
+        juce::uint32 lastMovedMs = 0;           // Last time progress or the queue moved
+    };
+
+    struct Shared
+    {
+        mutable std::mutex mutex;
+        std::vector<Slot> slots;
+        std::deque<Take> finished;
+        PollUrlFunction pollUrl;
+        StatusParser parse;
+        juce::StringArray audioKeys;
+        int limit = 1;
+
+        // Called with the lock held.
+        void finish(int index, JsonAudioStream::DecodedFile audio, const juce::String& error)
+        {
+            auto& slot = slots[(size_t)index];
+            slot.phase = Phase::done;
+            slot.pollInFlight = false;
+            finished.push_back({ index, slot.variation.label, slot.seed, std::move(audio), error });
+        }
+    };
+
+    void submit(int index)
+    {
+        auto state = shared;
+        std::function<Submitted(const HttpClient::CancellationToken&)> function;
+        juce::URL url;
+
+        {
+            const std::lock_guard<std::mutex> lock(state->mutex);
+            function = state->slots[(size_t)index].variation.submit;
+            url = state->slots[(size_t)index].variation.url;
+        }
+
+        track(index, client.submit(HttpClient::Priority::Generation, url, [state, index, function](const HttpClient::CancellationToken& token)
+        {
+            Submitted submitted;
+
+            try
+            {
+                submitted = function(token);
+            }
+            catch (...)
+            {
+                submitted.error = "submit failed";
+            }
+
+            const std::lock_guard<std::mutex> lock(state->mutex);
+            auto& slot = state->slots[(size_t)index];
+            slot.seed = submitted.seed;
+
+            if (submitted.sessionId.isEmpty())
+            {
+                state->finish(index, nullptr, submitted.error.isNotEmpty() ? submitted.error : "submit failed");
+                return;
+            }
+
+            slot.sessionId = submitted.sessionId;
+            slot.phase = Phase::polling;
+            slot.schedule.start();
+            slot.lastMovedMs = juce::Time::getMillisecondCounter();
+        }));
+    }
+
+    void poll(int index)
+    {
+        auto state = shared;
+        juce::URL url;
+
+        {
+            const std::lock_guard<std::mutex> lock(state->mutex);
+            url = state->pollUrl(state->slots[(size_t)index].sessionId);
+        }
+
+        track(index, client.submit(HttpClient::Priority::Polling, url, [state, index, url](const HttpClient::CancellationToken& token)
+        {
+            bool answered = false;
+            Status status;
+            JsonAudioStream::DecodedFile audio;
+
+            try
+            {
+                int statusCode = 0;
+                auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
+                    .withConnectionTimeoutMs(pollTimeoutMs)
+                    .withNumRedirectsToFollow(3)
+                    .withStatusCode(&statusCode)
+                    .withExtraHeaders("Accept: application/json");
+
+                auto stream = token.isCancelled() ? nullptr : HttpClient::openStream(url, options);
+                if (stream != nullptr && statusCode < 400)
+                {
+                    // The audio is decoded to disk here, off the owner's thread
+                    auto response = JsonAudioStream::read(*stream, state->audioKeys);
+                    if (response.complete)
+                    {
+                        audio = response.audio;
+                        status = state->parse(response.json);
+                        answered = true;
+                    }
+                }
+            }
+            catch (...) {}
+
+            const std::lock_guard<std::mutex> lock(state->mutex);
+            auto& slot = state->slots[(size_t)index];
+            slot.pollInFlight = false;
+
+            if (slot.phase != Phase::polling)
+                return;
+
+            if (!answered)
+            {
+                if (++slot.failedPolls >= maxPollFailures)
+                    state->finish(index, nullptr, "polling failed");
+                return;
+            }
+
+            slot.failedPolls = 0;
+            if (status.seed.isNotEmpty())
+                slot.seed = status.seed;
+
+            switch (status.state)
+            {
+                case Status::State::running:
+                {
+                    const int progress = juce::jlimit(0, 100, status.progress);
+                    if (progress != slot.progress || slot.waiting)
+                        slot.lastMovedMs = juce::Time::getMillisecondCounter();
+
+                    slot.waiting = false;
+                    slot.progress = progress;
+                    slot.schedule.noteProgress(slot.progress);
+                    break;
+                }
+
+                case Status::State::waiting:
+                    slot.waiting = true;
+                    slot.lastMovedMs = juce::Time::getMillisecondCounter();
+                    slot.schedule.noteWaiting(status.estimatedSeconds);
+                    break;
+
+                case Status::State::completed:
+                    if (audio != nullptr)
+                        state->finish(index, std::move(audio), {});
+                    else
+                        state->finish(index, nullptr, "completed but no audio received");
+                    break;
+
+                case Status::State::failed:
+                    state->finish(index, nullptr, status.error.isNotEmpty() ? status.error : "failed");
+                    break;
+            }
+        }));
+    }
+
+    // One job per slot is in flight at a time, so each slot only holds on
+    // to the token of the last one it sent.
+    void track(int index, const HttpClient::CancellationToken& token)
+    {
+        const std::lock_guard<std::mutex> lock(shared->mutex);
+        shared->slots[(size_t)index].job = token;
+    }
+
+    HttpClient& client;
+    std::shared_ptr<Shared> shared;
+};
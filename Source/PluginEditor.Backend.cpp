@@ -132,64 +132,6 @@ static bool localhostHealthResponseLooksOnline(const juce::String& responseText)
     return true;
 }
 
-#if JUCE_WINDOWS
-static bool rawHealthResponseLooksOnline(
-    const juce::String& responseText, bool allowUnframedBody)
-{
-    const auto headerEnd = responseText.indexOf("\r\n\r\n");
-    if (headerEnd < 0)
-        return false;
-
-    const auto statusLine = responseText.upToFirstOccurrenceOf("\r\n", false, false);
-    juce::StringArray statusParts;
-    statusParts.addTokens(statusLine, " ", "");
-    if (statusParts.size() < 2)
-        return false;
-
-    const int statusCode = statusParts[1].getIntValue();
-    if (statusCode < 200 || statusCode >= 300)
-        return false;
-
-    const auto responseHeaders = responseText.substring(0, headerEnd);
-    auto responseBody = responseText.substring(headerEnd + 4);
-    if (responseHeaders.containsIgnoreCase("Transfer-Encoding: chunked"))
-    {
-        const auto chunkSizeEnd = responseBody.indexOf("\r\n");
-        if (chunkSizeEnd < 0)
-            return false;
-
-        const int chunkSize = responseBody.substring(0, chunkSizeEnd).getHexValue32();
-        if (responseBody.substring(chunkSizeEnd + 2).getNumBytesAsUTF8() < chunkSize)
-            return false;
-
-        responseBody = responseBody.substring(chunkSizeEnd + 2, chunkSizeEnd + 2 + chunkSize);
-    }
-    else
-    {
-        int contentLength = -1;
-        juce::StringArray headerLines;
-        headerLines.addLines(responseHeaders);
-        for (const auto& headerLine : headerLines)
-        {
-            if (headerLine.startsWithIgnoreCase("Content-Length:"))
-            {
-                contentLength = headerLine.fromFirstOccurrenceOf(":", false, false)
-                    .trim().getIntValue();
-                break;
-            }
-        }
-
-        if (contentLength >= 0
-            && responseBody.getNumBytesAsUTF8() < contentLength)
-            return false;
-        if (contentLength < 0 && !allowUnframedBody)
-            return false;
-    }
-
-    return localhostHealthResponseLooksOnline(responseBody);
-}
-#endif
-
 static bool probeLocalhostHealth(int port)
 {
     const auto startedAtMs = juce::Time::getMillisecondCounterHiRes();
@@ -197,74 +139,30 @@ static bool probeLocalhostHealth(int port)
 
     try
     {
+        // Requests go over a kept-alive raw socket (see LocalConnectionPool),
+        // so Windows no longer needs its own socket path to dodge WinINet's
+        // per-request proxy and connection setup. Refused connects on Windows
+        // retry for seconds, hence the short connect timeout there.
        #if JUCE_WINDOWS
         constexpr int connectTimeoutMs = 400;
-        constexpr int responseTimeoutMs = 1000;
-        juce::StreamingSocket socket;
-        if (!socket.connect("127.0.0.1", port, connectTimeoutMs))
-        {
-            DBG("[local health] port " + juce::String(port) + " offline after "
-                + juce::String(juce::Time::getMillisecondCounterHiRes() - startedAtMs, 1) + " ms");
-            return false;
-        }
-
-        const juce::String request =
-            "GET /health HTTP/1.1\r\n"
-            "Host: 127.0.0.1:" + juce::String(port) + "\r\n"
-            "Accept: application/json\r\n"
-            "Connection: close\r\n\r\n";
-        const auto requestUtf8 = request.toRawUTF8();
-        const int requestBytes = static_cast<int>(request.getNumBytesAsUTF8());
-
-        if (socket.waitUntilReady(false, connectTimeoutMs) != 1
-            || socket.write(requestUtf8, requestBytes) != requestBytes)
-            return false;
-
-        juce::MemoryOutputStream response;
-        const auto readDeadlineMs = juce::Time::getMillisecondCounterHiRes() + responseTimeoutMs;
-        char buffer[4096];
-
-        while (juce::Time::getMillisecondCounterHiRes() < readDeadlineMs
-            && response.getDataSize() < 1024 * 1024)
-        {
-            const auto remainingMs = juce::jmax(
-                1, static_cast<int>(readDeadlineMs - juce::Time::getMillisecondCounterHiRes()));
-            const int ready = socket.waitUntilReady(true, remainingMs);
-            if (ready <= 0)
-                break;
-
-            const int bytesRead = socket.read(buffer, static_cast<int>(sizeof(buffer)), false);
-            if (bytesRead <= 0)
-                break;
-
-            response.write(buffer, static_cast<size_t>(bytesRead));
-
-            if (rawHealthResponseLooksOnline(response.toString(), false))
-            {
-                DBG("[local health] port " + juce::String(port) + " online after "
-                    + juce::String(juce::Time::getMillisecondCounterHiRes() - startedAtMs, 1) + " ms");
-                return true;
-            }
-        }
-
-        const bool online = rawHealthResponseLooksOnline(response.toString(), true);
-        DBG("[local health] port " + juce::String(port) + " "
-            + (online ? "online" : "offline") + " after "
-            + juce::String(juce::Time::getMillisecondCounterHiRes() - startedAtMs, 1) + " ms");
-        return online;
        #else
+        constexpr int connectTimeoutMs = 1500;
+       #endif
+
         juce::URL healthUrl("http://127.0.0.1:" + juce::String(port) + "/health");
         int statusCode = 0;
         auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-            .withConnectionTimeoutMs(1500)
+            .withConnectionTimeoutMs(connectTimeoutMs)
             .withStatusCode(&statusCode)
             .withExtraHeaders("Accept: application/json");
-        auto stream = healthUrl.createInputStream(options);
-        if (stream == nullptr || statusCode >= 400)
-            return false;
+        auto stream = HttpClient::openStream(healthUrl, options);
+        const bool online = stream != nullptr && statusCode >= 200 && statusCode < 300
+            && localhostHealthResponseLooksOnline(stream->readEntireStreamAsString());
 
-        return localhostHealthResponseLooksOnline(stream->readEntireStreamAsString());
-       #endif
+        DBG("[local health] port " + juce::String(port) + " "
+            + (online ? "online" : "offline") + " after "
+            + juce::String(juce::Time::getMillisecondCounterHiRes() - startedAtMs, 1) + " ms");
+        return online;
     }
     catch (...)
     {
@@ -452,7 +350,7 @@ void Gary4juceAudioProcessorEditor::triggerLocalServiceHealthPoll(bool force)
     auto launchProbe = [asyncAlive, editor, pollNonce, completedProbes](
         ServiceType service, int port)
     {
-        juce::Thread::launch([asyncAlive, editor, pollNonce, completedProbes, service, port]()
+        editor->audioProcessor.getHttpClient().submit(HttpClient::Priority::Metadata, juce::URL("http://localhost:" + juce::String(port)), [asyncAlive, editor, pollNonce, completedProbes, service, port](const HttpClient::CancellationToken&)
         {
             const bool online = probeLocalhostHealth(port);
 
@@ -627,6 +525,7 @@ void Gary4juceAudioProcessorEditor::resetGenerationStateAfterTerminalResult()
 {
     isGenerating = false;
     isPolling = false;
+    progressStream.reset();
     isCurrentlyQueued = false;
     withinWarmup = false;
     continueInProgress = false;
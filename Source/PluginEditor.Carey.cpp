@@ -229,61 +229,34 @@ void Gary4juceAudioProcessorEditor::syncCareyLoraUi()
 void Gary4juceAudioProcessorEditor::refreshCareyAvailableLoras(bool force)
 {
     const juce::String loraUrl = getServiceUrl(ServiceType::Carey, "/loras");
-    const auto nowMs = juce::Time::getCurrentTime().toMilliseconds();
-
-    if (!force
-        && loraUrl == careyLoraFetchBackendUrl
-        && nowMs - careyLoraLastFetchMs < 2000)
-        return;
-
-    if (careyLoraFetchInFlight.exchange(true))
-        return;
-
-    careyLoraFetchBackendUrl = loraUrl;
-    careyLoraLastFetchMs = nowMs;
     const int fetchNonce = careyLoraFetchNonce.fetch_add(1) + 1;
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, fetchNonce, loraUrl]()
+    // Unforced refreshes within a couple of seconds share one response
+    audioProcessor.getMetadataCache().fetch(audioProcessor.getHttpClient(), juce::URL(loraUrl), force ? 0 : 2000,
+        [asyncAlive, editor, fetchNonce, loraUrl](const MetadataCache::Response& response)
     {
         juce::StringArray fetchedLoras;
         bool success = false;
 
-        try
+        if (response.statusCode > 0 && response.statusCode < 400)
         {
-            juce::URL url(loraUrl);
-            int statusCode = 0;
-            auto requestOptions = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-                .withHttpRequestCmd("GET")
-                .withConnectionTimeoutMs(15000)
-                .withStatusCode(&statusCode)
-                .withExtraHeaders("Accept: application/json");
-
-            auto stream = url.createInputStream(requestOptions);
-            if (stream != nullptr && statusCode < 400)
+            const juce::var responseVar = juce::JSON::parse(response.body);
+            if (auto* responseObj = responseVar.getDynamicObject())
             {
-                const juce::String responseText = stream->readEntireStreamAsString();
-                const juce::var responseVar = juce::JSON::parse(responseText);
-                if (auto* responseObj = responseVar.getDynamicObject())
+                for (const auto& entry : responseObj->getProperties())
                 {
-                    for (const auto& entry : responseObj->getProperties())
-                    {
-                        const juce::String loraName = entry.name.toString().trim();
-                        if (loraName.isNotEmpty() && !fetchedLoras.contains(loraName))
-                            fetchedLoras.add(loraName);
-                    }
-
-                    fetchedLoras.sortNatural();
-                    success = true;
+                    const juce::String loraName = entry.name.toString().trim();
+                    if (loraName.isNotEmpty() && !fetchedLoras.contains(loraName))
+                        fetchedLoras.add(loraName);
                 }
+
+                fetchedLoras.sortNatural();
+                success = true;
             }
         }
-        catch (const std::exception& e)
-        {
-            DBG("[carey-lora] failed to fetch /loras: " + juce::String(e.what()));
-        }
-        catch (...)
+        else
         {
             DBG("[carey-lora] failed to fetch /loras");
         }
@@ -294,8 +267,6 @@ void Gary4juceAudioProcessorEditor::refreshCareyAvailableLoras(bool force)
             if (alive == nullptr || !alive->load(std::memory_order_acquire))
                 return;
 
-            editor->careyLoraFetchInFlight.store(false);
-
             if (editor->careyLoraFetchNonce.load() != fetchNonce)
                 return;
 
@@ -364,7 +335,7 @@ void Gary4juceAudioProcessorEditor::refreshCareyAvailableLoras(bool force)
 
             editor->syncCareyLoraUi();
         });
-    });
+    }, 15000, "Accept: application/json");
 }
 
 void Gary4juceAudioProcessorEditor::requestCareyCompleteCaption()
@@ -385,7 +356,7 @@ void Gary4juceAudioProcessorEditor::requestCareyCompleteCaption()
         : "loading carey caption...",
         1500);
 
-    juce::Thread::launch([safeThis, requestNonce, requestedLora, captionsUrl]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Metadata, captionsUrl, [safeThis, requestNonce, requestedLora, captionsUrl](const HttpClient::CancellationToken&)
     {
         if (safeThis == nullptr)
             return;
@@ -428,7 +399,7 @@ void Gary4juceAudioProcessorEditor::requestCareyCompleteCaption()
                 .withStatusCode(&statusCode)
                 .withExtraHeaders("Accept: application/json");
 
-            auto stream = url.createInputStream(requestOptions);
+            auto stream = HttpClient::openStream(url, requestOptions);
             if (stream != nullptr)
             {
                 const juce::String responseText = stream->readEntireStreamAsString();
@@ -501,7 +472,7 @@ void Gary4juceAudioProcessorEditor::requestCareyCoverCaption()
         : "loading carey cover caption...",
         1500);
 
-    juce::Thread::launch([safeThis, requestNonce, requestedLora, captionsUrl]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Metadata, captionsUrl, [safeThis, requestNonce, requestedLora, captionsUrl](const HttpClient::CancellationToken&)
     {
         if (safeThis == nullptr)
             return;
@@ -544,7 +515,7 @@ void Gary4juceAudioProcessorEditor::requestCareyCoverCaption()
                 .withStatusCode(&statusCode)
                 .withExtraHeaders("Accept: application/json");
 
-            auto stream = url.createInputStream(requestOptions);
+            auto stream = HttpClient::openStream(url, requestOptions);
             if (stream != nullptr)
             {
                 const juce::String responseText = stream->readEntireStreamAsString();
@@ -701,10 +672,11 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
     juce::Component::SafePointer<Gary4juceAudioProcessorEditor> safeThis(this);
     const auto generationToken = beginGenerationAsyncWork();
 
-    juce::Thread::launch([safeThis, generationToken, requestNonce, bufferFile, caption, lyrics, keyScale, timeSig, language, trackName, bpm, inferenceSteps, guidanceScale, selectedLora, loraScale, requestSeed, loopAssistEnabled, trimToInputEnabled, submitUrlText, statusUrlPrefix, allowTextProgressFallback]()
+    audioProcessor.getHttpClient().submitLongRunning(submitUrlText, [safeThis, generationToken, requestNonce, bufferFile, caption, lyrics, keyScale, timeSig, language, trackName, bpm, inferenceSteps, guidanceScale, selectedLora, loraScale, requestSeed, loopAssistEnabled, trimToInputEnabled, submitUrlText, statusUrlPrefix, allowTextProgressFallback](const HttpClient::CancellationToken& cancellation)
     {
-        auto isRequestCurrent = [safeThis, generationToken, requestNonce]() {
-            return safeThis != nullptr
+        auto isRequestCurrent = [safeThis, generationToken, requestNonce, &cancellation]() {
+            return !cancellation.isCancelled()
+                && safeThis != nullptr
                 && safeThis->isGenerationAsyncWorkCurrent(generationToken)
                 && safeThis->careyRequestNonce.load() == requestNonce;
         };
@@ -717,7 +689,7 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
 
         juce::String failureReason;
         juce::String failureDetail;
-        juce::String downloadedBase64;
+        JsonAudioStream::DecodedFile downloadedAudio;
         juce::String usedSeed;
         bool success = false;
         double originalInputDurationSeconds = 0.0;
@@ -804,10 +776,11 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
                     }
                 }
 
-                juce::MemoryBlock sourceAudioData;
+                AudioUpload::Source sourceAudio;
                 if (conditioningBuffer == &sourceBuffer)
                 {
-                    if (!bufferFile.loadFileAsData(sourceAudioData) || sourceAudioData.getSize() <= 0)
+                    sourceAudio = AudioUpload::snapshot(bufferFile);
+                    if (sourceAudio == nullptr)
                     {
                         failureReason = "failed to load myBuffer.wav bytes for carey request";
                         break;
@@ -815,8 +788,8 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
                 }
                 else
                 {
-                    const juce::File tempWav = juce::File::getSpecialLocation(juce::File::tempDirectory)
-                        .getNonexistentChildFile("carey-loop-assist-", ".wav", false);
+                    auto loopAssistAudio = std::make_shared<juce::TemporaryFile>(".wav");
+                    const juce::File tempWav = loopAssistAudio->getFile();
 
                     {
                         std::unique_ptr<juce::FileOutputStream> stream(tempWav.createOutputStream());
@@ -852,21 +825,7 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
                         }
                     }
 
-                    if (!tempWav.loadFileAsData(sourceAudioData) || sourceAudioData.getSize() <= 0)
-                    {
-                        tempWav.deleteFile();
-                        failureReason = "failed to read loop-assist conditioning bytes";
-                        break;
-                    }
-
-                    tempWav.deleteFile();
-                }
-
-                const juce::String sourceAudioBase64 = juce::Base64::toBase64(sourceAudioData.getData(), sourceAudioData.getSize());
-                if (sourceAudioBase64.isEmpty())
-                {
-                    failureReason = "failed to base64 encode carey conditioning audio";
-                    break;
+                    sourceAudio = loopAssistAudio;
                 }
 
                 if (!isRequestCurrent())
@@ -875,7 +834,6 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
                 juce::URL submitUrl(submitUrlText);
 
                 juce::DynamicObject::Ptr submitPayload = new juce::DynamicObject();
-                submitPayload->setProperty("audio_data", sourceAudioBase64);
                 submitPayload->setProperty("track_name", trackName);
                 submitPayload->setProperty("bpm", bpm);
                 submitPayload->setProperty("inference_steps", inferenceSteps);
@@ -897,9 +855,6 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
                 submitPayload->setProperty("batch_size", 1);
                 submitPayload->setProperty("audio_format", "wav");
 
-                const juce::String submitJson = juce::JSON::toString(juce::var(submitPayload.get()));
-                juce::URL submitPost = submitUrl.withPOSTData(submitJson);
-
                 int submitStatusCode = 0;
                 auto submitOptions = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                     .withHttpRequestCmd("POST")
@@ -907,7 +862,7 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
                     .withStatusCode(&submitStatusCode)
                     .withExtraHeaders("Content-Type: application/json\r\nAccept: application/json");
 
-                auto submitStream = submitPost.createInputStream(submitOptions);
+                auto submitStream = AudioUpload::post(submitUrl, *submitPayload, "audio_data", sourceAudio, submitOptions);
                 if (submitStream == nullptr || submitStatusCode >= 400)
                 {
                     failureReason = "carey /lego submit failed";
@@ -946,27 +901,27 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
                 constexpr int kMaxPollCount = 600;
                 int lastResolvedProgress = 0;
 
-                for (int pollCount = 0; pollCount < kMaxPollCount; ++pollCount)
+                // Pushed statuses when the backend streams them, polls otherwise
+                StatusFeed statusFeed(queryUrl, PollScheduler::Intervals { 250, kPollIntervalMs, 5000 }, 15000, { "audio_data" });
+                const auto pollDeadlineMs = juce::Time::getMillisecondCounter() + (juce::uint32)(kPollIntervalMs * kMaxPollCount);
+
+                while (juce::Time::getMillisecondCounter() < pollDeadlineMs)
                 {
                     if (!isRequestCurrent())
                         return;
 
-                    int queryStatusCode = 0;
-                    auto queryOptions = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-                        .withHttpRequestCmd("GET")
-                        .withConnectionTimeoutMs(15000)
-                        .withStatusCode(&queryStatusCode)
-                        .withExtraHeaders("Accept: application/json");
+                    ProgressStream::Event queryResponse;
+                    const auto feedResult = statusFeed.next(queryResponse);
+                    if (feedResult == StatusFeed::Result::waiting)
+                        continue;
 
-                    auto queryStream = queryUrl.createInputStream(queryOptions);
-                    if (queryStream == nullptr || queryStatusCode >= 400)
+                    if (feedResult == StatusFeed::Result::failed)
                     {
                         failureReason = "carey status polling failed";
                         break;
                     }
 
-                    const juce::String queryResponse = queryStream->readEntireStreamAsString();
-                    const juce::var queryVar = juce::JSON::parse(queryResponse);
+                    const juce::var queryVar = queryResponse.status;
                     auto* queryObj = queryVar.getDynamicObject();
                     if (queryObj == nullptr)
                     {
@@ -997,9 +952,9 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
 
                     if (status == "completed")
                     {
-                        downloadedBase64 = queryObj->getProperty("audio_data").toString();
+                        downloadedAudio = queryResponse.audio;
                         usedSeed = queryObj->getProperty("seed").toString().trim();
-                        if (downloadedBase64.isEmpty())
+                        if (downloadedAudio == nullptr)
                         {
                             failureReason = "carey completed without audio_data";
                             break;
@@ -1024,6 +979,11 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
 
                     bool queued = (queueStatus == "queued");
                     if (progressPercent > 0 || queueStatus == "ready") queued = false;
+
+                    if (queued)
+                        statusFeed.noteWaiting();
+                    else
+                        statusFeed.noteProgress(progressPercent);
                     juce::String statusText = cleanCareyQueueMessageText(queueMessage);
                     if (statusText.isEmpty())
                     {
@@ -1047,8 +1007,6 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
                             safeThis->showStatusMessage("carey: " + statusText, 2500);
                         safeThis->repaint();
                     });
-
-                    juce::Thread::sleep(kPollIntervalMs);
                 }
 
                 if (!success && failureReason.isEmpty())
@@ -1064,105 +1022,84 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
             }
         } while (false);
 
-        if (success && downloadedBase64.isNotEmpty())
+        if (success && downloadedAudio != nullptr)
         {
-            juce::String finalBase64 = downloadedBase64;
+            // Decoded to disk as the status was read; trimming works on that
+            // file and the message thread only has to install it.
+            JsonAudioStream::DecodedFile finalAudio = downloadedAudio;
 
             if (trimToInputEnabled && originalInputDurationSeconds > 0.0)
             {
-                juce::MemoryOutputStream decodedOutputBytes;
-                if (!juce::Base64::convertFromBase64(decodedOutputBytes, downloadedBase64))
-                {
-                    DBG("[carey] trim-to-input skipped: failed to decode generated audio");
-                }
-                else
-                {
-                    const juce::MemoryBlock& decodedData = decodedOutputBytes.getMemoryBlock();
-                    const juce::File tempInput = juce::File::getSpecialLocation(juce::File::tempDirectory)
-                        .getNonexistentChildFile("carey-trim-input-", ".wav", false);
-                    const juce::File tempOutput = juce::File::getSpecialLocation(juce::File::tempDirectory)
-                        .getNonexistentChildFile("carey-trim-output-", ".wav", false);
+                auto trimmedAudio = std::make_shared<juce::TemporaryFile>(".wav");
+                const juce::File tempOutput = trimmedAudio->getFile();
 
-                    const auto cleanupTemps = [&tempInput, &tempOutput]()
-                    {
-                        tempInput.deleteFile();
-                        tempOutput.deleteFile();
-                    };
-
-                    do
+                do
+                {
+                    juce::AudioFormatManager trimFormatManager;
+                    trimFormatManager.registerBasicFormats();
+                    std::unique_ptr<juce::AudioFormatReader> trimReader(trimFormatManager.createReaderFor(finalAudio->getFile()));
+                    if (trimReader == nullptr || trimReader->sampleRate <= 0.0 || trimReader->lengthInSamples <= 0)
                     {
-                        if (!tempInput.replaceWithData(decodedData.getData(), decodedData.getSize()))
-                        {
-                            DBG("[carey] trim-to-input skipped: failed to stage generated wav");
-                            break;
-                        }
-
-                        juce::AudioFormatManager trimFormatManager;
-                        trimFormatManager.registerBasicFormats();
-                        std::unique_ptr<juce::AudioFormatReader> trimReader(trimFormatManager.createReaderFor(tempInput));
-                        if (trimReader == nullptr || trimReader->sampleRate <= 0.0 || trimReader->lengthInSamples <= 0)
-                        {
-                            DBG("[carey] trim-to-input skipped: failed to read generated wav");
-                            break;
-                        }
+                        DBG("[carey] trim-to-input skipped: failed to read generated wav");
+                        break;
+                    }
 
-                        const int generatedSamples = juce::jmax(1, (int)trimReader->lengthInSamples);
-                        const int targetSamples = juce::jlimit(1, generatedSamples,
-                            juce::roundToInt(originalInputDurationSeconds * trimReader->sampleRate));
+                    const int generatedSamples = juce::jmax(1, (int)trimReader->lengthInSamples);
+                    const int targetSamples = juce::jlimit(1, generatedSamples,
+                        juce::roundToInt(originalInputDurationSeconds * trimReader->sampleRate));
 
-                        if (targetSamples >= generatedSamples) break;
+                    if (targetSamples >= generatedSamples) break;
 
-                        const int trimChannels = juce::jmax(1, (int)trimReader->numChannels);
-                        juce::AudioBuffer<float> trimmedBuffer(trimChannels, targetSamples);
-                        if (!trimReader->read(&trimmedBuffer, 0, targetSamples, 0, true, true))
-                        {
-                            DBG("[carey] trim-to-input skipped: failed to decode generated samples for trimming");
-                            break;
-                        }
+                    const int trimChannels = juce::jmax(1, (int)trimReader->numChannels);
+                    juce::AudioBuffer<float> trimmedBuffer(trimChannels, targetSamples);
+                    if (!trimReader->read(&trimmedBuffer, 0, targetSamples, 0, true, true))
+                    {
+                        DBG("[carey] trim-to-input skipped: failed to decode generated samples for trimming");
+                        break;
+                    }
 
-                        std::unique_ptr<juce::FileOutputStream> trimStream(tempOutput.createOutputStream());
-                        if (trimStream == nullptr)
-                        {
-                            DBG("[carey] trim-to-input skipped: failed to create output wav");
-                            break;
-                        }
+                    std::unique_ptr<juce::FileOutputStream> trimStream(tempOutput.createOutputStream());
+                    if (trimStream == nullptr)
+                    {
+                        DBG("[carey] trim-to-input skipped: failed to create output wav");
+                        break;
+                    }
 
-                        juce::WavAudioFormat trimWavFormat;
-                        std::unique_ptr<juce::AudioFormatWriter> trimWriter(trimWavFormat.createWriterFor(
-                            trimStream.release(), trimReader->sampleRate,
-                            (unsigned int)trimChannels, 16, {}, 0));
+                    juce::WavAudioFormat trimWavFormat;
+                    std::unique_ptr<juce::AudioFormatWriter> trimWriter(trimWavFormat.createWriterFor(
+                        trimStream.release(), trimReader->sampleRate,
+                        (unsigned int)trimChannels, 16, {}, 0));
 
-                        if (trimWriter == nullptr)
-                        {
-                            DBG("[carey] trim-to-input skipped: failed to initialize output wav writer");
-                            break;
-                        }
+                    if (trimWriter == nullptr)
+                    {
+                        DBG("[carey] trim-to-input skipped: failed to initialize output wav writer");
+                        break;
+                    }
 
-                        const bool trimWriteOk = trimWriter->writeFromAudioSampleBuffer(trimmedBuffer, 0, targetSamples);
-                        trimWriter.reset();
-                        if (!trimWriteOk)
-                        {
-                            DBG("[carey] trim-to-input skipped: failed to write trimmed wav");
-                            break;
-                        }
+                    const bool trimWriteOk = trimWriter->writeFromAudioSampleBuffer(trimmedBuffer, 0, targetSamples);
+                    trimWriter.reset();
+                    if (!trimWriteOk)
+                    {
+                        DBG("[carey] trim-to-input skipped: failed to write trimmed wav");
+                        break;
+                    }
 
-                        juce::MemoryBlock trimmedData;
-                        if (!tempOutput.loadFileAsData(trimmedData) || trimmedData.getSize() == 0)
-                        {
-                            DBG("[carey] trim-to-input skipped: failed to read trimmed wav");
-                            break;
-                        }
+                    if (tempOutput.getSize() <= 0)
+                    {
+                        DBG("[carey] trim-to-input skipped: trimmed wav is empty");
+                        break;
+                    }
 
-                        finalBase64 = juce::Base64::toBase64(trimmedData.getData(), trimmedData.getSize());
-                        DBG("[carey] trim-to-input applied: " + juce::String((double)generatedSamples / trimReader->sampleRate, 2)
-                            + "s -> " + juce::String((double)targetSamples / trimReader->sampleRate, 2) + "s");
-                    } while (false);
+                    DBG("[carey] trim-to-input applied: " + juce::String((double)generatedSamples / trimReader->sampleRate, 2)
+                        + "s -> " + juce::String((double)targetSamples / trimReader->sampleRate, 2) + "s");
 
-                    cleanupTemps();
-                }
+                    // Close the untrimmed file before it's released.
+                    trimReader.reset();
+                    finalAudio = trimmedAudio;
+                } while (false);
             }
 
-            juce::MessageManager::callAsync([safeThis, generationToken, requestNonce, finalBase64, usedSeed]()
+            juce::MessageManager::callAsync([safeThis, generationToken, requestNonce, finalAudio, usedSeed]()
             {
                 if (safeThis == nullptr
                     || !safeThis->isGenerationAsyncWorkCurrent(generationToken)
@@ -1175,7 +1112,8 @@ void Gary4juceAudioProcessorEditor::sendToCarey()
                 safeThis->setCareyWaveformState(100, false);
                 safeThis->setActiveOp(ActiveOp::None);
                 safeThis->setCareyLastSeed(usedSeed);
-                safeThis->saveGeneratedAudio(finalBase64);
+                if (finalAudio != nullptr)
+                    safeThis->saveGeneratedAudioFile(finalAudio);
                 safeThis->showStatusMessage("carey generation complete", 2500);
                 safeThis->updateAllGenerationButtonStates();
             });
@@ -1306,10 +1244,11 @@ void Gary4juceAudioProcessorEditor::sendToCareyExtract()
     juce::Component::SafePointer<Gary4juceAudioProcessorEditor> safeThis(this);
     const auto generationToken = beginGenerationAsyncWork();
 
-    juce::Thread::launch([safeThis, generationToken, requestNonce, bufferFile, trackName, bpm, inferenceSteps, guidanceScale, submitUrlText, statusUrlPrefix, allowTextProgressFallback]()
+    audioProcessor.getHttpClient().submitLongRunning(submitUrlText, [safeThis, generationToken, requestNonce, bufferFile, trackName, bpm, inferenceSteps, guidanceScale, submitUrlText, statusUrlPrefix, allowTextProgressFallback](const HttpClient::CancellationToken& cancellation)
     {
-        auto isRequestCurrent = [safeThis, generationToken, requestNonce]() {
-            return safeThis != nullptr
+        auto isRequestCurrent = [safeThis, generationToken, requestNonce, &cancellation]() {
+            return !cancellation.isCancelled()
+                && safeThis != nullptr
                 && safeThis->isGenerationAsyncWorkCurrent(generationToken)
                 && safeThis->careyRequestNonce.load() == requestNonce;
         };
@@ -1322,34 +1261,27 @@ void Gary4juceAudioProcessorEditor::sendToCareyExtract()
 
         juce::String failureReason;
         juce::String failureDetail;
-        juce::String downloadedBase64;
+        JsonAudioStream::DecodedFile downloadedAudio;
         bool success = false;
 
         do
         {
             try
             {
-                juce::MemoryBlock sourceAudioData;
-                if (!bufferFile.loadFileAsData(sourceAudioData) || sourceAudioData.getSize() <= 0)
+                AudioUpload::Source sourceAudio;
+                sourceAudio = AudioUpload::snapshot(bufferFile);
+                if (sourceAudio == nullptr)
                 {
                     failureReason = "failed to load myBuffer.wav bytes for carey extract request";
                     break;
                 }
 
-                const juce::String sourceAudioBase64 = juce::Base64::toBase64(sourceAudioData.getData(), sourceAudioData.getSize());
-                if (sourceAudioBase64.isEmpty())
-                {
-                    failureReason = "failed to base64 encode carey extract audio";
-                    break;
-                }
-
                 if (!isRequestCurrent())
                     return;
 
                 juce::URL submitUrl(submitUrlText);
 
                 juce::DynamicObject::Ptr submitPayload = new juce::DynamicObject();
-                submitPayload->setProperty("audio_data", sourceAudioBase64);
                 submitPayload->setProperty("track_name", trackName);
                 submitPayload->setProperty("bpm", bpm);
                 submitPayload->setProperty("guidance_scale", guidanceScale);
@@ -1357,9 +1289,6 @@ void Gary4juceAudioProcessorEditor::sendToCareyExtract()
                 submitPayload->setProperty("batch_size", 1);
                 submitPayload->setProperty("audio_format", "wav");
 
-                const juce::String submitJson = juce::JSON::toString(juce::var(submitPayload.get()));
-                juce::URL submitPost = submitUrl.withPOSTData(submitJson);
-
                 int submitStatusCode = 0;
                 auto submitOptions = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                     .withHttpRequestCmd("POST")
@@ -1367,7 +1296,7 @@ void Gary4juceAudioProcessorEditor::sendToCareyExtract()
                     .withStatusCode(&submitStatusCode)
                     .withExtraHeaders("Content-Type: application/json\r\nAccept: application/json");
 
-                auto submitStream = submitPost.createInputStream(submitOptions);
+                auto submitStream = AudioUpload::post(submitUrl, *submitPayload, "audio_data", sourceAudio, submitOptions);
                 if (submitStream == nullptr || submitStatusCode >= 400)
                 {
                     failureReason = "carey /extract submit failed";
@@ -1406,27 +1335,27 @@ void Gary4juceAudioProcessorEditor::sendToCareyExtract()
                 constexpr int kMaxPollCount = 600;
                 int lastResolvedProgress = 0;
 
-                for (int pollCount = 0; pollCount < kMaxPollCount; ++pollCount)
+                // Pushed statuses when the backend streams them, polls otherwise
+                StatusFeed statusFeed(queryUrl, PollScheduler::Intervals { 250, kPollIntervalMs, 5000 }, 15000, { "audio_data" });
+                const auto pollDeadlineMs = juce::Time::getMillisecondCounter() + (juce::uint32)(kPollIntervalMs * kMaxPollCount);
+
+                while (juce::Time::getMillisecondCounter() < pollDeadlineMs)
                 {
                     if (!isRequestCurrent())
                         return;
 
-                    int queryStatusCode = 0;
-                    auto queryOptions = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-                        .withHttpRequestCmd("GET")
-                        .withConnectionTimeoutMs(15000)
-                        .withStatusCode(&queryStatusCode)
-                        .withExtraHeaders("Accept: application/json");
+                    ProgressStream::Event queryResponse;
+                    const auto feedResult = statusFeed.next(queryResponse);
+                    if (feedResult == StatusFeed::Result::waiting)
+                        continue;
 
-                    auto queryStream = queryUrl.createInputStream(queryOptions);
-                    if (queryStream == nullptr || queryStatusCode >= 400)
+                    if (feedResult == StatusFeed::Result::failed)
                     {
                         failureReason = "carey extract status polling failed";
                         break;
                     }
 
-                    const juce::String queryResponse = queryStream->readEntireStreamAsString();
-                    const juce::var queryVar = juce::JSON::parse(queryResponse);
+                    const juce::var queryVar = queryResponse.status;
                     auto* queryObj = queryVar.getDynamicObject();
                     if (queryObj == nullptr)
                     {
@@ -1457,8 +1386,8 @@ void Gary4juceAudioProcessorEditor::sendToCareyExtract()
 
                     if (status == "completed")
                     {
-                        downloadedBase64 = queryObj->getProperty("audio_data").toString();
-                        if (downloadedBase64.isEmpty())
+                        downloadedAudio = queryResponse.audio;
+                        if (downloadedAudio == nullptr)
                         {
                             failureReason = "carey extract completed without audio_data";
                             break;
@@ -1490,6 +1419,11 @@ void Gary4juceAudioProcessorEditor::sendToCareyExtract()
 
                     bool queued = (queueStatus == "queued");
                     if (progressPercent > 0 || queueStatus == "ready") queued = false;
+
+                    if (queued)
+                        statusFeed.noteWaiting();
+                    else
+                        statusFeed.noteProgress(progressPercent);
                     juce::String statusText = cleanCareyQueueMessageText(queueMessage);
                     if (statusText.isEmpty())
                     {
@@ -1513,8 +1447,6 @@ void Gary4juceAudioProcessorEditor::sendToCareyExtract()
                             safeThis->showStatusMessage("carey extract: " + statusText, 2500);
                         safeThis->repaint();
                     });
-
-                    juce::Thread::sleep(kPollIntervalMs);
                 }
 
                 if (!success && failureReason.isEmpty())
@@ -1530,9 +1462,9 @@ void Gary4juceAudioProcessorEditor::sendToCareyExtract()
             }
         } while (false);
 
-        if (success && downloadedBase64.isNotEmpty())
+        if (success && downloadedAudio != nullptr)
         {
-            juce::MessageManager::callAsync([safeThis, generationToken, requestNonce, downloadedBase64]()
+            juce::MessageManager::callAsync([safeThis, generationToken, requestNonce, downloadedAudio]()
             {
                 if (safeThis == nullptr
                     || !safeThis->isGenerationAsyncWorkCurrent(generationToken)
@@ -1544,7 +1476,7 @@ void Gary4juceAudioProcessorEditor::sendToCareyExtract()
                 safeThis->smoothProgressAnimation = false;
                 safeThis->setCareyWaveformState(100, false);
                 safeThis->setActiveOp(ActiveOp::None);
-                safeThis->saveGeneratedAudio(downloadedBase64);
+                safeThis->saveGeneratedAudioFile(downloadedAudio);
                 safeThis->showStatusMessage("carey extract complete", 2500);
                 safeThis->updateAllGenerationButtonStates();
             });
@@ -1697,10 +1629,11 @@ void Gary4juceAudioProcessorEditor::sendToCareyComplete()
     juce::Component::SafePointer<Gary4juceAudioProcessorEditor> safeThis(this);
     const auto generationToken = beginGenerationAsyncWork();
 
-    juce::Thread::launch([safeThis, generationToken, requestNonce, bufferFile, caption, lyrics, keyScale, timeSig, language, bpm, inferenceSteps, guidanceScale, targetDurationSeconds, selectedLora, loraScale, useSrcAsRef, requestSeed, submitCompleteModel, submitUrlText, statusUrlPrefix, allowTextProgressFallback]()
+    audioProcessor.getHttpClient().submitLongRunning(submitUrlText, [safeThis, generationToken, requestNonce, bufferFile, caption, lyrics, keyScale, timeSig, language, bpm, inferenceSteps, guidanceScale, targetDurationSeconds, selectedLora, loraScale, useSrcAsRef, requestSeed, submitCompleteModel, submitUrlText, statusUrlPrefix, allowTextProgressFallback](const HttpClient::CancellationToken& cancellation)
     {
-        auto isRequestCurrent = [safeThis, generationToken, requestNonce]() {
-            return safeThis != nullptr
+        auto isRequestCurrent = [safeThis, generationToken, requestNonce, &cancellation]() {
+            return !cancellation.isCancelled()
+                && safeThis != nullptr
                 && safeThis->isGenerationAsyncWorkCurrent(generationToken)
                 && safeThis->careyRequestNonce.load() == requestNonce;
         };
@@ -1713,7 +1646,7 @@ void Gary4juceAudioProcessorEditor::sendToCareyComplete()
 
         juce::String failureReason;
         juce::String failureDetail;
-        juce::String downloadedBase64;
+        JsonAudioStream::DecodedFile downloadedAudio;
         juce::String usedSeed;
         bool success = false;
 
@@ -1721,27 +1654,20 @@ void Gary4juceAudioProcessorEditor::sendToCareyComplete()
         {
             try
             {
-                juce::MemoryBlock sourceAudioData;
-                if (!bufferFile.loadFileAsData(sourceAudioData) || sourceAudioData.getSize() <= 0)
+                AudioUpload::Source sourceAudio;
+                sourceAudio = AudioUpload::snapshot(bufferFile);
+                if (sourceAudio == nullptr)
                 {
                     failureReason = "failed to load myBuffer.wav bytes for carey complete request";
                     break;
                 }
 
-                const juce::String sourceAudioBase64 = juce::Base64::toBase64(sourceAudioData.getData(), sourceAudioData.getSize());
-                if (sourceAudioBase64.isEmpty())
-                {
-                    failureReason = "failed to base64 encode carey complete conditioning audio";
-                    break;
-                }
-
                 if (!isRequestCurrent())
                     return;
 
                 juce::URL submitUrl(submitUrlText);
 
                 juce::DynamicObject::Ptr submitPayload = new juce::DynamicObject();
-                submitPayload->setProperty("audio_data", sourceAudioBase64);
                 submitPayload->setProperty("bpm", bpm);
                 submitPayload->setProperty("inference_steps", inferenceSteps);
                 submitPayload->setProperty("model", submitCompleteModel);
@@ -1765,9 +1691,6 @@ void Gary4juceAudioProcessorEditor::sendToCareyComplete()
                 submitPayload->setProperty("batch_size", 1);
                 submitPayload->setProperty("audio_format", "wav");
 
-                const juce::String submitJson = juce::JSON::toString(juce::var(submitPayload.get()));
-                juce::URL submitPost = submitUrl.withPOSTData(submitJson);
-
                 int submitStatusCode = 0;
                 auto submitOptions = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                     .withHttpRequestCmd("POST")
@@ -1775,7 +1698,7 @@ void Gary4juceAudioProcessorEditor::sendToCareyComplete()
                     .withStatusCode(&submitStatusCode)
                     .withExtraHeaders("Content-Type: application/json\r\nAccept: application/json");
 
-                auto submitStream = submitPost.createInputStream(submitOptions);
+                auto submitStream = AudioUpload::post(submitUrl, *submitPayload, "audio_data", sourceAudio, submitOptions);
                 if (submitStream == nullptr || submitStatusCode >= 400)
                 {
                     failureReason = "carey /complete submit failed";
@@ -1814,27 +1737,27 @@ void Gary4juceAudioProcessorEditor::sendToCareyComplete()
                 constexpr int kMaxPollCount = 600;
                 int lastResolvedProgress = 0;
 
-                for (int pollCount = 0; pollCount < kMaxPollCount; ++pollCount)
+                // Pushed statuses when the backend streams them, polls otherwise
+                StatusFeed statusFeed(queryUrl, PollScheduler::Intervals { 250, kPollIntervalMs, 5000 }, 15000, { "audio_data" });
+                const auto pollDeadlineMs = juce::Time::getMillisecondCounter() + (juce::uint32)(kPollIntervalMs * kMaxPollCount);
+
+                while (juce::Time::getMillisecondCounter() < pollDeadlineMs)
                 {
                     if (!isRequestCurrent())
                         return;
 
-                    int queryStatusCode = 0;
-                    auto queryOptions = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-                        .withHttpRequestCmd("GET")
-                        .withConnectionTimeoutMs(15000)
-                        .withStatusCode(&queryStatusCode)
-                        .withExtraHeaders("Accept: application/json");
+                    ProgressStream::Event queryResponse;
+                    const auto feedResult = statusFeed.next(queryResponse);
+                    if (feedResult == StatusFeed::Result::waiting)
+                        continue;
 
-                    auto queryStream = queryUrl.createInputStream(queryOptions);
-                    if (queryStream == nullptr || queryStatusCode >= 400)
+                    if (feedResult == StatusFeed::Result::failed)
                     {
                         failureReason = "carey complete status polling failed";
                         break;
                     }
 
-                    const juce::String queryResponse = queryStream->readEntireStreamAsString();
-                    const juce::var queryVar = juce::JSON::parse(queryResponse);
+                    const juce::var queryVar = queryResponse.status;
                     auto* queryObj = queryVar.getDynamicObject();
                     if (queryObj == nullptr)
                     {
@@ -1865,9 +1788,9 @@ void Gary4juceAudioProcessorEditor::sendToCareyComplete()
 
                     if (status == "completed")
                     {
-                        downloadedBase64 = queryObj->getProperty("audio_data").toString();
+                        downloadedAudio = queryResponse.audio;
                         usedSeed = queryObj->getProperty("seed").toString().trim();
-                        if (downloadedBase64.isEmpty())
+                        if (downloadedAudio == nullptr)
                         {
                             failureReason = "carey complete finished without audio_data";
                             break;
@@ -1893,6 +1816,11 @@ void Gary4juceAudioProcessorEditor::sendToCareyComplete()
                     bool queued = (queueStatus == "queued");
                     if (progressPercent > 0 || queueStatus == "ready") queued = false;
 
+                    if (queued)
+                        statusFeed.noteWaiting();
+                    else
+                        statusFeed.noteProgress(progressPercent);
+
                     juce::String statusText = cleanCareyQueueMessageText(queueMessage);
                     if (statusText.isEmpty())
                     {
@@ -1916,8 +1844,6 @@ void Gary4juceAudioProcessorEditor::sendToCareyComplete()
                             safeThis->showStatusMessage("carey complete: " + statusText, 2500);
                         safeThis->repaint();
                     });
-
-                    juce::Thread::sleep(kPollIntervalMs);
                 }
 
                 if (!success && failureReason.isEmpty())
@@ -1933,9 +1859,9 @@ void Gary4juceAudioProcessorEditor::sendToCareyComplete()
             }
         } while (false);
 
-        if (success && downloadedBase64.isNotEmpty())
+        if (success && downloadedAudio != nullptr)
         {
-            juce::MessageManager::callAsync([safeThis, generationToken, requestNonce, downloadedBase64, usedSeed]()
+            juce::MessageManager::callAsync([safeThis, generationToken, requestNonce, downloadedAudio, usedSeed]()
             {
                 if (safeThis == nullptr
                     || !safeThis->isGenerationAsyncWorkCurrent(generationToken)
@@ -1948,7 +1874,7 @@ void Gary4juceAudioProcessorEditor::sendToCareyComplete()
                 safeThis->setCareyWaveformState(100, false);
                 safeThis->setActiveOp(ActiveOp::None);
                 safeThis->setCareyLastSeed(usedSeed);
-                safeThis->saveGeneratedAudio(downloadedBase64);
+                safeThis->saveGeneratedAudioFile(downloadedAudio);
                 safeThis->showStatusMessage("carey continuation complete", 2500);
                 safeThis->updateAllGenerationButtonStates();
             });
@@ -2104,12 +2030,13 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
     juce::Component::SafePointer<Gary4juceAudioProcessorEditor> safeThis(this);
     const auto generationToken = beginGenerationAsyncWork();
 
-    juce::Thread::launch([safeThis, generationToken, requestNonce, bufferFile, caption, lyrics, keyScale, timeSig, language, bpm, coverNoiseStrength,
+    audioProcessor.getHttpClient().submitLongRunning(submitUrlText, [safeThis, generationToken, requestNonce, bufferFile, caption, lyrics, keyScale, timeSig, language, bpm, coverNoiseStrength,
                           audioCoverStrength, guidanceScale, inferenceSteps, selectedLora, loraScale, submitCoverModel, useSrcAsRef,
-                          requestSeed, loopAssistEnabled, trimToInputEnabled, submitUrlText, statusUrlPrefix, allowTextProgressFallback]()
+                          requestSeed, loopAssistEnabled, trimToInputEnabled, submitUrlText, statusUrlPrefix, allowTextProgressFallback](const HttpClient::CancellationToken& cancellation)
     {
-        auto isRequestCurrent = [safeThis, generationToken, requestNonce]() {
-            return safeThis != nullptr
+        auto isRequestCurrent = [safeThis, generationToken, requestNonce, &cancellation]() {
+            return !cancellation.isCancelled()
+                && safeThis != nullptr
                 && safeThis->isGenerationAsyncWorkCurrent(generationToken)
                 && safeThis->careyRequestNonce.load() == requestNonce;
         };
@@ -2122,7 +2049,7 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
 
         juce::String failureReason;
         juce::String failureDetail;
-        juce::String downloadedBase64;
+        JsonAudioStream::DecodedFile downloadedAudio;
         juce::String usedSeed;
         bool success = false;
         double originalInputDurationSeconds = 0.0;
@@ -2209,10 +2136,11 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
                     }
                 }
 
-                juce::MemoryBlock sourceAudioData;
+                AudioUpload::Source sourceAudio;
                 if (conditioningBuffer == &sourceBuffer)
                 {
-                    if (!bufferFile.loadFileAsData(sourceAudioData) || sourceAudioData.getSize() <= 0)
+                    sourceAudio = AudioUpload::snapshot(bufferFile);
+                    if (sourceAudio == nullptr)
                     {
                         failureReason = "failed to load myBuffer.wav bytes for carey cover request";
                         break;
@@ -2220,8 +2148,8 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
                 }
                 else
                 {
-                    const juce::File tempWav = juce::File::getSpecialLocation(juce::File::tempDirectory)
-                        .getNonexistentChildFile("carey-cover-loop-assist-", ".wav", false);
+                    auto loopAssistAudio = std::make_shared<juce::TemporaryFile>(".wav");
+                    const juce::File tempWav = loopAssistAudio->getFile();
 
                     {
                         std::unique_ptr<juce::FileOutputStream> stream(tempWav.createOutputStream());
@@ -2257,21 +2185,7 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
                         }
                     }
 
-                    if (!tempWav.loadFileAsData(sourceAudioData) || sourceAudioData.getSize() <= 0)
-                    {
-                        tempWav.deleteFile();
-                        failureReason = "failed to read cover loop-assist conditioning bytes";
-                        break;
-                    }
-
-                    tempWav.deleteFile();
-                }
-
-                const juce::String sourceAudioBase64 = juce::Base64::toBase64(sourceAudioData.getData(), sourceAudioData.getSize());
-                if (sourceAudioBase64.isEmpty())
-                {
-                    failureReason = "failed to base64 encode carey cover conditioning audio";
-                    break;
+                    sourceAudio = loopAssistAudio;
                 }
 
                 if (!isRequestCurrent())
@@ -2280,7 +2194,6 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
                 juce::URL submitUrl(submitUrlText);
 
                 juce::DynamicObject::Ptr submitPayload = new juce::DynamicObject();
-                submitPayload->setProperty("audio_data", sourceAudioBase64);
                 submitPayload->setProperty("bpm", bpm);
                 submitPayload->setProperty("caption", caption);
                 submitPayload->setProperty("lyrics", lyrics);
@@ -2306,9 +2219,6 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
                 submitPayload->setProperty("batch_size", 1);
                 submitPayload->setProperty("audio_format", "wav");
 
-                const juce::String submitJson = juce::JSON::toString(juce::var(submitPayload.get()));
-                juce::URL submitPost = submitUrl.withPOSTData(submitJson);
-
                 int submitStatusCode = 0;
                 auto submitOptions = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                     .withHttpRequestCmd("POST")
@@ -2316,7 +2226,7 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
                     .withStatusCode(&submitStatusCode)
                     .withExtraHeaders("Content-Type: application/json\r\nAccept: application/json");
 
-                auto submitStream = submitPost.createInputStream(submitOptions);
+                auto submitStream = AudioUpload::post(submitUrl, *submitPayload, "audio_data", sourceAudio, submitOptions);
                 if (submitStream == nullptr || submitStatusCode >= 400)
                 {
                     failureReason = "carey /cover submit failed";
@@ -2356,28 +2266,28 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
                 constexpr int kMaxPollCount = 600;
                 int lastResolvedProgress = 0;
 
-                for (int pollCount = 0; pollCount < kMaxPollCount; ++pollCount)
+                // Pushed statuses when the backend streams them, polls otherwise
+                StatusFeed statusFeed(queryUrl, PollScheduler::Intervals { 250, kPollIntervalMs, 5000 }, 15000, { "audio_data" });
+                const auto pollDeadlineMs = juce::Time::getMillisecondCounter() + (juce::uint32)(kPollIntervalMs * kMaxPollCount);
+
+                while (juce::Time::getMillisecondCounter() < pollDeadlineMs)
                 {
                     if (!isRequestCurrent())
                         return;
 
-                    int queryStatusCode = 0;
-                    auto queryOptions = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-                        .withHttpRequestCmd("GET")
-                        .withConnectionTimeoutMs(15000)
-                        .withStatusCode(&queryStatusCode)
-                        .withExtraHeaders("Accept: application/json");
+                    ProgressStream::Event queryResponse;
+                    const auto feedResult = statusFeed.next(queryResponse);
+                    if (feedResult == StatusFeed::Result::waiting)
+                        continue;
 
-                    auto queryStream = queryUrl.createInputStream(queryOptions);
-                    if (queryStream == nullptr || queryStatusCode >= 400)
+                    if (feedResult == StatusFeed::Result::failed)
                     {
                         failureReason = "carey cover status polling failed";
                         break;
                     }
 
-                    const juce::String queryResponse = queryStream->readEntireStreamAsString();
                     DBG("[carey-cover] RAW RESPONSE: " + queryResponse.substring(0, 500));
-                    const juce::var queryVar = juce::JSON::parse(queryResponse);
+                    const juce::var queryVar = queryResponse.status;
                     auto* queryObj = queryVar.getDynamicObject();
                     if (queryObj == nullptr)
                     {
@@ -2408,9 +2318,9 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
 
                     if (status == "completed")
                     {
-                        downloadedBase64 = queryObj->getProperty("audio_data").toString();
+                        downloadedAudio = queryResponse.audio;
                         usedSeed = queryObj->getProperty("seed").toString().trim();
-                        if (downloadedBase64.isEmpty())
+                        if (downloadedAudio == nullptr)
                         {
                             failureReason = "carey cover finished without audio_data";
                             break;
@@ -2451,6 +2361,11 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
                     bool queued = (queueStatus == "queued");
                     if (progressPercent > 0 || queueStatus == "ready") queued = false;
 
+                    if (queued)
+                        statusFeed.noteWaiting();
+                    else
+                        statusFeed.noteProgress(progressPercent);
+
                     juce::String statusText = cleanCareyQueueMessageText(queueMessage);
                     if (statusText.isEmpty())
                     {
@@ -2474,8 +2389,6 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
                             safeThis->showStatusMessage("carey cover: " + statusText, 2500);
                         safeThis->repaint();
                     });
-
-                    juce::Thread::sleep(kPollIntervalMs);
                 }
 
                 if (!success && failureReason.isEmpty())
@@ -2491,105 +2404,84 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
             }
         } while (false);
 
-        if (success && downloadedBase64.isNotEmpty())
+        if (success && downloadedAudio != nullptr)
         {
-            juce::String finalBase64 = downloadedBase64;
+            // Decoded to disk as the status was read; trimming works on that
+            // file and the message thread only has to install it.
+            JsonAudioStream::DecodedFile finalAudio = downloadedAudio;
 
             if (trimToInputEnabled && originalInputDurationSeconds > 0.0)
             {
-                juce::MemoryOutputStream decodedOutputBytes;
-                if (!juce::Base64::convertFromBase64(decodedOutputBytes, downloadedBase64))
-                {
-                    DBG("[carey-cover] trim-to-input skipped: failed to decode generated audio");
-                }
-                else
-                {
-                    const juce::MemoryBlock& decodedData = decodedOutputBytes.getMemoryBlock();
-                    const juce::File tempInput = juce::File::getSpecialLocation(juce::File::tempDirectory)
-                        .getNonexistentChildFile("carey-cover-trim-input-", ".wav", false);
-                    const juce::File tempOutput = juce::File::getSpecialLocation(juce::File::tempDirectory)
-                        .getNonexistentChildFile("carey-cover-trim-output-", ".wav", false);
+                auto trimmedAudio = std::make_shared<juce::TemporaryFile>(".wav");
+                const juce::File tempOutput = trimmedAudio->getFile();
 
-                    const auto cleanupTemps = [&tempInput, &tempOutput]()
-                    {
-                        tempInput.deleteFile();
-                        tempOutput.deleteFile();
-                    };
-
-                    do
+                do
+                {
+                    juce::AudioFormatManager trimFormatManager;
+                    trimFormatManager.registerBasicFormats();
+                    std::unique_ptr<juce::AudioFormatReader> trimReader(trimFormatManager.createReaderFor(finalAudio->getFile()));
+                    if (trimReader == nullptr || trimReader->sampleRate <= 0.0 || trimReader->lengthInSamples <= 0)
                     {
-                        if (!tempInput.replaceWithData(decodedData.getData(), decodedData.getSize()))
-                        {
-                            DBG("[carey-cover] trim-to-input skipped: failed to stage generated wav");
-                            break;
-                        }
-
-                        juce::AudioFormatManager trimFormatManager;
-                        trimFormatManager.registerBasicFormats();
-                        std::unique_ptr<juce::AudioFormatReader> trimReader(trimFormatManager.createReaderFor(tempInput));
-                        if (trimReader == nullptr || trimReader->sampleRate <= 0.0 || trimReader->lengthInSamples <= 0)
-                        {
-                            DBG("[carey-cover] trim-to-input skipped: failed to read generated wav");
-                            break;
-                        }
+                        DBG("[carey-cover] trim-to-input skipped: failed to read generated wav");
+                        break;
+                    }
 
-                        const int generatedSamples = juce::jmax(1, (int)trimReader->lengthInSamples);
-                        const int targetSamples = juce::jlimit(1, generatedSamples,
-                            juce::roundToInt(originalInputDurationSeconds * trimReader->sampleRate));
+                    const int generatedSamples = juce::jmax(1, (int)trimReader->lengthInSamples);
+                    const int targetSamples = juce::jlimit(1, generatedSamples,
+                        juce::roundToInt(originalInputDurationSeconds * trimReader->sampleRate));
 
-                        if (targetSamples >= generatedSamples) break;
+                    if (targetSamples >= generatedSamples) break;
 
-                        const int trimChannels = juce::jmax(1, (int)trimReader->numChannels);
-                        juce::AudioBuffer<float> trimmedBuffer(trimChannels, targetSamples);
-                        if (!trimReader->read(&trimmedBuffer, 0, targetSamples, 0, true, true))
-                        {
-                            DBG("[carey-cover] trim-to-input skipped: failed to decode generated samples for trimming");
-                            break;
-                        }
+                    const int trimChannels = juce::jmax(1, (int)trimReader->numChannels);
+                    juce::AudioBuffer<float> trimmedBuffer(trimChannels, targetSamples);
+                    if (!trimReader->read(&trimmedBuffer, 0, targetSamples, 0, true, true))
+                    {
+                        DBG("[carey-cover] trim-to-input skipped: failed to decode generated samples for trimming");
+                        break;
+                    }
 
-                        std::unique_ptr<juce::FileOutputStream> trimStream(tempOutput.createOutputStream());
-                        if (trimStream == nullptr)
-                        {
-                            DBG("[carey-cover] trim-to-input skipped: failed to create output wav");
-                            break;
-                        }
+                    std::unique_ptr<juce::FileOutputStream> trimStream(tempOutput.createOutputStream());
+                    if (trimStream == nullptr)
+                    {
+                        DBG("[carey-cover] trim-to-input skipped: failed to create output wav");
+                        break;
+                    }
 
-                        juce::WavAudioFormat trimWavFormat;
-                        std::unique_ptr<juce::AudioFormatWriter> trimWriter(trimWavFormat.createWriterFor(
-                            trimStream.release(), trimReader->sampleRate,
-                            (unsigned int)trimChannels, 16, {}, 0));
+                    juce::WavAudioFormat trimWavFormat;
+                    std::unique_ptr<juce::AudioFormatWriter> trimWriter(trimWavFormat.createWriterFor(
+                        trimStream.release(), trimReader->sampleRate,
+                        (unsigned int)trimChannels, 16, {}, 0));
 
-                        if (trimWriter == nullptr)
-                        {
-                            DBG("[carey-cover] trim-to-input skipped: failed to initialize output wav writer");
-                            break;
-                        }
+                    if (trimWriter == nullptr)
+                    {
+                        DBG("[carey-cover] trim-to-input skipped: failed to initialize output wav writer");
+                        break;
+                    }
 
-                        const bool trimWriteOk = trimWriter->writeFromAudioSampleBuffer(trimmedBuffer, 0, targetSamples);
-                        trimWriter.reset();
-                        if (!trimWriteOk)
-                        {
-                            DBG("[carey-cover] trim-to-input skipped: failed to write trimmed wav");
-                            break;
-                        }
+                    const bool trimWriteOk = trimWriter->writeFromAudioSampleBuffer(trimmedBuffer, 0, targetSamples);
+                    trimWriter.reset();
+                    if (!trimWriteOk)
+                    {
+                        DBG("[carey-cover] trim-to-input skipped: failed to write trimmed wav");
+                        break;
+                    }
 
-                        juce::MemoryBlock trimmedData;
-                        if (!tempOutput.loadFileAsData(trimmedData) || trimmedData.getSize() == 0)
-                        {
-                            DBG("[carey-cover] trim-to-input skipped: failed to read trimmed wav");
-                            break;
-                        }
+                    if (tempOutput.getSize() <= 0)
+                    {
+                        DBG("[carey-cover] trim-to-input skipped: trimmed wav is empty");
+                        break;
+                    }
 
-                        finalBase64 = juce::Base64::toBase64(trimmedData.getData(), trimmedData.getSize());
-                        DBG("[carey-cover] trim-to-input applied: " + juce::String((double)generatedSamples / trimReader->sampleRate, 2)
-                            + "s -> " + juce::String((double)targetSamples / trimReader->sampleRate, 2) + "s");
-                    } while (false);
+                    DBG("[carey-cover] trim-to-input applied: " + juce::String((double)generatedSamples / trimReader->sampleRate, 2)
+                        + "s -> " + juce::String((double)targetSamples / trimReader->sampleRate, 2) + "s");
 
-                    cleanupTemps();
-                }
+                    // Close the untrimmed file before it's released.
+                    trimReader.reset();
+                    finalAudio = trimmedAudio;
+                } while (false);
             }
 
-            juce::MessageManager::callAsync([safeThis, generationToken, requestNonce, finalBase64, usedSeed]()
+            juce::MessageManager::callAsync([safeThis, generationToken, requestNonce, finalAudio, usedSeed]()
             {
                 if (safeThis == nullptr
                     || !safeThis->isGenerationAsyncWorkCurrent(generationToken)
@@ -2602,7 +2494,8 @@ void Gary4juceAudioProcessorEditor::sendToCareyCover()
                 safeThis->setCareyWaveformState(100, false);
                 safeThis->setActiveOp(ActiveOp::None);
                 safeThis->setCareyLastSeed(usedSeed);
-                safeThis->saveGeneratedAudio(finalBase64);
+                if (finalAudio != nullptr)
+                    safeThis->saveGeneratedAudioFile(finalAudio);
                 safeThis->showStatusMessage("carey cover remix complete", 2500);
                 safeThis->updateAllGenerationButtonStates();
             });
@@ -136,9 +136,9 @@ void Gary4juceAudioProcessorEditor::sendToFoundation()
     jsonRequest->setProperty("guidance_scale", foundationUI->getGuidance());
     jsonRequest->setProperty("steps", foundationUI->getSteps());
 
-    // Audio2Audio mode — read myBuffer.wav, base64 encode, add init_noise_level
+    // Audio2Audio mode — copy myBuffer.wav aside for the upload, add init_noise_level
     const bool isAudio2Audio = foundationUI->getAudio2AudioEnabled();
-    juce::String base64Audio;
+    AudioUpload::Source uploadAudio;
 
     if (isAudio2Audio)
     {
@@ -156,36 +156,31 @@ void Gary4juceAudioProcessorEditor::sendToFoundation()
             return;
         }
 
-        juce::MemoryBlock audioData;
-        if (!bufferFile.loadFileAsData(audioData) || audioData.getSize() == 0)
+        uploadAudio = AudioUpload::snapshot(bufferFile);
+        if (uploadAudio == nullptr)
         {
             showStatusMessage("failed to read recording buffer", 4000);
             cancelOp();
             return;
         }
 
-        base64Audio = juce::Base64::toBase64(audioData.getData(), audioData.getSize());
-        jsonRequest->setProperty("audio_data", base64Audio);
         jsonRequest->setProperty("init_noise_level", foundationUI->getTransformation());
 
-        DBG("[foundation] audio2audio mode - buffer: " + juce::String(audioData.getSize())
+        DBG("[foundation] audio2audio mode - buffer: " + juce::String(bufferFile.getSize())
             + " bytes, init_noise_level: " + juce::String(foundationUI->getTransformation()));
     }
 
-    auto jsonString = juce::JSON::toString(juce::var(jsonRequest.get()));
-
     DBG("[foundation] JSON payload (" + juce::String(isAudio2Audio ? "audio2audio" : "generate")
-        + "): " + jsonString.substring(0, 300));
+        + "): " + juce::JSON::toString(juce::var(jsonRequest.get())).substring(0, 300));
 
     juce::String endpoint = isAudio2Audio ? "/audio2audio" : "/generate";
     const auto requestUrl = getServiceUrl(ServiceType::Foundation, endpoint);
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, jsonString, requestUrl]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Generation, requestUrl, [asyncAlive, editor, jsonRequest, uploadAudio, requestUrl](const HttpClient::CancellationToken&)
     {
         juce::URL url(requestUrl);
-        juce::URL postUrl = url.withPOSTData(jsonString);
 
         auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
             .withConnectionTimeoutMs(15000)
@@ -196,7 +191,9 @@ void Gary4juceAudioProcessorEditor::sendToFoundation()
 
         try
         {
-            auto stream = postUrl.createInputStream(options);
+            auto stream = uploadAudio != nullptr
+                ? AudioUpload::post(url, *jsonRequest, "audio_data", uploadAudio, options)
+                : HttpClient::openStream(url.withPOSTData(juce::JSON::toString(juce::var(jsonRequest.get()))), options);
             if (stream != nullptr)
             {
                 responseText = stream->readEntireStreamAsString();
@@ -293,7 +290,7 @@ void Gary4juceAudioProcessorEditor::randomizeFoundation()
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, postUrl]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Metadata, postUrl, [asyncAlive, editor, postUrl](const HttpClient::CancellationToken&)
     {
         juce::String responseText;
         bool ok = false;
@@ -304,7 +301,7 @@ void Gary4juceAudioProcessorEditor::randomizeFoundation()
                 .withConnectionTimeoutMs(10000)
                 .withExtraHeaders("Content-Type: application/json");
 
-            auto stream = postUrl.createInputStream(options);
+            auto stream = HttpClient::openStream(postUrl, options);
             if (stream != nullptr)
             {
                 responseText = stream->readEntireStreamAsString();
@@ -214,6 +214,14 @@ void Gary4juceAudioProcessorEditor::updateJerrySubTabStates()
     }
 }
 
+juce::String Gary4juceAudioProcessorEditor::getJerryModelsStatusUrl() const
+{
+    const juce::String endpoint = audioProcessor.getIsUsingLocalhost()
+        ? "/models/status"
+        : "/audio/models/status";
+    return getServiceUrl(ServiceType::Jerry, endpoint);
+}
+
 void Gary4juceAudioProcessorEditor::fetchJerryAvailableModels(bool force)
 {
     if (!force && !isServiceReachable(ServiceType::Jerry))
@@ -227,43 +235,35 @@ void Gary4juceAudioProcessorEditor::fetchJerryAvailableModels(bool force)
         DBG("Forcing Jerry model fetch after host preset restore");
     }
 
-    const juce::String endpoint = audioProcessor.getIsUsingLocalhost()
-        ? "/models/status"
-        : "/audio/models/status";
-    const auto modelsUrl = getServiceUrl(ServiceType::Jerry, endpoint);
+    const auto modelsUrl = getJerryModelsStatusUrl();
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, modelsUrl]()
+    audioProcessor.getMetadataCache().fetch(audioProcessor.getHttpClient(), juce::URL(modelsUrl), kJerryModelsMaxAgeMs,
+        [asyncAlive, editor](const MetadataCache::Response& response)
         {
-            juce::URL url(modelsUrl);
-
-            std::unique_ptr<juce::InputStream> stream(url.createInputStream(
-                juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-                .withConnectionTimeoutMs(10000)
-            ));
+            const auto models = parseJerryModels(response.body);
 
-            juce::String responseText;
-            if (stream != nullptr)
-                responseText = stream->readEntireStreamAsString();
-
-            juce::MessageManager::callAsync([asyncAlive, editor, responseText]()
+            juce::MessageManager::callAsync([asyncAlive, editor, models]()
                 {
                     const auto alive = asyncAlive.lock();
                     if (alive == nullptr || !alive->load(std::memory_order_acquire))
                         return;
 
-                    editor->handleJerryModelsResponse(responseText);
+                    editor->handleJerryModelsResponse(models);
                 });
         });
 }
 
-void Gary4juceAudioProcessorEditor::handleJerryModelsResponse(const juce::String& responseText)
+// Runs on the fetching thread.
+Gary4juceAudioProcessorEditor::JerryModelList Gary4juceAudioProcessorEditor::parseJerryModels(const juce::String& responseText)
 {
+    JerryModelList models;
+
     if (responseText.isEmpty())
     {
         DBG("Empty models response");
-        return;
+        return models;
     }
 
     DBG("=== RAW MODELS RESPONSE ===");
@@ -276,36 +276,36 @@ void Gary4juceAudioProcessorEditor::handleJerryModelsResponse(const juce::String
         if (!parsed.isObject())
         {
             DBG("Invalid models response format - not an object");
-            return;
+            return models;
         }
 
         auto* obj = parsed.getDynamicObject();
         if (!obj || !obj->hasProperty("model_details"))
         {
             DBG("Response missing 'model_details' property");
-            return;
+            return models;
         }
 
         auto modelDetails = obj->getProperty("model_details");
         if (!modelDetails.isObject())
         {
             DBG("model_details is not an object");
-            return;
+            return models;
         }
 
         // Parse models into component arrays
-        juce::StringArray modelNames;
-        juce::StringArray modelKeys;
-        juce::StringArray modelTypes;
-        juce::StringArray modelRepos;
-        juce::StringArray modelCheckpoints;
-        juce::Array<bool> isFinetune;
+        auto& modelNames = models.names;
+        auto& modelKeys = models.keys;
+        auto& modelTypes = models.types;
+        auto& modelRepos = models.repos;
+        auto& modelCheckpoints = models.checkpoints;
+        auto& isFinetune = models.isFinetune;
 
         auto* detailsObj = modelDetails.getDynamicObject();
         if (!detailsObj)
         {
             DBG("Failed to get model_details as dynamic object");
-            return;
+            return models;
         }
 
         DBG("Found " + juce::String(detailsObj->getProperties().size()) + " models in cache");
@@ -390,86 +390,104 @@ void Gary4juceAudioProcessorEditor::handleJerryModelsResponse(const juce::String
         // Which model the backend actually has live. usage_order is LRU, so the
         // last entry is the current one - the same rule /models/prompts uses to
         // resolve "active".
-        juce::String activeKey;
         if (auto* cacheStatus = obj->getProperty("cache_status").getDynamicObject())
             if (auto* order = cacheStatus->getProperty("usage_order").getArray())
                 if (!order->isEmpty())
-                    activeKey = order->getLast().toString();
+                    models.activeKey = order->getLast().toString();
 
-        if (jerryUI && modelNames.size() > 0)
-        {
-            const juce::String desiredKey = preferredJerryModelKey;
-            const juce::String desiredRepo = preferredJerryFinetuneRepo;
-            const juce::String desiredCheckpoint = preferredJerryFinetuneCheckpoint;
-            const juce::String desiredSampler = currentJerrySamplerType;
-            const float desiredCfg = currentJerryCfg;
-            const int desiredSteps = currentJerrySteps;
-            const bool hadStoredSelection = desiredKey.isNotEmpty() || desiredRepo.isNotEmpty();
-
-            jerryUI->setAvailableModels(modelNames, isFinetune, modelKeys,
-                modelTypes, modelRepos, modelCheckpoints);
-
-            int desiredIndex = -1;
-            for (int i = 0; i < modelNames.size(); ++i)
-            {
-                const bool keyMatches = desiredKey.isNotEmpty() && modelKeys[i] == desiredKey;
-                const bool finetuneMatches = desiredRepo.isNotEmpty()
-                    && modelRepos[i] == desiredRepo
-                    && modelCheckpoints[i] == desiredCheckpoint;
-                if (keyMatches || finetuneMatches)
-                {
-                    desiredIndex = i;
-                    break;
-                }
-            }
+        models.valid = true;
+    }
+    catch (...)
+    {
+        DBG("Exception parsing models response");
+    }
 
-            // Nothing stored yet (fresh instance): follow whatever the backend
-            // has loaded rather than leaving the state blank while the combo box
-            // sits on entry 0, which is how a finetune ended up being driven with
-            // the standard model's cfg and steps.
-            if (desiredIndex < 0 && activeKey.isNotEmpty())
-                desiredIndex = modelKeys.indexOf(activeKey);
-
-            // setAvailableModels already selected entry 0; adopt it explicitly so
-            // the model type is recorded either way.
-            if (desiredIndex < 0)
-                desiredIndex = 0;
-
-            jerryUI->setSelectedModel(desiredIndex);
-            if (desiredSampler.isNotEmpty())
-                jerryUI->setSelectedSamplerType(desiredSampler);
-            currentJerryModelIndex = desiredIndex;
-            currentJerryModelKey = modelKeys[desiredIndex];
-            currentJerryModelType = modelTypes[desiredIndex];
-            currentJerryFinetuneRepo = modelRepos[desiredIndex];
-            currentJerryFinetuneCheckpoint = modelCheckpoints[desiredIndex];
-            currentJerryIsFinetune = isFinetune[desiredIndex];
-            currentJerrySamplerType = jerryUI->getSelectedSamplerType();
-            preferredJerryModelKey = currentJerryModelKey;
-            preferredJerryFinetuneRepo = currentJerryFinetuneRepo;
-            preferredJerryFinetuneCheckpoint = currentJerryFinetuneCheckpoint;
-
-            // Selecting a model adjusts its slider ranges and defaults. Restore
-            // the host-loaded values after that adjustment - but only when there
-            // were any. With nothing stored, those "values" are just this class's
-            // initialisers, which happen to be the standard model's 1.0 / 8 and
-            // would silently overwrite a finetune's 4.0 / 30.
-            if (hadStoredSelection)
+    return models;
+}
+
+void Gary4juceAudioProcessorEditor::handleJerryModelsResponse(const JerryModelList& response)
+{
+    if (!response.valid)
+        return;
+
+    const auto& modelNames = response.names;
+    const auto& modelKeys = response.keys;
+    const auto& modelTypes = response.types;
+    const auto& modelRepos = response.repos;
+    const auto& modelCheckpoints = response.checkpoints;
+    const auto& isFinetune = response.isFinetune;
+    const auto& activeKey = response.activeKey;
+
+    if (jerryUI && modelNames.size() > 0)
+    {
+        const juce::String desiredKey = preferredJerryModelKey;
+        const juce::String desiredRepo = preferredJerryFinetuneRepo;
+        const juce::String desiredCheckpoint = preferredJerryFinetuneCheckpoint;
+        const juce::String desiredSampler = currentJerrySamplerType;
+        const float desiredCfg = currentJerryCfg;
+        const int desiredSteps = currentJerrySteps;
+        const bool hadStoredSelection = desiredKey.isNotEmpty() || desiredRepo.isNotEmpty();
+
+        jerryUI->setAvailableModels(modelNames, isFinetune, modelKeys,
+            modelTypes, modelRepos, modelCheckpoints);
+
+        int desiredIndex = -1;
+        for (int i = 0; i < modelNames.size(); ++i)
+        {
+            const bool keyMatches = desiredKey.isNotEmpty() && modelKeys[i] == desiredKey;
+            const bool finetuneMatches = desiredRepo.isNotEmpty()
+                && modelRepos[i] == desiredRepo
+                && modelCheckpoints[i] == desiredCheckpoint;
+            if (keyMatches || finetuneMatches)
             {
-                jerryUI->setCfg(desiredCfg);
-                jerryUI->setSteps(desiredSteps);
+                desiredIndex = i;
+                break;
             }
-            currentJerryCfg = jerryUI->getCfg();
-            currentJerrySteps = jerryUI->getSteps();
+        }
 
-            DBG("=== SUCCESS: Updated Jerry UI with " + juce::String(modelNames.size()) + " models ===");
+        // Nothing stored yet (fresh instance): follow whatever the backend
+        // has loaded rather than leaving the state blank while the combo box
+        // sits on entry 0, which is how a finetune ended up being driven with
+        // the standard model's cfg and steps.
+        if (desiredIndex < 0 && activeKey.isNotEmpty())
+            desiredIndex = modelKeys.indexOf(activeKey);
+
+        // setAvailableModels already selected entry 0; adopt it explicitly so
+        // the model type is recorded either way.
+        if (desiredIndex < 0)
+            desiredIndex = 0;
+
+        jerryUI->setSelectedModel(desiredIndex);
+        if (desiredSampler.isNotEmpty())
+            jerryUI->setSelectedSamplerType(desiredSampler);
+        currentJerryModelIndex = desiredIndex;
+        currentJerryModelKey = modelKeys[desiredIndex];
+        currentJerryModelType = modelTypes[desiredIndex];
+        currentJerryFinetuneRepo = modelRepos[desiredIndex];
+        currentJerryFinetuneCheckpoint = modelCheckpoints[desiredIndex];
+        currentJerryIsFinetune = isFinetune[desiredIndex];
+        currentJerrySamplerType = jerryUI->getSelectedSamplerType();
+        preferredJerryModelKey = currentJerryModelKey;
+        preferredJerryFinetuneRepo = currentJerryFinetuneRepo;
+        preferredJerryFinetuneCheckpoint = currentJerryFinetuneCheckpoint;
+
+        // Selecting a model adjusts its slider ranges and defaults. Restore
+        // the host-loaded values after that adjustment - but only when there
+        // were any. With nothing stored, those "values" are just this class's
+        // initialisers, which happen to be the standard model's 1.0 / 8 and
+        // would silently overwrite a finetune's 4.0 / 30.
+        if (hadStoredSelection)
+        {
+            jerryUI->setCfg(desiredCfg);
+            jerryUI->setSteps(desiredSteps);
         }
-    }
-    catch (...)
-    {
-        DBG("Exception parsing models response");
+        currentJerryCfg = jerryUI->getCfg();
+        currentJerrySteps = jerryUI->getSteps();
+
+        DBG("=== SUCCESS: Updated Jerry UI with " + juce::String(modelNames.size()) + " models ===");
     }
 }
+}
 
 void Gary4juceAudioProcessorEditor::fetchJerryCheckpoints(const juce::String& repo)
 {
@@ -483,66 +501,67 @@ void Gary4juceAudioProcessorEditor::fetchJerryCheckpoints(const juce::String& re
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, checkpointsUrl, jsonString]() {
-        juce::URL url(checkpointsUrl);
-        juce::URL postUrl = url.withPOSTData(jsonString);
-
-        auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-            .withConnectionTimeoutMs(10000)
-            .withExtraHeaders("Content-Type: application/json");
+    const juce::URL postUrl = juce::URL(checkpointsUrl).withPOSTData(jsonString);
 
-        std::unique_ptr<juce::InputStream> stream(postUrl.createInputStream(options));
+    audioProcessor.getMetadataCache().fetch(audioProcessor.getHttpClient(), postUrl, kJerryCheckpointsMaxAgeMs,
+        [asyncAlive, editor](const MetadataCache::Response& response) {
+        const auto checkpoints = parseJerryCheckpoints(response.body);
 
-        juce::String responseText;
-        if (stream != nullptr)
-            responseText = stream->readEntireStreamAsString();
-
-        juce::MessageManager::callAsync([asyncAlive, editor, responseText]() {
+        juce::MessageManager::callAsync([asyncAlive, editor, checkpoints]() {
             const auto alive = asyncAlive.lock();
             if (alive == nullptr || !alive->load(std::memory_order_acquire))
                 return;
 
-            editor->handleJerryCheckpointsResponse(responseText);
+            editor->handleJerryCheckpointsResponse(checkpoints);
         });
-    });
+    }, MetadataCache::defaultTimeoutMs, "Content-Type: application/json");
+}
+
+Gary4juceAudioProcessorEditor::JerryCheckpoints Gary4juceAudioProcessorEditor::parseJerryCheckpoints(const juce::String& responseText)
+{
+    JerryCheckpoints result;
+    result.received = responseText.isNotEmpty();
+    if (!result.received)
+        return result;
+
+    const auto parsed = juce::JSON::parse(responseText);
+    auto* obj = parsed.getDynamicObject();
+    if (obj == nullptr)
+        return result;
+
+    result.valid = true;
+    result.success = (bool)obj->getProperty("success");
+    result.error = obj->getProperty("error").toString();
+
+    if (auto* arr = obj->getProperty("checkpoints").getArray())
+        for (auto& item : *arr)
+            result.checkpoints.add(item.toString());
+
+    return result;
 }
 
-void Gary4juceAudioProcessorEditor::handleJerryCheckpointsResponse(const juce::String& responseText)
+void Gary4juceAudioProcessorEditor::handleJerryCheckpointsResponse(const JerryCheckpoints& response)
 {
     if (jerryUI)
         jerryUI->setFetchingCheckpoints(false);
 
-    if (responseText.isEmpty()) {
+    if (!response.received) {
         showStatusMessage("failed to fetch checkpoints", 3000);
         return;
     }
 
-    try {
-        auto parsed = juce::JSON::parse(responseText);
-        if (auto* obj = parsed.getDynamicObject()) {
-            bool success = obj->getProperty("success");
-
-            if (success) {
-                juce::StringArray checkpoints;
-                auto checkpointsArray = obj->getProperty("checkpoints");
-
-                if (auto* arr = checkpointsArray.getArray()) {
-                    for (auto& item : *arr) {
-                        checkpoints.add(item.toString());
-                    }
-                }
+    if (!response.valid) {
+        showStatusMessage("invalid checkpoint response", 3000);
+        return;
+    }
 
-                if (jerryUI)
-                    jerryUI->setAvailableCheckpoints(checkpoints);
+    if (response.success) {
+        if (jerryUI)
+            jerryUI->setAvailableCheckpoints(response.checkpoints);
 
-                showStatusMessage(juce::String(checkpoints.size()) + " checkpoints found", 2500);
-            } else {
-                auto error = obj->getProperty("error").toString();
-                showStatusMessage("fetch failed: " + error, 4000);
-            }
-        }
-    } catch (...) {
-        showStatusMessage("invalid checkpoint response", 3000);
+        showStatusMessage(juce::String(response.checkpoints.size()) + " checkpoints found", 2500);
+    } else {
+        showStatusMessage("fetch failed: " + response.error, 4000);
     }
 }
 
@@ -567,7 +586,7 @@ void Gary4juceAudioProcessorEditor::fetchJerryPrompts(const juce::String& repo,
     if (promptsCache.contains(cacheKey))
     {
         DBG("[prompts] cache hit for " + cacheKey + " - applying");
-        applyJerryPromptsToUI(repo, checkpoint, promptsCache[cacheKey]);
+        applyJerryPromptsToUI(promptsCache[cacheKey]);
         return;
     }
 
@@ -575,36 +594,30 @@ void Gary4juceAudioProcessorEditor::fetchJerryPrompts(const juce::String& repo,
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, repo, checkpoint, promptsUrl]()
+    audioProcessor.getMetadataCache().fetch(audioProcessor.getHttpClient(), promptsUrl, (int)kPromptsTTLms,
+        [asyncAlive, editor, repo, checkpoint, promptsUrl](const MetadataCache::Response& response)
         {
-            juce::URL url = promptsUrl;
-
-            int statusCode = 0;
-            juce::StringPairArray responseHeaders;
-
-            auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-                .withConnectionTimeoutMs(10000)
-                .withStatusCode(&statusCode)
-                .withResponseHeaders(&responseHeaders);
-
-            std::unique_ptr<juce::InputStream> stream(url.createInputStream(options));
-            juce::String responseText;
-            if (stream) responseText = stream->readEntireStreamAsString();
+            const int statusCode = response.statusCode;
+            const auto& responseText = response.body;
 
-            DBG("[prompts] GET " + url.toString(true) +
+            DBG("[prompts] GET " + promptsUrl.toString(true) +
                 " status=" + juce::String(statusCode) +
                 " bytes=" + juce::String((int)responseText.getNumBytesAsUTF8()));
 
             if (statusCode < 200 || statusCode >= 300)
                 DBG("[prompts] non-2xx - first512: " + responseText.substring(0, 512));
 
-            juce::MessageManager::callAsync([asyncAlive, editor, repo, checkpoint, responseText, statusCode]()
+            const auto bank = parseJerryPrompts(responseText, repo, checkpoint);
+            if (!bank.valid)
+                return;
+
+            juce::MessageManager::callAsync([asyncAlive, editor, bank]()
                 {
                     const auto alive = asyncAlive.lock();
                     if (alive == nullptr || !alive->load(std::memory_order_acquire))
                         return;
 
-                    editor->applyJerryPromptsToUI(repo, checkpoint, responseText, statusCode);
+                    editor->applyJerryPromptsToUI(bank);
                 });
         });
 }
@@ -612,13 +625,6 @@ void Gary4juceAudioProcessorEditor::fetchJerryPrompts(const juce::String& repo,
 void Gary4juceAudioProcessorEditor::maybeFetchRemoteJerryPrompts()
 {
     DBG("[prompts] maybeFetchRemoteJerryPrompts called");
-    if (promptsFetchInFlight) { DBG("[prompts] in flight - skipping"); return; }
-
-    const auto now = static_cast<std::int64_t>(juce::Time::getCurrentTime().toMilliseconds());
-    if (now - lastPromptsFetchMs < kPromptsTTLms) {
-        DBG("[prompts] TTL not expired - skipping");
-        return;
-    }
 
     if (jerryUI)
     {
@@ -630,72 +636,48 @@ void Gary4juceAudioProcessorEditor::maybeFetchRemoteJerryPrompts()
             if (promptsCache.contains(key))
             {
                 DBG("[prompts] cache hit for " + key + " - applying");
-                applyJerryPromptsToUI(repo, ckpt, promptsCache[key]);
-                lastPromptsFetchMs = now;
+                applyJerryPromptsToUI(promptsCache[key]);
                 return;
             }
         }
     }
 
-    promptsFetchInFlight = true;
-
     juce::URL promptsUrl(getServiceUrl(ServiceType::Jerry, "/audio/models/prompts"));
     promptsUrl = promptsUrl.withParameter("prefer", "finetune");
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, promptsUrl]()
+    // Repeat calls inside the TTL are answered by the shared cache
+    audioProcessor.getMetadataCache().fetch(audioProcessor.getHttpClient(), promptsUrl, (int)kPromptsTTLms,
+        [asyncAlive, editor](const MetadataCache::Response& response)
         {
-            auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-                .withConnectionTimeoutMs(8000);
-
-            std::unique_ptr<juce::InputStream> stream(promptsUrl.createInputStream(options));
-            juce::String responseText;
-            if (stream) responseText = stream->readEntireStreamAsString();
+            // Only a bank that names its own finetune can be cached
+            const auto bank = parseJerryPrompts(response.body, {}, {});
 
-            juce::MessageManager::callAsync([asyncAlive, editor, responseText]()
+            juce::MessageManager::callAsync([asyncAlive, editor, bank]()
                 {
                     const auto alive = asyncAlive.lock();
                     if (alive == nullptr || !alive->load(std::memory_order_acquire))
                         return;
 
-                    editor->promptsFetchInFlight = false;
-                    editor->lastPromptsFetchMs = static_cast<std::int64_t>(juce::Time::getCurrentTime().toMilliseconds());
-                    if (responseText.isEmpty()) return;
-
-                    auto parsed = juce::JSON::parse(responseText);
-                    if (auto* obj = parsed.getDynamicObject())
-                    {
-                        if (!obj->getProperty("success")) return;
-
-                        const auto promptsVar = obj->getProperty("prompts");
-                        const auto repo = obj->getProperty("source").toString();
-                        const auto ckpt = obj->getProperty("checkpoint").toString();
-
-                        if (promptsVar.isObject() && repo.isNotEmpty() && ckpt.isNotEmpty())
-                        {
-                            const auto cacheKey = repo + "|" + ckpt;
-                            editor->promptsCache.set(cacheKey, responseText);
-
-                            if (editor->jerryUI)
-                                editor->jerryUI->setFinetunePromptBank(repo, ckpt, promptsVar);
-                        }
-                    }
+                    if (bank.valid && bank.repo.isNotEmpty() && bank.checkpoint.isNotEmpty())
+                        editor->applyJerryPromptsToUI(bank);
                 });
         });
 }
 
-void Gary4juceAudioProcessorEditor::applyJerryPromptsToUI(const juce::String& repo,
-    const juce::String& checkpoint,
-    const juce::String& jsonText,
-    int statusCode)
+// Runs on the fetching thread. repo and checkpoint stand in for a response
+// that doesn't say which finetune it belongs to.
+Gary4juceAudioProcessorEditor::JerryPromptBank Gary4juceAudioProcessorEditor::parseJerryPrompts(const juce::String& jsonText,
+    const juce::String& repo,
+    const juce::String& checkpoint)
 {
-    juce::ignoreUnused(statusCode);
+    JerryPromptBank bank;
 
     if (jsonText.isEmpty())
     {
         DBG("[prompts] empty response - skipping");
-        return;
+        return bank;
     }
 
     juce::var parsed;
@@ -706,7 +688,7 @@ void Gary4juceAudioProcessorEditor::applyJerryPromptsToUI(const juce::String& re
     catch (...)
     {
         DBG("[prompts] JSON parse error - first512: " + jsonText.substring(0, 512));
-        return;
+        return bank;
     }
 
     if (auto* obj = parsed.getDynamicObject())
@@ -714,29 +696,35 @@ void Gary4juceAudioProcessorEditor::applyJerryPromptsToUI(const juce::String& re
         if (!obj->getProperty("success"))
         {
             DBG("[prompts] success=false - payload first512: " + jsonText.substring(0, 512));
-            return;
+            return bank;
         }
 
-        auto promptsVar = obj->getProperty("prompts");
-        if (!promptsVar.isObject())
+        bank.prompts = obj->getProperty("prompts");
+        if (!bank.prompts.isObject())
         {
             DBG("[prompts] prompts missing/invalid - payload first512: " + jsonText.substring(0, 512));
-            return;
+            return bank;
         }
 
-        auto resolvedRepo = obj->getProperty("source").toString();
-        auto resolvedCkpt = obj->getProperty("checkpoint").toString();
-        if (resolvedRepo.isEmpty()) resolvedRepo = repo;
-        if (resolvedCkpt.isEmpty()) resolvedCkpt = checkpoint;
+        bank.repo = obj->getProperty("source").toString();
+        bank.checkpoint = obj->getProperty("checkpoint").toString();
+        if (bank.repo.isEmpty()) bank.repo = repo;
+        if (bank.checkpoint.isEmpty()) bank.checkpoint = checkpoint;
+        bank.valid = true;
+    }
 
-        const auto cacheKey = resolvedRepo + "|" + resolvedCkpt;
-        promptsCache.set(cacheKey, jsonText);
+    return bank;
+}
 
-        if (jerryUI)
-            jerryUI->setFinetunePromptBank(resolvedRepo, resolvedCkpt, promptsVar);
+void Gary4juceAudioProcessorEditor::applyJerryPromptsToUI(const JerryPromptBank& bank)
+{
+    const auto cacheKey = bank.repo + "|" + bank.checkpoint;
+    promptsCache.set(cacheKey, bank);
 
-        DBG("[prompts] stored bank for " + cacheKey);
-    }
+    if (jerryUI)
+        jerryUI->setFinetunePromptBank(bank.repo, bank.checkpoint, bank.prompts);
+
+    DBG("[prompts] stored bank for " + cacheKey);
 }
 
 void Gary4juceAudioProcessorEditor::addCustomJerryModel(const juce::String& repo, const juce::String& checkpoint)
@@ -760,7 +748,7 @@ void Gary4juceAudioProcessorEditor::addCustomJerryModel(const juce::String& repo
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, repo, checkpoint, switchUrl, jsonString]() {
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Metadata, switchUrl, [asyncAlive, editor, repo, checkpoint, switchUrl, jsonString](const HttpClient::CancellationToken&) {
         juce::URL url(switchUrl);
         juce::URL postUrl = url.withPOSTData(jsonString);
 
@@ -768,7 +756,7 @@ void Gary4juceAudioProcessorEditor::addCustomJerryModel(const juce::String& repo
             .withConnectionTimeoutMs(300000)
             .withExtraHeaders("Content-Type: application/json");
 
-        std::unique_ptr<juce::InputStream> stream(postUrl.createInputStream(options));
+        std::unique_ptr<juce::InputStream> stream(HttpClient::openStream(postUrl, options));
 
         juce::String responseText;
         if (stream != nullptr)
@@ -810,6 +798,7 @@ void Gary4juceAudioProcessorEditor::handleAddCustomModelResponse(const juce::Str
                 showStatusMessage(successMsg + "!", 4000);
 
                 DBG("Model switch successful - refreshing model list");
+                audioProcessor.getMetadataCache().invalidate(juce::URL(getJerryModelsStatusUrl()));
                 fetchJerryAvailableModels();
 
                 const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
@@ -940,9 +929,9 @@ void Gary4juceAudioProcessorEditor::sendToJerry()
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, fullPrompt, requestUrl, jerrySteps, jerryCfg, modelType,
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Generation, requestUrl, [asyncAlive, editor, fullPrompt, requestUrl, jerrySteps, jerryCfg, modelType,
                           isFinetune, finetuneRepo, finetuneCheckpoint, samplerType,
-                          requestGenerateAsLoop, requestLoopType]() {
+                          requestGenerateAsLoop, requestLoopType](const HttpClient::CancellationToken&) {
         auto startTime = juce::Time::getCurrentTime();
 
         juce::DynamicObject::Ptr jsonRequest = new juce::DynamicObject();
@@ -969,6 +958,7 @@ void Gary4juceAudioProcessorEditor::sendToJerry()
         juce::URL url(requestUrl);
 
         juce::String responseText;
+        JsonAudioStream::DecodedFile receivedAudio;
         int statusCode = 0;
 
         try
@@ -979,14 +969,20 @@ void Gary4juceAudioProcessorEditor::sendToJerry()
                 .withConnectionTimeoutMs(30000)
                 .withExtraHeaders("Content-Type: application/json");
 
-            auto stream = postUrl.createInputStream(options);
+            auto stream = HttpClient::openStream(postUrl, options);
 
             auto requestTime = juce::Time::getCurrentTime() - startTime;
             DBG("Jerry HTTP connection established in " + juce::String(requestTime.inMilliseconds()) + "ms");
 
             if (stream != nullptr)
             {
-                responseText = stream->readEntireStreamAsString();
+                // Decode audio_base64 to disk while reading
+                auto response = JsonAudioStream::read(*stream, { "audio_base64" });
+                if (response.complete)
+                {
+                    responseText = response.json;
+                    receivedAudio = response.audio;
+                }
 
                 auto totalTime = juce::Time::getCurrentTime() - startTime;
                 DBG("Jerry HTTP request completed in " + juce::String(totalTime.inMilliseconds()) + "ms");
@@ -1014,7 +1010,7 @@ void Gary4juceAudioProcessorEditor::sendToJerry()
             statusCode = 0;
         }
 
-        juce::MessageManager::callAsync([asyncAlive, editor, responseText, statusCode, startTime]() {
+        juce::MessageManager::callAsync([asyncAlive, editor, responseText, receivedAudio, statusCode, startTime]() {
             const auto alive = asyncAlive.lock();
             if (alive == nullptr || !alive->load(std::memory_order_acquire))
                 return;
@@ -1032,14 +1028,12 @@ void Gary4juceAudioProcessorEditor::sendToJerry()
                     bool success = responseObj->getProperty("success");
                     if (success)
                     {
-                        auto audioBase64 = responseObj->getProperty("audio_base64").toString();
-
-                        if (audioBase64.isNotEmpty())
+                        if (receivedAudio != nullptr)
                         {
                             if (editor->jerryUI)
                                 editor->jerryUI->setGenerateButtonText("generate with jerry");
 
-                            editor->saveGeneratedAudio(audioBase64);
+                            editor->saveGeneratedAudioFile(receivedAudio);
 
                             editor->audioProcessor.clearCurrentSessionId();
                             editor->audioProcessor.setUndoTransformAvailable(false);
@@ -1241,31 +1235,15 @@ void Gary4juceAudioProcessorEditor::refreshSA3AvailableLoras(bool force)
         return;
     }
 
-    if (sa3LoraFetchInFlight.exchange(true))
-        return;
-
     const int nonce = ++sa3LoraFetchNonce;
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, loraUrl, nonce]()
+    audioProcessor.getMetadataCache().fetch(audioProcessor.getHttpClient(), juce::URL(loraUrl), force ? 0 : (int)ttlMs,
+        [asyncAlive, editor, loraUrl, nonce](const MetadataCache::Response& response)
     {
-        juce::String responseText;
-        int statusCode = 0;
-
-        try
-        {
-            juce::URL url(loraUrl);
-            auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-                .withConnectionTimeoutMs(8000)
-                .withStatusCode(&statusCode)
-                .withExtraHeaders("Accept: application/json");
-
-            auto stream = url.createInputStream(options);
-            if (stream)
-                responseText = stream->readEntireStreamAsString();
-        }
-        catch (...) {}
+        const auto responseText = response.body;
+        const int statusCode = response.statusCode;
 
         juce::MessageManager::callAsync([asyncAlive, editor, loraUrl, nonce, responseText, statusCode]()
         {
@@ -1273,8 +1251,6 @@ void Gary4juceAudioProcessorEditor::refreshSA3AvailableLoras(bool force)
             if (alive == nullptr || !alive->load(std::memory_order_acquire))
                 return;
 
-            editor->sa3LoraFetchInFlight.store(false);
-
             if (nonce != editor->sa3LoraFetchNonce.load())
                 return;
 
@@ -1319,7 +1295,7 @@ void Gary4juceAudioProcessorEditor::refreshSA3AvailableLoras(bool force)
             }
             editor->syncSA3LoraUi();
         });
-    });
+    }, 8000, "Accept: application/json");
 }
 
 void Gary4juceAudioProcessorEditor::requestSA3DicePrompt(SA3UI::SubTab targetTab)
@@ -1354,7 +1330,7 @@ void Gary4juceAudioProcessorEditor::requestSA3DicePrompt(SA3UI::SubTab targetTab
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, requestNonce, targetTab, promptsBaseUrl, promptsUrl, activeLoraCount]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Metadata, promptsUrl, [asyncAlive, editor, requestNonce, targetTab, promptsBaseUrl, promptsUrl, activeLoraCount](const HttpClient::CancellationToken&)
     {
         juce::String responseText;
         int statusCode = 0;
@@ -1367,7 +1343,7 @@ void Gary4juceAudioProcessorEditor::requestSA3DicePrompt(SA3UI::SubTab targetTab
                 .withStatusCode(&statusCode)
                 .withExtraHeaders("Accept: application/json");
 
-            auto stream = promptsUrl.createInputStream(options);
+            auto stream = HttpClient::openStream(promptsUrl, options);
             if (stream)
                 responseText = stream->readEntireStreamAsString();
         }
@@ -1551,11 +1527,42 @@ void Gary4juceAudioProcessorEditor::sendToSA3()
 
     showStatusMessage(requestLoop ? "submitting sa3 loop..." : "submitting sa3 request...", 2500);
 
+    if (variationsPerSend > 1)
+    {
+        // Same prompt, a seed per take: counting up from a locked seed, or
+        // each one picked by the backend
+        std::vector<VariationBatch::Variation> variations;
+        for (int i = 0; i < variationsPerSend; ++i)
+        {
+            jsonRequest->setProperty("seed", requestSeed >= 0 ? requestSeed + i : (juce::int64)-1);
+            const juce::URL postUrl = juce::URL(requestUrl).withPOSTData(juce::JSON::toString(juce::var(jsonRequest.get())));
+
+            variations.push_back({ "take " + juce::String(i + 1), postUrl,
+                [postUrl](const HttpClient::CancellationToken&)
+                {
+                    int statusCode = 0;
+                    auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
+                        .withConnectionTimeoutMs(15000)
+                        .withStatusCode(&statusCode)
+                        .withExtraHeaders("Content-Type: application/json");
+
+                    auto stream = HttpClient::openStream(postUrl, options);
+                    if (stream == nullptr)
+                        return VariationBatch::Submitted { {}, {}, "sa3 backend not responding" };
+
+                    return VariationBatch::readSubmitResponse(stream->readEntireStreamAsString());
+                } });
+        }
+
+        startVariationBatch(ServiceType::SA3, std::move(variations));
+        return;
+    }
+
     const auto generationToken = beginGenerationAsyncWork();
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, generationToken, requestUrl, jsonString, requestLoop]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Generation, requestUrl, [asyncAlive, editor, generationToken, requestUrl, jsonString, requestLoop](const HttpClient::CancellationToken&)
     {
         juce::String responseText;
         int statusCode = 0;
@@ -1570,7 +1577,7 @@ void Gary4juceAudioProcessorEditor::sendToSA3()
                 .withStatusCode(&statusCode)
                 .withExtraHeaders("Content-Type: application/json");
 
-            auto stream = postUrl.createInputStream(options);
+            auto stream = HttpClient::openStream(postUrl, options);
             if (stream != nullptr)
             {
                 responseText = stream->readEntireStreamAsString();
@@ -1711,16 +1718,14 @@ void Gary4juceAudioProcessorEditor::sendSA3Transform()
         return;
     }
 
-    juce::MemoryBlock audioData;
-    if (!audioFile.loadFileAsData(audioData) || audioData.getSize() == 0)
+    const auto uploadAudio = AudioUpload::snapshot(audioFile);
+    if (uploadAudio == nullptr)
     {
         showStatusMessage("failed to read audio file", 3000);
         updateSA3EnablementSnapshot();
         return;
     }
 
-    const auto base64Audio = juce::Base64::toBase64(audioData.getData(), audioData.getSize());
-
     double bpm = juce::JUCEApplicationBase::isStandaloneApp() && sa3UI
         ? sa3UI->getBpm() : audioProcessor.getCurrentBPM();
     if (bpm <= 0.0)
@@ -1741,7 +1746,6 @@ void Gary4juceAudioProcessorEditor::sendSA3Transform()
     jsonRequest->setProperty("cfg_scale", currentSA3Cfg);
     jsonRequest->setProperty("shift", currentSA3Shift.isNotEmpty() ? currentSA3Shift : "logsnr");
     jsonRequest->setProperty("seed", requestSeed);
-    jsonRequest->setProperty("audio_data", base64Audio);
     jsonRequest->setProperty("strength", currentSA3TransformStrength);
 
     juce::Array<juce::var> loraEntries;
@@ -1756,11 +1760,10 @@ void Gary4juceAudioProcessorEditor::sendSA3Transform()
     }
     jsonRequest->setProperty("loras", loraEntries);
 
-    const juce::String jsonString = juce::JSON::toString(juce::var(jsonRequest.get()));
     const juce::String requestUrl = getServiceUrl(ServiceType::SA3, "/transform");
 
     DBG("[sa3] submit /transform from " + juce::String(transformRecording ? "recording" : "output")
-        + " bytes=" + juce::String((int)audioData.getSize()));
+        + " bytes=" + juce::String(audioFile.getSize()));
 
     setActiveOp(ActiveOp::SA3Transform);
     isGenerating = true;
@@ -1785,7 +1788,7 @@ void Gary4juceAudioProcessorEditor::sendSA3Transform()
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, generationToken, requestUrl, jsonString]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Generation, requestUrl, [asyncAlive, editor, generationToken, requestUrl, jsonRequest, uploadAudio](const HttpClient::CancellationToken&)
     {
         juce::String responseText;
         int statusCode = 0;
@@ -1793,14 +1796,12 @@ void Gary4juceAudioProcessorEditor::sendSA3Transform()
 
         try
         {
-            juce::URL url(requestUrl);
-            juce::URL postUrl = url.withPOSTData(jsonString);
             auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                 .withConnectionTimeoutMs(15000)
                 .withStatusCode(&statusCode)
                 .withExtraHeaders("Content-Type: application/json");
 
-            auto stream = postUrl.createInputStream(options);
+            auto stream = AudioUpload::post(juce::URL(requestUrl), *jsonRequest, "audio_data", uploadAudio, options);
             if (stream != nullptr)
             {
                 responseText = stream->readEntireStreamAsString();
@@ -1960,15 +1961,13 @@ void Gary4juceAudioProcessorEditor::sendSA3Continue()
         return;
     }
 
-    juce::MemoryBlock audioData;
-    if (!audioFile.loadFileAsData(audioData) || audioData.getSize() == 0)
+    const auto uploadAudio = AudioUpload::snapshot(audioFile);
+    if (uploadAudio == nullptr)
     {
         showStatusMessage("failed to read audio file", 3000);
         updateSA3EnablementSnapshot();
         return;
     }
-
-    const auto base64Audio = juce::Base64::toBase64(audioData.getData(), audioData.getSize());
     const juce::String continuationMode = currentSA3ContinueLatentPrefix ? "latent_prefix" : "inpaint";
 
     double bpm = juce::JUCEApplicationBase::isStandaloneApp() && sa3UI
@@ -1991,7 +1990,6 @@ void Gary4juceAudioProcessorEditor::sendSA3Continue()
     jsonRequest->setProperty("cfg_scale", currentSA3Cfg);
     jsonRequest->setProperty("shift", currentSA3Shift.isNotEmpty() ? currentSA3Shift : "logsnr");
     jsonRequest->setProperty("seed", requestSeed);
-    jsonRequest->setProperty("audio_data", base64Audio);
     jsonRequest->setProperty("continuation_seconds", continuationSecondsForRequest);
     jsonRequest->setProperty("continuation_mode", continuationMode);
 
@@ -2007,11 +2005,10 @@ void Gary4juceAudioProcessorEditor::sendSA3Continue()
     }
     jsonRequest->setProperty("loras", loraEntries);
 
-    const juce::String jsonString = juce::JSON::toString(juce::var(jsonRequest.get()));
     const juce::String requestUrl = getServiceUrl(ServiceType::SA3, "/continue");
 
     DBG("[sa3] submit /continue from " + juce::String(transformRecording ? "recording" : "output")
-        + " bytes=" + juce::String((int)audioData.getSize())
+        + " bytes=" + juce::String(audioFile.getSize())
         + " target=" + juce::String(requestedTotalSeconds, 2) + "s"
         + " continuation=" + juce::String(continuationSecondsForRequest, 2) + "s"
         + " mode=" + continuationMode);
@@ -2039,7 +2036,7 @@ void Gary4juceAudioProcessorEditor::sendSA3Continue()
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, generationToken, requestUrl, jsonString]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Generation, requestUrl, [asyncAlive, editor, generationToken, requestUrl, jsonRequest, uploadAudio](const HttpClient::CancellationToken&)
     {
         juce::String responseText;
         int statusCode = 0;
@@ -2047,14 +2044,12 @@ void Gary4juceAudioProcessorEditor::sendSA3Continue()
 
         try
         {
-            juce::URL url(requestUrl);
-            juce::URL postUrl = url.withPOSTData(jsonString);
             auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                 .withConnectionTimeoutMs(15000)
                 .withStatusCode(&statusCode)
                 .withExtraHeaders("Content-Type: application/json");
 
-            auto stream = postUrl.createInputStream(options);
+            auto stream = AudioUpload::post(juce::URL(requestUrl), *jsonRequest, "audio_data", uploadAudio, options);
             if (stream != nullptr)
             {
                 responseText = stream->readEntireStreamAsString();
@@ -671,6 +671,7 @@ void Gary4juceAudioProcessorEditor::activateGaryDataDirectory(const juce::File&
     activeGaryDataDirectory = directory;
     usingGaryDataFallback = isFallback;
     outputAudioFile = getGaryOutputFile();
+    audioProcessor.setRecordingSpoolDirectory(activeGaryDataDirectory);
 
     if (lastDraggedAudioFile == previousOutputFile)
         lastDraggedAudioFile = outputAudioFile;
@@ -694,13 +695,39 @@ void Gary4juceAudioProcessorEditor::recoverCurrentAudioFiles()
     }
 
     outputAudioFile = getGaryOutputFile();
-    if (outputAudioBuffer.getNumSamples() > 0)
+    if (getOutputNumSamples() > 0)
         writeCurrentOutputToFile(outputAudioFile);
 
     updateAllGenerationButtonStates();
     repaint();
 }
 
+void Gary4juceAudioProcessorEditor::installRestoredEmbeddedAudio()
+{
+    // The rest of the editor works from myBuffer.wav / myOutput.wav, so audio
+    // restored from the project state is written back there once.
+    juce::AudioBuffer<float> restoredOutput;
+    double restoredOutputRate = 0.0;
+    if (audioProcessor.takeRestoredOutputAudio(restoredOutput, restoredOutputRate))
+    {
+        outputAudioFile = getGaryOutputFile();
+        if (writeAudioBufferToFileSafely(restoredOutput, restoredOutputRate, outputAudioFile))
+            loadOutputAudioFile();
+        else
+            DBG("Could not write restored output audio to " + outputAudioFile.getFullPathName());
+    }
+
+    if (audioProcessor.takeRestoredRecording())
+    {
+        if (!isRecording && !audioProcessor.saveRecordingToFile(getGaryBufferFile()))
+            DBG("Could not write restored recording to " + getGaryBufferFile().getFullPathName());
+
+        savedSamples = audioProcessor.getSavedSamples();
+        updateAllGenerationButtonStates();
+        repaint();
+    }
+}
+
 bool Gary4juceAudioProcessorEditor::writeDataToFileSafely(const juce::File& file,
                                                           const void* data,
                                                           size_t dataSize) const
@@ -722,9 +749,22 @@ bool Gary4juceAudioProcessorEditor::writeDataToFileSafely(const juce::File& file
     return installed;
 }
 
+bool Gary4juceAudioProcessorEditor::installFileSafely(const juce::File& source,
+                                                      const juce::File& file) const
+{
+    const auto parentResult = file.getParentDirectory().createDirectory();
+    if (!parentResult.wasOk())
+        return false;
+
+    return copyFileSafely(source, file);
+}
+
 bool Gary4juceAudioProcessorEditor::writeCurrentOutputToFile(const juce::File& file) const
 {
-    return writeAudioBufferToFileSafely(outputAudioBuffer, currentAudioSampleRate, file);
+    if (outputAudio == nullptr)
+        return false;
+
+    return writeAudioBufferToFileSafely(outputAudio->audio, outputAudio->sampleRate, file);
 }
 
 juce::String Gary4juceAudioProcessorEditor::getDraggedAudioFileExtension() const
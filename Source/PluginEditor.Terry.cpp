@@ -177,29 +177,26 @@ void Gary4juceAudioProcessorEditor::sendToTerry()
         return;
     }
 
-    // Read and encode audio file (same as Gary)
-    juce::MemoryBlock audioData;
-    if (!audioFile.loadFileAsData(audioData))
+    // Copy the audio aside for the upload (same as Gary)
+    if (audioFile.getSize() == 0)
     {
-        showStatusMessage("failed to read audio file");
+        showStatusMessage("audio file is empty");
         cancelTerryOperation();
         updateAllGenerationButtonStates();
         return;
     }
 
-    if (audioData.getSize() == 0)
+    const auto uploadAudio = AudioUpload::snapshot(audioFile);
+    if (uploadAudio == nullptr)
     {
-        showStatusMessage("audio file is empty");
+        showStatusMessage("failed to read audio file");
         cancelTerryOperation();
         updateAllGenerationButtonStates();
         return;
     }
 
-    auto base64Audio = juce::Base64::toBase64(audioData.getData(), audioData.getSize());
-
     // Debug: Log audio data size
-    DBG("Terry audio file size: " + juce::String(audioData.getSize()) + " bytes");
-    DBG("Terry base64 length: " + juce::String(base64Audio.length()) + " chars");
+    DBG("Terry audio file size: " + juce::String(audioFile.getSize()) + " bytes");
     DBG("Terry flowstep: " + juce::String(currentTerryFlowstep, 3));
     DBG("Terry solver: " + juce::String(useMidpointSolver ? "midpoint" : "euler"));
 
@@ -214,25 +211,15 @@ void Gary4juceAudioProcessorEditor::sendToTerry()
     const juce::int64 requestSeed = terryUI != nullptr ? terryUI->getSeed() : -1;
     DBG("Terry seed: " + (requestSeed >= 0 ? juce::String(requestSeed) : juce::String("random")));
     const juce::URL requestUrl(getServiceUrl(ServiceType::Terry, "/api/juce/transform_audio"));
-    juce::Component::SafePointer<Gary4juceAudioProcessorEditor> safeThis(this);
-    const auto generationToken = beginGenerationAsyncWork();
-
-    // Create HTTP request in background thread (same pattern as Gary and Jerry)
-    juce::Thread::launch([safeThis, generationToken, base64Audio, variationNames, hasVariation, hasCustomPrompt, flowstep, useMidpoint, customPrompt, selectedVariation, requestSeed, requestUrl]() {
-        if (safeThis == nullptr || !safeThis->isGenerationAsyncWorkCurrent(generationToken)) {
-            DBG("Terry request aborted - generation stopped");
-            return;
-        }
-
-        auto startTime = juce::Time::getCurrentTime();
 
-        // Create JSON payload
+    // Create JSON payload
+    const auto makeRequest = [variationNames, hasVariation, hasCustomPrompt, flowstep, useMidpoint, customPrompt](int variation, juce::int64 seed)
+    {
         juce::DynamicObject::Ptr jsonRequest = new juce::DynamicObject();
-        jsonRequest->setProperty("audio_data", base64Audio);
         jsonRequest->setProperty("flowstep", flowstep);
         jsonRequest->setProperty("solver", useMidpoint ? "midpoint" : "euler");
         // -1 tells the backend to pick one and hand it back as the last seed.
-        jsonRequest->setProperty("seed", requestSeed);
+        jsonRequest->setProperty("seed", seed);
 
         // FIXED: Always send a variation (required by backend), custom_prompt overrides it
         if (hasCustomPrompt)
@@ -242,11 +229,11 @@ void Gary4juceAudioProcessorEditor::sendToTerry()
             jsonRequest->setProperty("custom_prompt", customPrompt);
             DBG("Terry using custom prompt: " + customPrompt + " (with default variation)");
         }
-        else if (hasVariation && selectedVariation < variationNames.size())
+        else if (hasVariation && variation < variationNames.size())
         {
             // Send selected variation only
-            jsonRequest->setProperty("variation", variationNames[selectedVariation]);
-            DBG("Terry using variation: " + variationNames[selectedVariation]);
+            jsonRequest->setProperty("variation", variationNames[variation]);
+            DBG("Terry using variation: " + variationNames[variation]);
         }
         else
         {
@@ -255,23 +242,64 @@ void Gary4juceAudioProcessorEditor::sendToTerry()
             DBG("Terry fallback to default variation");
         }
 
-        auto jsonString = juce::JSON::toString(juce::var(jsonRequest.get()));
+        return jsonRequest;
+    };
 
-        DBG("Terry JSON payload size: " + juce::String(jsonString.length()) + " characters");
+    if (variationsPerSend > 1)
+    {
+        // Successive variations from the selected one; a custom prompt
+        // varies the seed instead
+        std::vector<VariationBatch::Variation> variations;
+        for (int i = 0; i < variationsPerSend; ++i)
+        {
+            const bool varySeed = hasCustomPrompt || !hasVariation || variationNames.isEmpty();
+            const int variation = varySeed ? selectedVariation : (selectedVariation + i) % variationNames.size();
+            const juce::int64 seed = varySeed && requestSeed >= 0 ? requestSeed + i : requestSeed;
+            const juce::String label = varySeed ? "take " + juce::String(i + 1)
+                                                : variationNames[variation].replaceCharacter('_', ' ');
+
+            variations.push_back({ label, requestUrl,
+                [makeRequest, variation, seed, uploadAudio, requestUrl](const HttpClient::CancellationToken&)
+                {
+                    auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
+                        .withConnectionTimeoutMs(30000)
+                        .withExtraHeaders("Content-Type: application/json");
+
+                    auto stream = AudioUpload::post(requestUrl, *makeRequest(variation, seed), "audio_data", uploadAudio, options);
+                    return VariationBatch::readSubmitResponse(stream != nullptr ? stream->readEntireStreamAsString()
+                                                                                : juce::String());
+                } });
+        }
+
+        startVariationBatch(ServiceType::Terry, std::move(variations));
+        updateTerryEnablementSnapshot();
+        return;
+    }
+
+    juce::Component::SafePointer<Gary4juceAudioProcessorEditor> safeThis(this);
+    const auto generationToken = beginGenerationAsyncWork();
+
+    // Create HTTP request in background thread (same pattern as Gary and Jerry)
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Generation, requestUrl, [safeThis, generationToken, uploadAudio, makeRequest, selectedVariation, requestSeed, requestUrl](const HttpClient::CancellationToken&) {
+        if (safeThis == nullptr || !safeThis->isGenerationAsyncWorkCurrent(generationToken)) {
+            DBG("Terry request aborted - generation stopped");
+            return;
+        }
+
+        auto startTime = juce::Time::getCurrentTime();
+        const auto jsonRequest = makeRequest(selectedVariation, requestSeed);
 
         juce::String responseText;
         int statusCode = 0;
 
         try
         {
-            // Use JUCE 8.0.8 pattern: withPOSTData + InputStreamOptions (same as Gary/Jerry)
-            juce::URL postUrl = requestUrl.withPOSTData(jsonString);
-
+            // Audio goes up as a file part; AudioUpload falls back to base64 JSON
             auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                 .withConnectionTimeoutMs(30000)
                 .withExtraHeaders("Content-Type: application/json");
 
-            auto stream = postUrl.createInputStream(options);
+            auto stream = AudioUpload::post(requestUrl, *jsonRequest, "audio_data", uploadAudio, options);
 
             auto requestTime = juce::Time::getCurrentTime() - startTime;
             DBG("Terry HTTP connection established in " + juce::String(requestTime.inMilliseconds()) + "ms");
@@ -448,7 +476,7 @@ void Gary4juceAudioProcessorEditor::undoTerryTransform()
 
     // Create HTTP request in background thread
     juce::Component::SafePointer<Gary4juceAudioProcessorEditor> safeThis(this);
-    juce::Thread::launch([safeThis, sessionId]() {
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Generation, getServiceUrl(ServiceType::Terry, "/api/juce/undo_transform"), [safeThis, sessionId](const HttpClient::CancellationToken&) {
         // REMOVED: Don't check isGenerating for undo operations!
         // Undo operations are not generation operations and should proceed regardless
         // if (!isGenerating) {
@@ -474,8 +502,7 @@ void Gary4juceAudioProcessorEditor::undoTerryTransform()
 
         juce::URL url(safeThis->getServiceUrl(ServiceType::Terry, "/api/juce/undo_transform"));
 
-        juce::String responseText;
-        int statusCode = 0;
+        TerryUndoResult result;
 
         try
         {
@@ -486,42 +513,51 @@ void Gary4juceAudioProcessorEditor::undoTerryTransform()
                 .withConnectionTimeoutMs(15000)  // Shorter timeout for undo - should be quick
                 .withExtraHeaders("Content-Type: application/json");
 
-            auto stream = postUrl.createInputStream(options);
+            auto stream = HttpClient::openStream(postUrl, options);
 
             auto requestTime = juce::Time::getCurrentTime() - startTime;
             DBG("Terry undo HTTP connection established in " + juce::String(requestTime.inMilliseconds()) + "ms");
 
             if (stream != nullptr)
             {
-                responseText = stream->readEntireStreamAsString();
+                // The restored audio goes straight to a temp file as it arrives
+                auto response = JsonAudioStream::read(*stream, { "audio_data" });
 
                 auto totalTime = juce::Time::getCurrentTime() - startTime;
                 DBG("Terry undo HTTP request completed in " + juce::String(totalTime.inMilliseconds()) + "ms");
 
-                statusCode = 200; // Assume success if we got data
+                result.statusCode = 200; // Assume success if we got data
+                result.responded = response.json.isNotEmpty();
+
+                auto responseVar = response.complete ? juce::JSON::parse(response.json) : juce::var();
+                if (auto* responseObj = responseVar.getDynamicObject())
+                {
+                    DBG("Terry undo response: " + response.json);
+
+                    result.validJson = true;
+                    result.success = responseObj->getProperty("success");
+                    result.error = responseObj->getProperty("error").toString();
+                    result.audio = response.audio;
+                }
             }
             else
             {
                 DBG("Failed to create input stream for Terry undo request");
-                responseText = "";
-                statusCode = 0;
             }
         }
         catch (const std::exception& e)
         {
             DBG("Terry undo HTTP request exception: " + juce::String(e.what()));
-            responseText = "";
-            statusCode = 0;
+            result = {};
         }
         catch (...)
         {
             DBG("Unknown Terry undo HTTP request exception");
-            responseText = "";
-            statusCode = 0;
+            result = {};
         }
 
         // Handle response on main thread
-        juce::MessageManager::callAsync([safeThis, responseText, statusCode]() {
+        juce::MessageManager::callAsync([safeThis, result]() {
             if (safeThis == nullptr)
             {
                 DBG("Undo Terry callback aborted");
@@ -534,23 +570,17 @@ void Gary4juceAudioProcessorEditor::undoTerryTransform()
             //     return;
             // }
 
-            if (statusCode == 200 && responseText.isNotEmpty())
+            if (result.statusCode == 200 && result.responded)
             {
-                DBG("Terry undo response: " + responseText);
-
-                // Parse response JSON
-                auto responseVar = juce::JSON::parse(responseText);
-                if (auto* responseObj = responseVar.getDynamicObject())
+                if (result.validJson)
                 {
-                    bool success = responseObj->getProperty("success");
-                    if (success)
+                    if (result.success)
                     {
-                        // Get the restored audio data
-                        auto audioData = responseObj->getProperty("audio_data").toString();
-                        if (audioData.isNotEmpty())
+                        // The restored audio, already decoded to disk
+                        if (result.audio != nullptr)
                         {
                             // Save the restored audio
-                            safeThis->saveGeneratedAudio(audioData);
+                            safeThis->saveGeneratedAudioFile(result.audio);
                             safeThis->showStatusMessage("transform undone - audio restored.", 3000);
                             DBG("Terry undo successful - audio restored");
 
@@ -575,9 +605,8 @@ void Gary4juceAudioProcessorEditor::undoTerryTransform()
                     }
                     else
                     {
-                        auto error = responseObj->getProperty("error").toString();
-                        safeThis->showStatusMessage("undo failed: " + error, 4000);
-                        DBG("Terry undo server error: " + error);
+                        safeThis->showStatusMessage("undo failed: " + result.error, 4000);
+                        DBG("Terry undo server error: " + result.error);
                         safeThis->audioProcessor.setUndoTransformAvailable(true);
                         safeThis->updateTerryEnablementSnapshot();
                         if (safeThis->terryUI)
@@ -597,15 +626,15 @@ void Gary4juceAudioProcessorEditor::undoTerryTransform()
             else
             {
                 juce::String errorMsg;
-                if (statusCode == 0 && safeThis->audioProcessor.getIsUsingLocalhost())
+                if (result.statusCode == 0 && safeThis->audioProcessor.getIsUsingLocalhost())
                 {
                     errorMsg = "cannot connect for undo on localhost - ensure docker compose is running";
                     safeThis->markBackendDisconnectedFromRequestFailure("terry undo request");
                 }
-                else if (statusCode == 0)
+                else if (result.statusCode == 0)
                     errorMsg = "failed to connect for undo on remote backend";
-                else if (statusCode >= 400)
-                    errorMsg = "undo server error (HTTP " + juce::String(statusCode) + ")";
+                else if (result.statusCode >= 400)
+                    errorMsg = "undo server error (HTTP " + juce::String(result.statusCode) + ")";
                 else
                     errorMsg = "empty undo response";
 
@@ -373,7 +373,7 @@ void Gary4juceAudioProcessorEditor::checkForPluginUpdates(bool manual, bool incl
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, currentVersion, skippedVersion, manual, includeSkippedVersion]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Metadata, configuredUpdateManifestUrl(), [asyncAlive, editor, currentVersion, skippedVersion, manual, includeSkippedVersion](const HttpClient::CancellationToken&)
     {
         const auto result = runPluginUpdateCheck(currentVersion, skippedVersion, includeSkippedVersion);
 
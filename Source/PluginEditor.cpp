@@ -12,6 +12,7 @@
 #include "PluginEditorTerryHelpers.h"
 #include "PluginEditorTextHelpers.h"
 #include "./Utils/BarTrim.h"
+#include "./Audio/StreamingResampler.h"
 #include "./Components/Base/CustomComboBox.h"
 
 using plugin_editor_detail::loopTypeIndexToString;
@@ -41,6 +42,7 @@ juce::String Gary4juceAudioProcessorEditor::serializePersistentState() const
     state->setProperty("jerrySubTab", static_cast<int>(jerrySubTab));
     state->setProperty("inputSourceFile", lastDraggedAudioFile.getFullPathName());
     state->setProperty("standaloneBpm", currentStandaloneBpm);
+    state->setProperty("variationsPerSend", variationsPerSend);
 
     state->setProperty("garyPromptDuration", currentPromptDuration);
     state->setProperty("garyModelPath",
@@ -231,6 +233,7 @@ void Gary4juceAudioProcessorEditor::restorePersistentState(const juce::String& j
         readInt("modelTab", static_cast<int>(ModelTab::Jerry))));
     jerrySubTab = static_cast<JerrySubTab>(juce::jlimit(0, 2,
         readInt("jerrySubTab", static_cast<int>(JerrySubTab::SA3))));
+    variationsPerSend = juce::jlimit(1, kMaxVariationsPerSend, readInt("variationsPerSend", variationsPerSend));
     const auto inputSourcePath = readString("inputSourceFile", {});
     if (inputSourcePath.isNotEmpty())
         lastDraggedAudioFile = juce::File(inputSourcePath);
@@ -600,7 +603,10 @@ void Gary4juceAudioProcessorEditor::showGarySettingsMenu()
     {
         compactLayout = 1,
         wideLayout,
-        audioStorage
+        audioStorage,
+        embedAudio,
+        variationsBase = 100,   // + variations per send
+        takesBase = 200         // + take index
     };
 
     juce::PopupMenu menu;
@@ -612,6 +618,28 @@ void Gary4juceAudioProcessorEditor::showGarySettingsMenu()
     menu.addSeparator();
     menu.addItem(audioStorage,
         usingGaryDataFallback ? "audio storage (recovery)..." : "audio storage...");
+    menu.addItem(embedAudio, "keep audio in project", true,
+        audioProcessor.getEmbedAudioInState());
+
+    menu.addSeparator();
+    juce::PopupMenu variationsMenu;
+    for (int count = 1; count <= kMaxVariationsPerSend; ++count)
+        variationsMenu.addItem(variationsBase + count, count == 1 ? "1 (off)" : juce::String(count),
+            true, variationsPerSend == count);
+    menu.addSubMenu("variations per send (gary, terry, sa3)", variationsMenu);
+
+    if (!variationTakes.empty())
+    {
+        juce::PopupMenu takesMenu;
+        for (int i = 0; i < (int)variationTakes.size(); ++i)
+        {
+            const auto& take = variationTakes[(size_t)i].take;
+            takesMenu.addItem(takesBase + i,
+                take.label + (take.seed.isNotEmpty() ? " (seed " + take.seed + ")" : juce::String()),
+                true, i == currentTakeIndex);
+        }
+        menu.addSubMenu("takes", takesMenu);
+    }
 
     juce::Component::SafePointer<Gary4juceAudioProcessorEditor> safeThis(this);
     menu.showMenuAsync(
@@ -629,6 +657,24 @@ void Gary4juceAudioProcessorEditor::showGarySettingsMenu()
                 safeThis->setEditorLayoutMode(EditorLayoutMode::Wide);
             else if (result == audioStorage)
                 safeThis->showStorageSettings();
+            else if (result == embedAudio)
+            {
+                const bool embed = !safeThis->audioProcessor.getEmbedAudioInState();
+                safeThis->audioProcessor.setEmbedAudioInState(embed);
+                safeThis->showStatusMessage(embed
+                    ? "recording and output will be saved inside the project"
+                    : "project will reference audio in the gary4juce folder only", 3000);
+            }
+            else if (result >= takesBase)
+                safeThis->auditionTake(result - takesBase, true);
+            else if (result > variationsBase)
+            {
+                safeThis->variationsPerSend = juce::jlimit(1, kMaxVariationsPerSend, result - variationsBase);
+                safeThis->persistEditorState();
+                safeThis->showStatusMessage(safeThis->variationsPerSend > 1
+                    ? juce::String(safeThis->variationsPerSend) + " variations per send"
+                    : "one variation per send", 2000);
+            }
         });
 }
 
@@ -1634,6 +1680,26 @@ Gary4juceAudioProcessorEditor::Gary4juceAudioProcessorEditor(Gary4juceAudioProce
     stopOutputButton.setEnabled(false); // Initially disabled
     addAndMakeVisible(stopOutputButton);
 
+    // Loop output in time with the host
+    loopOutputButton.setButtonText("loop");
+    loopOutputButton.setButtonStyle(CustomButton::ButtonStyle::Standard);
+    loopOutputButton.setTooltip("loop the output locked to the host's bars and tempo");
+    loopOutputButton.setClickingTogglesState(true);
+    loopOutputButton.setToggleState(audioProcessor.getIsLoopingOutput(), juce::dontSendNotification);
+    loopOutputButton.onClick = [this]()
+    {
+        const bool shouldLoop = loopOutputButton.getToggleState();
+        if (!audioProcessor.setOutputLoopPlayback(shouldLoop))
+        {
+            loopOutputButton.setToggleState(false, juce::dontSendNotification);
+            showStatusMessage("output is too long to loop", 2500);
+            return;
+        }
+
+        showStatusMessage(shouldLoop ? "looping output with the host" : "loop off", 1500);
+    };
+    addAndMakeVisible(loopOutputButton);
+
     // Crop button - simple approach with custom drawing
     cropIcon = IconFactory::createCropIcon();
     
@@ -1799,6 +1865,10 @@ Gary4juceAudioProcessorEditor::Gary4juceAudioProcessorEditor(Gary4juceAudioProce
         DBG("No output audio file found");
     }
 
+    // Audio embedded in the project state wins over whatever the shared data
+    // folder currently holds.
+    installRestoredEmbeddedAudio();
+
 
     
     // 3. CRITICAL: Restore Terry audio source selection
@@ -1909,6 +1979,9 @@ void Gary4juceAudioProcessorEditor::stopAllBackgroundOperations()
 
     // Stop polling and generation immediately
     isPolling = false;
+    progressStream.reset();
+    dariusProgressStream.reset();
+    variationBatch.reset();
     isGenerating = false;
     continueInProgress = false;
 
@@ -1956,6 +2029,10 @@ Gary4juceAudioProcessorEditor::~Gary4juceAudioProcessorEditor()
     audioProcessor.removeChangeListener(this);
 
     stopAllBackgroundOperations();
+
+    // Requests still queued would only find a dead editor; running ones see
+    // the cancellation and return early.
+    audioProcessor.getHttpClient().cancelAll();
     
     // Ensure tooltip window is cleaned up first
     tooltipWindow.reset();
@@ -2209,22 +2286,22 @@ void Gary4juceAudioProcessorEditor::timerCallback()
     // Track BPM for carey requests
     currentCareyBpm = currentBPM;
 
-    // Darius progress polling cadence (every ~250ms)
-    if (dariusIsPollingProgress) {
-        if (++dariusProgressPollTick >= 5) { // 5 * 50ms = 250ms
-            dariusProgressPollTick = 0;
-            pollDariusProgress();
-        }
-    }
+    // Status the backends push between polls
+    drainProgressStreams();
 
-    maybeShowDeferredUpdatePrompt();
+    // Variations of a batch send, and the takes they finish as
+    serviceVariationBatch();
 
-    // Check playback status every timer tick when playing (every 50ms for smooth cursor)
-    if (isPlayingOutput || isPlayingInput)
+    // Darius progress polling, unless it's being pushed
+    if (dariusIsPollingProgress
+        && (dariusProgressStream == nullptr || !dariusProgressStream->isPushing())
+        && dariusPollScheduler.isDue())
     {
-        checkPlaybackStatus();
+        pollDariusProgress();
     }
 
+    maybeShowDeferredUpdatePrompt();
+
     // Smooth progress animation for generation (every 50ms for smooth animation)
     if (isGenerating && smoothProgressAnimation)
     {
@@ -2243,7 +2320,7 @@ void Gary4juceAudioProcessorEditor::timerCallback()
         {
             flashCounter = 0;
             connectionFlashState = !connectionFlashState;
-            repaint(); // Repaint to show flash change
+            repaint(connectionStatusArea); // Only the status text flashes
         }
     }
 
@@ -2262,16 +2339,13 @@ void Gary4juceAudioProcessorEditor::timerCallback()
         localHealthPollCounter = 0;
     }
 
-    // Poll backend every 60 timer ticks (every 3 seconds since timer runs every 50ms)
-    static int pollCounter = 0;
+    // Poll the backend when the scheduler says so. While status is being
+    // pushed a poll only backs it up.
     if (isPolling)
     {
-        pollCounter++;
-        if (pollCounter >= 60) // 60 * 50ms = 3 seconds - reasonable backend polling
-        {
-            pollCounter = 0;
+        const bool statusPushed = progressStream != nullptr && progressStream->isPushing();
+        if (pollScheduler.isDue(statusPushed ? StatusFeed::backupPollMs : 0))
             pollForResults();
-        }
     }
 }
 
@@ -2281,8 +2355,9 @@ void Gary4juceAudioProcessorEditor::updateSmoothProgress()
     auto currentTime = juce::Time::getCurrentTime().toMilliseconds();
     auto timeSinceUpdate = currentTime - lastProgressUpdateTime;
 
-    // Animate over 3 seconds (time between polls)
-    const int animationDuration = 3000; // 3 seconds
+    // Animate over the time until the next poll
+    const auto& scheduler = dariusIsPollingProgress ? dariusPollScheduler : pollScheduler;
+    const int animationDuration = juce::jlimit(250, 3000, scheduler.getIntervalMs());
 
     if (timeSinceUpdate < animationDuration && targetProgress > lastKnownProgress)
     {
@@ -2298,28 +2373,87 @@ void Gary4juceAudioProcessorEditor::updateSmoothProgress()
             (int)(easedProgress * (targetProgress - lastKnownProgress));
 
         generationProgress = juce::jlimit(0, 100, interpolatedProgress);
-        repaint(); // Smooth visual update
+        repaint(outputWaveformArea); // Smooth visual update
     }
     else if (timeSinceUpdate >= animationDuration)
     {
         // Animation complete - set to exact target
         generationProgress = targetProgress;
         smoothProgressAnimation = false;
-        repaint();
+        repaint(outputWaveformArea);
     }
 }
 
+// Brings the input waveform's peak summary up to date from the processor's
+// feed. Only buckets recorded since the last call are added; a replaced
+// buffer, or buckets the feed dropped while full, is rebuilt from a locked
+// snapshot.
+void Gary4juceAudioProcessorEditor::updateInputPeaks()
+{
+    auto& feed = audioProcessor.getRecordingPeakFeed();
+    const auto dropped = feed.getNumDropped();
+    bool outOfStep = dropped != inputPeaksDropped;
+    inputPeaksDropped = dropped;
+
+    feed.drain([this, &outOfStep](const RecordingPeakFeed::Bucket& bucket)
+    {
+        if (outOfStep || bucket.revision < inputPeaksRevision)
+            return;
+
+        // First bucket of a new take
+        if (bucket.revision > inputPeaksRevision && bucket.startSample == 0)
+        {
+            inputPeaks.reset();
+            inputPeaksRevision = bucket.revision;
+        }
+
+        // Already covered by a snapshot
+        if (bucket.revision == inputPeaksRevision && bucket.startSample < inputPeaks.getNumSamples())
+            return;
+
+        if (bucket.revision != inputPeaksRevision || bucket.startSample != inputPeaks.getNumSamples()
+            || inputPeaks.getNumSamples() % PeakPyramid::baseBlockSamples != 0)
+        {
+            outOfStep = true;
+            return;
+        }
+
+        inputPeaks.appendBucket(bucket.min, bucket.max, bucket.sumSquares, bucket.numSamples);
+    });
+
+    if (outOfStep || audioProcessor.getRecordingContentRevision() != inputPeaksRevision)
+        inputPeaksRevision = audioProcessor.summariseRecording(inputPeaks);
+}
+
 void Gary4juceAudioProcessorEditor::updateRecordingStatus()
 {
     bool wasRecording = isRecording;
     float wasProgress = recordingProgress;
     int wasSamples = recordedSamples;
     bool wasConnected = isConnected; // Add this to track connection changes
+    const double wasDisplayDuration = getInputWaveformDisplayDuration();
+    const auto wasPeaksRevision = inputPeaksRevision;
 
     // Get current status from processor
     isRecording = audioProcessor.isRecording();
     recordingProgress = audioProcessor.getRecordingProgress();
     recordedSamples = audioProcessor.getRecordedSamples();
+    updateInputPeaks();
+
+    // The recording journal pads any input it had to drop with silence; say
+    // so, since a take with holes in it is worth redoing.
+    const int overflowCount = audioProcessor.getRecordingOverflowCount();
+    const juce::int64 droppedSamples = audioProcessor.getRecordingDroppedSamples();
+    if (overflowCount > lastRecordingOverflowCount && droppedSamples > lastRecordingDroppedSamples)
+    {
+        const double lostMs = 1000.0 * (double)(droppedSamples - lastRecordingDroppedSamples)
+            / juce::jmax(1.0, audioProcessor.getCurrentSampleRate());
+        showStatusMessage("recording fell behind - " + juce::String(lostMs, 0) + "ms replaced with silence", 5000);
+        DBG("Recording journal overflow #" + juce::String(overflowCount) + ", peak fill "
+            + juce::String(audioProcessor.getRecordingJournalPeakFill() * 100.0f, 0) + "%");
+    }
+    lastRecordingOverflowCount = overflowCount;
+    lastRecordingDroppedSamples = droppedSamples;
 
     const bool canAuditionInput = recordedSamples > 0 && !isRecording;
     playInputButton.setEnabled(canAuditionInput);
@@ -2365,16 +2499,42 @@ void Gary4juceAudioProcessorEditor::updateRecordingStatus()
         {
             hasStatusMessage = false;
             statusMessage = "";
+            repaint(inputStatusArea);
         }
     }
 
-    // Repaint if status changed
+    // Repaint if status changed. A take that has only grown needs just its
+    // new columns; a start or stop, a replaced buffer or the display
+    // rescaling past 30 seconds redraws everything.
+    const double displayDuration = getInputWaveformDisplayDuration();
     if (wasRecording != isRecording ||
-        std::abs(wasProgress - recordingProgress) > 0.01f ||
-        wasSamples != recordedSamples)
+        wasPeaksRevision != inputPeaksRevision ||
+        wasDisplayDuration != displayDuration ||
+        recordedSamples < wasSamples)
     {
         repaint();
     }
+    else if (recordedSamples > wasSamples)
+    {
+        const double samplesPerSecond = juce::jmax(1.0, audioProcessor.getCurrentSampleRate());
+        const int waveWidth = juce::jmax(1, waveformArea.getWidth() - 2);
+        const auto columnFor = [&](int samples)
+        {
+            return waveformArea.getX() + 1 + (int)(((double)samples / samplesPerSecond / displayDuration) * waveWidth);
+        };
+
+        // Wide enough for the line thickening either side and the recording
+        // indicator at both the old and new ends
+        const int left = columnFor(wasSamples) - 2;
+        const int right = columnFor(recordedSamples) + 3;
+        repaint(juce::Rectangle<int>(left, waveformArea.getY(), right - left, waveformArea.getHeight())
+                    .getIntersection(waveformArea));
+        repaint(inputInfoArea);     // Recorded length and sample count
+    }
+    else if (std::abs(wasProgress - recordingProgress) > 0.01f)
+    {
+        repaint(waveformArea);
+    }
 }
 
 void Gary4juceAudioProcessorEditor::showStatusMessage(const juce::String& message, int durationMs)
@@ -2388,16 +2548,16 @@ void Gary4juceAudioProcessorEditor::showStatusMessage(const juce::String& messag
 
 void Gary4juceAudioProcessorEditor::drawWaveform(juce::Graphics& g, const juce::Rectangle<int>& area)
 {
-    // Black background
-    g.setColour(juce::Colours::black);
-    g.fillRect(area);
-
-    // Draw border
-    g.setColour(juce::Colour(0x40, 0x40, 0x40));
-    g.drawRect(area, 1);
-
     if (recordedSamples <= 0)
     {
+        // Black background
+        g.setColour(juce::Colours::black);
+        g.fillRect(area);
+
+        // Draw border
+        g.setColour(juce::Colour(0x40, 0x40, 0x40));
+        g.drawRect(area, 1);
+
         // Show "waiting" state with different message based on plugin mode
         g.setFont(juce::FontOptions(14.0f));
         g.setColour(juce::Colours::darkgrey);
@@ -2420,9 +2580,121 @@ void Gary4juceAudioProcessorEditor::drawWaveform(juce::Graphics& g, const juce::
         return;
     }
 
-    // Get the recording buffer and validate it
-    const auto& recordingBuffer = audioProcessor.getRecordingBuffer();
-    if (recordingBuffer.getNumSamples() <= 0 || recordingBuffer.getNumChannels() <= 0)
+    // Drawn only from the peak summary, never from the recording buffer the
+    // writer thread is filling. The timer keeps the summary current; paint
+    // only reads it.
+    const int waveWidth = juce::jmax(1, area.getWidth() - 2); // Account for border, minimum 1
+
+    // FIXED: Use actual sample rate from processor instead of hardcoded 44100
+    const double currentSampleRate = audioProcessor.getCurrentSampleRate();
+
+    // Time calculations — zoom to fit: show 30s window until content exceeds it, then full buffer
+    const double recordedDuration = juce::jmax(0.0, (double)recordedSamples / currentSampleRate);
+    const double totalDuration = getInputWaveformDisplayDuration();
+    const int recordedPixels = juce::jmax(0, juce::jmin(waveWidth, (int)((recordedDuration / totalDuration) * waveWidth)));
+
+    // The columns only change with the take, how much of it is saved and the
+    // zoom; cursor and recording indicator moves just blit the cached body.
+    // Growth is left out of the key: while recording, only the columns from
+    // the previous end onwards are redrawn into the cached image.
+    auto bodyKey = WaveformImageCache::initialKey;
+    bodyKey = WaveformImageCache::combine(bodyKey, (double)inputPeaksRevision);
+    bodyKey = WaveformImageCache::combine(bodyKey, (double)savedSamples);
+    bodyKey = WaveformImageCache::combine(bodyKey, totalDuration);
+
+    const WaveformImageCache::RenderFunction renderBody = [this](juce::Graphics& bodyGraphics, const juce::Rectangle<int>& bodyArea)
+    {
+        drawInputWaveformBody(bodyGraphics, bodyArea);
+    };
+
+    const int peakSamples = inputPeaks.getNumSamples();
+    if (bodyKey == inputBodyKey)
+    {
+        if (recordedSamples < inputBodyRecordedSamples || peakSamples < inputBodyPeakSamples)
+        {
+            inputWaveformCache.invalidate();
+        }
+        else if (recordedSamples != inputBodyRecordedSamples || peakSamples != inputBodyPeakSamples)
+        {
+            // The last drawn column may have been partial and its neighbours
+            // thicken into it, so start a couple of columns back
+            const double samplesPerColumn = totalDuration * currentSampleRate / waveWidth;
+            const int firstColumn = (int)(juce::jmin(inputBodyRecordedSamples, inputBodyPeakSamples) / samplesPerColumn) - 2;
+            const int left = area.getX() + 1 + juce::jmax(0, firstColumn);
+            inputWaveformCache.redraw(area.withLeft(left).withRight(area.getX() + 1 + recordedPixels + 2), renderBody);
+        }
+    }
+
+    inputBodyKey = bodyKey;
+    inputBodyRecordedSamples = recordedSamples;
+    inputBodyPeakSamples = peakSamples;
+
+    inputWaveformCache.draw(g, area, bodyKey, renderBody);
+
+    // Early exit if nothing to draw
+    if (inputPeaks.isEmpty() || recordedPixels <= 0)
+        return;
+
+    // Add recording indicator if currently recording
+    if (isRecording && recordedPixels > 0)
+    {
+        // Animated recording line at the current position
+        g.setColour(juce::Colours::white.withAlpha(0.8f));
+        const int recordingX = area.getX() + 1 + recordedPixels;
+        if (recordingX >= area.getX() && recordingX <= area.getRight())
+        {
+            g.drawVerticalLine(recordingX, (float)area.getY(), (float)area.getBottom());
+
+            // Optional: pulsing effect
+            auto time = juce::Time::getCurrentTime().toMilliseconds();
+            float pulse = (std::sin(time * 0.01f) + 1.0f) * 0.5f; // 0 to 1
+            g.setColour(juce::Colours::red.withAlpha(0.3f + pulse * 0.4f));
+            g.fillRect(recordingX, area.getY(), 2, area.getHeight());
+        }
+    }
+
+    // The input player uses the same white cursor treatment as the output
+    // player, mapped to the input waveform's current time scale.
+    if ((isPlayingInput || isPausedInput) && inputPlaybackDuration > 0.0)
+    {
+        const double progressPercent = juce::jlimit(0.0, 1.0,
+            currentInputPlaybackPosition / totalDuration);
+        const int cursorX = area.getX() + 1 + (int)(progressPercent * waveWidth);
+
+        g.setColour(juce::Colours::white.withAlpha(isPlayingInput ? 0.9f : 0.7f));
+        g.drawVerticalLine(cursorX, (float)area.getY() + 1, (float)area.getBottom() - 1);
+        g.setColour(juce::Colours::white.withAlpha(0.3f));
+        if (cursorX > area.getX() + 1)
+            g.drawVerticalLine(cursorX - 1, (float)area.getY() + 1, (float)area.getBottom() - 1);
+        if (cursorX < area.getRight() - 1)
+            g.drawVerticalLine(cursorX + 1, (float)area.getY() + 1, (float)area.getBottom() - 1);
+    }
+
+    // The same range editor is available in plugin and standalone builds.
+    if (recordedSamples > 0 && !isRecording)
+    {
+        // Draw hint text at bottom-right of waveform
+        g.setFont(juce::FontOptions(13.0f));
+        g.setColour(juce::Colours::lightgrey.withAlpha(0.8f));
+        // Create hint area from bottom-right of waveform without modifying original area
+        auto hintArea = juce::Rectangle<int>(area.getX(), area.getBottom() - 15, area.getWidth() - 4, 15);
+        g.drawText("double-click to select range", hintArea, juce::Justification::centredRight);
+    }
+}
+
+// Background, border and waveform columns of the input display; everything
+// drawWaveform caches. Overlays that move on their own are drawn over it.
+void Gary4juceAudioProcessorEditor::drawInputWaveformBody(juce::Graphics& g, const juce::Rectangle<int>& area)
+{
+    // Black background
+    g.setColour(juce::Colours::black);
+    g.fillRect(area);
+
+    // Draw border
+    g.setColour(juce::Colour(0x40, 0x40, 0x40));
+    g.drawRect(area, 1);
+
+    if (inputPeaks.isEmpty())
         return;
 
     // Safe calculations with proper bounds checking
@@ -2430,10 +2702,7 @@ void Gary4juceAudioProcessorEditor::drawWaveform(juce::Graphics& g, const juce::
     const int waveHeight = juce::jmax(1, area.getHeight() - 2);
     const int centerY = area.getCentreY();
 
-    // FIXED: Use actual sample rate from processor instead of hardcoded 44100
     const double currentSampleRate = audioProcessor.getCurrentSampleRate();
-
-    // Time calculations — zoom to fit: show 30s window until content exceeds it, then full buffer
     const double recordedDuration = juce::jmax(0.0, (double)recordedSamples / currentSampleRate);
     const double savedDuration = juce::jmax(0.0, (double)savedSamples / currentSampleRate);
     const double totalDuration = getInputWaveformDisplayDuration();
@@ -2446,37 +2715,34 @@ void Gary4juceAudioProcessorEditor::drawWaveform(juce::Graphics& g, const juce::
     if (recordedPixels <= 0)
         return;
 
-    // Safe samples per pixel calculation - avoid division by zero
-    const int samplesPerPixel = (recordedPixels > 0) ? juce::jmax(1, recordedSamples / recordedPixels) : 1;
+    // Columns are fixed by the zoom rather than by how much has been
+    // recorded, so a growing take leaves the ones already drawn unchanged
+    const int samplesPerPixel = juce::jmax(1, (int)(totalDuration * currentSampleRate / waveWidth));
+
+    // Only columns that reach the clip region; a partial redraw of the
+    // cached image covers just the newly recorded end
+    const auto clip = g.getClipBounds();
+    const int firstVisible = juce::jmax(0, clip.getX() - (area.getX() + 1) - 2);
+    const int endVisible = clip.getRight() - (area.getX() + 1) + 2;
 
     // Draw saved portion (solid red)
     if (savedPixels > 0)
     {
         g.setColour(juce::Colours::red);
 
-        for (int x = 0; x < savedPixels; ++x)
+        for (int x = firstVisible; x < juce::jmin(savedPixels, endVisible); ++x)
         {
             const int startSample = x * samplesPerPixel;
             const int endSample = juce::jmin(startSample + samplesPerPixel, savedSamples);
 
-            if (endSample > startSample && startSample < recordingBuffer.getNumSamples())
+            if (endSample > startSample)
             {
                 // Find min/max in this pixel's worth of samples
                 float minVal = 0.0f, maxVal = 0.0f;
 
-                for (int sample = startSample; sample < endSample && sample < recordingBuffer.getNumSamples(); ++sample)
-                {
-                    // Average across channels safely
-                    float sampleValue = 0.0f;
-                    for (int ch = 0; ch < recordingBuffer.getNumChannels(); ++ch)
-                    {
-                        sampleValue += recordingBuffer.getSample(ch, sample);
-                    }
-                    sampleValue /= recordingBuffer.getNumChannels();
-
-                    minVal = juce::jmin(minVal, sampleValue);
-                    maxVal = juce::jmax(maxVal, sampleValue);
-                }
+                const auto peak = inputPeaks.getPeak(startSample, endSample);
+                minVal = peak.min;
+                maxVal = peak.max;
 
                 // Scale to display area with clamping
                 const int minY = juce::jlimit(area.getY(), area.getBottom(),
@@ -2519,29 +2785,19 @@ void Gary4juceAudioProcessorEditor::drawWaveform(juce::Graphics& g, const juce::
     {
         g.setColour(juce::Colours::red.withAlpha(0.5f));
 
-        for (int x = savedPixels; x < recordedPixels; ++x)
+        for (int x = juce::jmax(savedPixels, firstVisible); x < juce::jmin(recordedPixels, endVisible); ++x)
         {
             const int startSample = x * samplesPerPixel;
             const int endSample = juce::jmin(startSample + samplesPerPixel, recordedSamples);
 
-            if (endSample > startSample && startSample < recordingBuffer.getNumSamples())
+            if (endSample > startSample)
             {
                 // Find min/max in this pixel's worth of samples
                 float minVal = 0.0f, maxVal = 0.0f;
 
-                for (int sample = startSample; sample < endSample && sample < recordingBuffer.getNumSamples(); ++sample)
-                {
-                    // Average across channels safely
-                    float sampleValue = 0.0f;
-                    for (int ch = 0; ch < recordingBuffer.getNumChannels(); ++ch)
-                    {
-                        sampleValue += recordingBuffer.getSample(ch, sample);
-                    }
-                    sampleValue /= recordingBuffer.getNumChannels();
-
-                    minVal = juce::jmin(minVal, sampleValue);
-                    maxVal = juce::jmax(maxVal, sampleValue);
-                }
+                const auto peak = inputPeaks.getPeak(startSample, endSample);
+                minVal = peak.min;
+                maxVal = peak.max;
 
                 // Scale to display area with clamping
                 const int minY = juce::jlimit(area.getY(), area.getBottom(),
@@ -2578,52 +2834,6 @@ void Gary4juceAudioProcessorEditor::drawWaveform(juce::Graphics& g, const juce::
             }
         }
     }
-
-    // Add recording indicator if currently recording
-    if (isRecording && recordedPixels > 0)
-    {
-        // Animated recording line at the current position
-        g.setColour(juce::Colours::white.withAlpha(0.8f));
-        const int recordingX = area.getX() + 1 + recordedPixels;
-        if (recordingX >= area.getX() && recordingX <= area.getRight())
-        {
-            g.drawVerticalLine(recordingX, (float)area.getY(), (float)area.getBottom());
-
-            // Optional: pulsing effect
-            auto time = juce::Time::getCurrentTime().toMilliseconds();
-            float pulse = (std::sin(time * 0.01f) + 1.0f) * 0.5f; // 0 to 1
-            g.setColour(juce::Colours::red.withAlpha(0.3f + pulse * 0.4f));
-            g.fillRect(recordingX, area.getY(), 2, area.getHeight());
-        }
-    }
-
-    // The input player uses the same white cursor treatment as the output
-    // player, mapped to the input waveform's current time scale.
-    if ((isPlayingInput || isPausedInput) && inputPlaybackDuration > 0.0)
-    {
-        const double progressPercent = juce::jlimit(0.0, 1.0,
-            currentInputPlaybackPosition / totalDuration);
-        const int cursorX = area.getX() + 1 + (int)(progressPercent * waveWidth);
-
-        g.setColour(juce::Colours::white.withAlpha(isPlayingInput ? 0.9f : 0.7f));
-        g.drawVerticalLine(cursorX, (float)area.getY() + 1, (float)area.getBottom() - 1);
-        g.setColour(juce::Colours::white.withAlpha(0.3f));
-        if (cursorX > area.getX() + 1)
-            g.drawVerticalLine(cursorX - 1, (float)area.getY() + 1, (float)area.getBottom() - 1);
-        if (cursorX < area.getRight() - 1)
-            g.drawVerticalLine(cursorX + 1, (float)area.getY() + 1, (float)area.getBottom() - 1);
-    }
-
-    // The same range editor is available in plugin and standalone builds.
-    if (recordedSamples > 0 && !isRecording)
-    {
-        // Draw hint text at bottom-right of waveform
-        g.setFont(juce::FontOptions(13.0f));
-        g.setColour(juce::Colours::lightgrey.withAlpha(0.8f));
-        // Create hint area from bottom-right of waveform without modifying original area
-        auto hintArea = juce::Rectangle<int>(area.getX(), area.getBottom() - 15, area.getWidth() - 4, 15);
-        g.drawText("double-click to select range", hintArea, juce::Justification::centredRight);
-    }
 }
 
 void Gary4juceAudioProcessorEditor::saveRecordingBuffer()
@@ -2667,13 +2877,22 @@ void Gary4juceAudioProcessorEditor::saveRecordingBuffer()
 
 void Gary4juceAudioProcessorEditor::startPollingForResults(const juce::String& sessionId)
 {
+    // A single result replaces whatever takes a batch left behind
+    clearVariationTakes();
+
     audioProcessor.setCurrentSessionId(sessionId);
+    pendingGenerationBpm = getGenerationTempo();
     isPolling = true;
     isGenerating = true;
     pollInFlight.store(false, std::memory_order_release);
     generationProgress = 0;
     resetStallDetection();
     pollingStartTimeMs = juce::Time::getCurrentTime().toMilliseconds();
+    pollScheduler.start();
+
+    // Backends that push status make most of the polls unnecessary
+    progressStream = std::make_unique<ProgressStream>(getPollStatusUrl(sessionId), juce::StringArray { "audio_data" });
+
     updateAllGenerationButtonStates();
     repaint(); // Start showing progress visualization
     DBG("Started polling for session: " + sessionId);
@@ -2682,6 +2901,7 @@ void Gary4juceAudioProcessorEditor::startPollingForResults(const juce::String& s
 void Gary4juceAudioProcessorEditor::stopPolling()
 {
     isPolling = false;
+    progressStream.reset();
     invalidateGenerationAsyncWork();
     
     DBG("Stopped polling - ongoing requests should abort");
@@ -2702,10 +2922,8 @@ void Gary4juceAudioProcessorEditor::pollForResults()
     if (pollInFlight.exchange(true))
         return;
 
-    // Optional: if you have a very fast poll timer, add a micro-backoff while warming
-    const bool softBackoff = withinWarmup || isCurrentlyQueued;
-    if (softBackoff)
-        juce::Thread::sleep(60); // tiny spacing to avoid hammering during cold start
+    // Warmup and queueing back off through the scheduler
+    pollScheduler.notePolled();
 
     // Only trip �stall� when not warming up
     if (!withinWarmup && checkForGenerationStall())
@@ -2716,27 +2934,14 @@ void Gary4juceAudioProcessorEditor::pollForResults()
     }
 
     const auto generationToken = currentGenerationAsyncToken();
-    const auto activeOperation = getActiveOp();
     const bool warmupSnapshot = withinWarmup;
     const bool queuedSnapshot = isCurrentlyQueued;
     const bool generatingSnapshot = isGenerating;
     const int connectionTimeoutMs = warmupSnapshot ? 4000 : 8000;
-    const juce::URL pollUrl = [&]() {
-        if (activeOperation == ActiveOp::SA3Generate
-            || activeOperation == ActiveOp::SA3Transform
-            || activeOperation == ActiveOp::SA3Continue)
-            return juce::URL(getServiceUrl(ServiceType::SA3, "/poll_status/" + sessionId));
-        if (activeOperation == ActiveOp::FoundationGenerate)
-            return juce::URL(getServiceUrl(ServiceType::Foundation, "/poll_status/" + sessionId));
-        if (activeOperation == ActiveOp::CareyGenerate)
-            return juce::URL(getServiceUrl(ServiceType::Carey, "/poll_status/" + sessionId));
-        if (activeOperation == ActiveOp::TerryTransform)
-            return juce::URL(getServiceUrl(ServiceType::Terry, "/api/juce/poll_status/" + sessionId));
-        return juce::URL(getServiceUrl(ServiceType::Gary, "/api/juce/poll_status/" + sessionId));
-    }();
+    const juce::URL pollUrl = getPollStatusUrl(sessionId);
     juce::Component::SafePointer<Gary4juceAudioProcessorEditor> safeThis(this);
 
-    juce::Thread::launch([safeThis, generationToken, sessionId, pollUrl, connectionTimeoutMs, warmupSnapshot, queuedSnapshot, generatingSnapshot]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Polling, pollUrl, [safeThis, generationToken, sessionId, pollUrl, connectionTimeoutMs, warmupSnapshot, queuedSnapshot, generatingSnapshot](const HttpClient::CancellationToken&)
         {
             auto clearInFlight = [safeThis]()
                 {
@@ -2764,7 +2969,7 @@ void Gary4juceAudioProcessorEditor::pollForResults()
                     .withStatusCode(&httpStatus);
 
                 // Attempt #1
-                std::unique_ptr<juce::InputStream> stream(pollUrl.createInputStream(options));
+                std::unique_ptr<juce::InputStream> stream(HttpClient::openStream(pollUrl, options));
 
                 // If we didn�t get a stream while warming, quick retry once
                 if (stream == nullptr && (warmupSnapshot || queuedSnapshot || generatingSnapshot))
@@ -2772,21 +2977,26 @@ void Gary4juceAudioProcessorEditor::pollForResults()
                     DBG("Polling: null stream during warmup/active; quick retry");
 
                     // Move-assign the new unique_ptr result into our existing one
-                    auto retryStream = pollUrl.createInputStream(options); // returns std::unique_ptr<InputStream>
+                    auto retryStream = HttpClient::openStream(pollUrl, options); // returns std::unique_ptr<InputStream>
                     if (retryStream)
-                        stream = std::move(retryStream); // or simply: stream = pollUrl.createInputStream(options);
+                        stream = std::move(retryStream);
                 }
 
                 if (stream != nullptr)
                 {
-                    const auto responseText = stream->readEntireStreamAsString();
+                    // Completed polls carry the audio as base64; it is decoded
+                    // to disk here and never reaches the message thread as text.
+                    // The rest of the status is parsed here too.
+                    auto response = JsonAudioStream::read(*stream, { "audio_data" });
+                    const auto pollStatus = parsePollStatus(response.complete ? response.json : juce::String());
+                    const auto receivedAudio = response.complete ? response.audio : nullptr;
 
                     if (safeThis != nullptr)
                         safeThis->lastGoodPollMs = juce::Time::getCurrentTime().toMilliseconds();
 
                     clearInFlight();
 
-                    juce::MessageManager::callAsync([safeThis, generationToken, responseText]()
+                    juce::MessageManager::callAsync([safeThis, generationToken, pollStatus, receivedAudio]()
                         {
                             if (safeThis == nullptr || !safeThis->isGenerationAsyncWorkCurrent(generationToken) || !safeThis->isPolling)
                             {
@@ -2794,7 +3004,7 @@ void Gary4juceAudioProcessorEditor::pollForResults()
                                 return;
                             }
 
-                            safeThis->handlePollingResponse(responseText);
+                            safeThis->handlePollingResponse(pollStatus, receivedAudio);
                         });
                     return;
                 }
@@ -2898,8 +3108,124 @@ void Gary4juceAudioProcessorEditor::pollForResults()
         });
 }
 
+juce::URL Gary4juceAudioProcessorEditor::getPollStatusUrl(const juce::String& sessionId) const
+{
+    const auto activeOperation = getActiveOp();
+
+    if (activeOperation == ActiveOp::SA3Generate
+        || activeOperation == ActiveOp::SA3Transform
+        || activeOperation == ActiveOp::SA3Continue)
+        return juce::URL(getServiceUrl(ServiceType::SA3, "/poll_status/" + sessionId));
+    if (activeOperation == ActiveOp::FoundationGenerate)
+        return juce::URL(getServiceUrl(ServiceType::Foundation, "/poll_status/" + sessionId));
+    if (activeOperation == ActiveOp::CareyGenerate)
+        return juce::URL(getServiceUrl(ServiceType::Carey, "/poll_status/" + sessionId));
+    if (activeOperation == ActiveOp::TerryTransform)
+        return juce::URL(getServiceUrl(ServiceType::Terry, "/api/juce/poll_status/" + sessionId));
+    return juce::URL(getServiceUrl(ServiceType::Gary, "/api/juce/poll_status/" + sessionId));
+}
+
+// Hands pushed statuses to the same handlers the polls use. When a stream
+// closes, polling (which never stopped) simply takes over again.
+void Gary4juceAudioProcessorEditor::drainProgressStreams()
+{
+    ProgressStream::Event event;
+
+    while (progressStream != nullptr && isPolling && progressStream->popEvent(event))
+    {
+        lastGoodPollMs = juce::Time::getCurrentTime().toMilliseconds();
+        handlePollingResponse(readPollStatus(event.status), event.audio);
+    }
+
+    if (progressStream != nullptr && (!isPolling || progressStream->hasEnded()))
+    {
+        const bool dropped = progressStream->hasPushed();
+        progressStream.reset();
+
+        // Don't leave a gap of up to a full backup interval
+        if (isPolling && dropped)
+            pollForResults();
+    }
+
+    while (dariusProgressStream != nullptr && dariusIsPollingProgress && dariusProgressStream->popEvent(event))
+    {
+        if (auto* obj = event.status.getDynamicObject())
+        {
+            const juce::var pctVar = obj->getProperty(juce::Identifier("percent"));
+            applyDariusProgress(pctVar.isVoid() ? 0 : (int)pctVar, obj->getProperty(juce::Identifier("stage")).toString());
+        }
+    }
+
+    if (dariusProgressStream != nullptr && (!dariusIsPollingProgress || dariusProgressStream->hasEnded()))
+        dariusProgressStream.reset();
+}
+
+Gary4juceAudioProcessorEditor::PollStatus Gary4juceAudioProcessorEditor::parsePollStatus(const juce::String& responseText)
+{
+    if (responseText.isEmpty())
+        return {};
+
+    try
+    {
+        return readPollStatus(juce::JSON::parse(responseText));
+    }
+    catch (...)
+    {
+        PollStatus status;
+        status.received = true;
+        return status;
+    }
+}
+
+// Runs on whichever thread received the status; touches nothing but the var.
+Gary4juceAudioProcessorEditor::PollStatus Gary4juceAudioProcessorEditor::readPollStatus(const juce::var& response)
+{
+    PollStatus status;
+    status.received = !response.isVoid();
+
+    auto* responseObj = response.getDynamicObject();
+    if (responseObj == nullptr)
+        return status;
+
+    status.parsed = true;
+    status.success = responseObj->getProperty("success");
+    status.error = responseObj->getProperty("error").toString();
+
+    // Some backends return success:false with a descriptive error while the model weights
+    // are being downloaded/loaded on first use.
+    const auto errorMsg = status.error.toLowerCase();
+    status.errorLooksLikeWarmup =
+        errorMsg.contains("download") ||
+        errorMsg.contains("downloading") ||
+        errorMsg.contains("loading model") ||
+        errorMsg.contains("loading weights") ||
+        errorMsg.contains("warmup") ||
+        errorMsg.contains("warming") ||
+        errorMsg.contains("huggingface") ||
+        errorMsg.contains("initializing");
+
+    status.generationInProgress = responseObj->getProperty("generation_in_progress");
+    status.transformInProgress = responseObj->getProperty("transform_in_progress");
+    status.hasGenerationSeed = responseObj->hasProperty("generation_seed");
+    status.generationSeed = responseObj->getProperty("generation_seed").toString();
+    status.progress = responseObj->getProperty("progress");
+    status.status = responseObj->getProperty("status").toString();
+
+    if (auto* queueStatusObj = responseObj->getProperty("queue_status").getDynamicObject())
+    {
+        status.hasQueueStatus = true;
+        status.queueStatus = queueStatusObj->getProperty("status").toString();
+        status.queueMessage = queueStatusObj->getProperty("message").toString();
+        status.queuePosition = (int)queueStatusObj->getProperty("position");
+        status.queueEstimatedTime = queueStatusObj->getProperty("estimated_time").toString();
+        status.queueEstimatedSeconds = (int)queueStatusObj->getProperty("estimated_seconds");
+    }
+
+    return status;
+}
 
-void Gary4juceAudioProcessorEditor::handlePollingResponse(const juce::String& responseText)
+void Gary4juceAudioProcessorEditor::handlePollingResponse(const PollStatus& response,
+                                                          const JsonAudioStream::DecodedFile& receivedAudio)
 {
     const auto applyTerminalFailureRetryPolicy = [this]()
     {
@@ -2911,7 +3237,7 @@ void Gary4juceAudioProcessorEditor::handlePollingResponse(const juce::String& re
             audioProcessor.clearCurrentSessionId();
     };
 
-    if (responseText.isEmpty())
+    if (!response.received)
     {
         DBG("Empty polling response - backend likely down");
         audioProcessor.checkBackendHealth();
@@ -2920,476 +3246,723 @@ void Gary4juceAudioProcessorEditor::handlePollingResponse(const juce::String& re
         return;
     }
 
-    try
+    if (!response.parsed)
+    {
+        DBG("Failed to parse polling response as JSON - backend likely down");
+        audioProcessor.checkBackendHealth();
+        applyTerminalFailureRetryPolicy();
+        handleGenerationFailure("polling failed - bad response from backend");
+        return;
+    }
+
+    if (!response.success)
     {
-        auto responseVar = juce::JSON::parse(responseText);
-        if (auto* responseObj = responseVar.getDynamicObject())
+        // --- WARMUP HANDLING (model download / cold start) ---
+        // Treat a warmup-looking error as a non-fatal "warmup" state.
+        if (response.errorLooksLikeWarmup)
         {
-            bool success = responseObj->getProperty("success");
-            if (!success)
-            {
-                // --- WARMUP HANDLING (model download / cold start) ---
-                // Some backends return success:false with a descriptive error while the model weights
-                // are being downloaded/loaded on first use. Treat those as a non-fatal "warmup" state.
-                {
-                    juce::String errorMsg = responseObj->getProperty("error").toString().toLowerCase();
-                    const bool looksLikeWarmup =
-                        errorMsg.contains("download") ||
-                        errorMsg.contains("downloading") ||
-                        errorMsg.contains("loading model") ||
-                        errorMsg.contains("loading weights") ||
-                        errorMsg.contains("warmup") ||
-                        errorMsg.contains("warming") ||
-                        errorMsg.contains("huggingface") ||
-                        errorMsg.contains("initializing");
-                    if (looksLikeWarmup)
-                    {
-                        // Mark and keep polling without treating this as a failure
-                        withinWarmup = true;
-                        lastProgressUpdateTime = juce::Time::getCurrentTime().toMilliseconds(); // prevent stall detector
-                        isCurrentlyQueued = true; // keep UI in "busy" state
+            // Mark and keep polling without treating this as a failure
+            withinWarmup = true;
+            lastProgressUpdateTime = juce::Time::getCurrentTime().toMilliseconds(); // prevent stall detector
+            isCurrentlyQueued = true; // keep UI in "busy" state
 
-                        // Short, friendly status � we avoid failing the run
-                        showStatusMessage("warming up (downloading model)...", 4000);
-                        DBG("Polling: backend in warmup/cold-start: " + errorMsg);
+            pollScheduler.noteWaiting();
 
-                        // Do NOT stopPolling(); just return so the timer continues polling.
-                        return;
-                    }
-                }
-                // --- END WARMUP HANDLING ---
+            // Short, friendly status � we avoid failing the run
+            showStatusMessage("warming up (downloading model)...", 4000);
+            DBG("Polling: backend in warmup/cold-start: " + response.error);
 
-                DBG("Polling error: " + responseObj->getProperty("error").toString());
-                const juce::String error = responseObj->getProperty("error").toString().trim();
-                applyTerminalFailureRetryPolicy();
-                handleGenerationFailure(error.isNotEmpty() ? "processing failed: " + error
-                                                           : "processing failed");
-                return;
-            }
+            // Do NOT stopPolling(); just return so the timer continues polling.
+            return;
+        }
+        // --- END WARMUP HANDLING ---
 
-            // Check if still in progress
-            bool generationInProgress = responseObj->getProperty("generation_in_progress");
-            bool transformInProgress = responseObj->getProperty("transform_in_progress");
+        DBG("Polling error: " + response.error);
+        const juce::String error = response.error.trim();
+        applyTerminalFailureRetryPolicy();
+        handleGenerationFailure(error.isNotEmpty() ? "processing failed: " + error
+                                                   : "processing failed");
+        return;
+    }
 
-            // Musicgen's seed rides under its own key: plain "seed" on a poll is
-            // the last terry transform's, and both can share one session.
-            if (responseObj->hasProperty("generation_seed"))
-                setGaryLastSeed(responseObj->getProperty("generation_seed").toString());
+    // Check if still in progress
+    const bool generationInProgress = response.generationInProgress;
+    const bool transformInProgress = response.transformInProgress;
 
-            if (generationInProgress || transformInProgress)
-            {
-                // If we were previously in warmup, keep UI responsive and prevent stall
-                if (withinWarmup)
-                {
-                    // Heuristics to exit warmup: any server progress > 0, or a status past warming
-                    int warmProgressCheck = responseObj->getProperty("progress");
-                    juce::String warmQueueStatus;
-                    juce::String warmQueueMessage;
-                    if (auto* warmQueueObj = responseObj->getProperty("queue_status").getDynamicObject())
-                    {
-                        warmQueueStatus = warmQueueObj->getProperty("status").toString();
-                        warmQueueMessage = warmQueueObj->getProperty("message").toString();
-                    }
+    // Musicgen's seed rides under its own key: plain "seed" on a poll is
+    // the last terry transform's, and both can share one session.
+    if (response.hasGenerationSeed)
+        setGaryLastSeed(response.generationSeed);
 
-                    // Any progress, or any backend status that is no longer "warming", means the
-                    // model is loaded and the run proper has started.
-                    if (warmProgressCheck > 0
-                        || (warmQueueStatus.isNotEmpty() && warmQueueStatus != "warming"))
-                    {
-                        DBG("Exiting warmup state (progress or non-warming status observed)");
-                        withinWarmup = false;
-                    }
-                    else
-                    {
-                        // Stay in warmup: keep resetting the stall timer and show a gentle status
-                        lastProgressUpdateTime = juce::Time::getCurrentTime().toMilliseconds();
-                        showStatusMessage(warmQueueMessage.isNotEmpty() ? warmQueueMessage : "warming up...", 3000);
-                        // Don't early-return: allow the rest of the block to parse queue info etc.
-                    }
-                }
+    if (generationInProgress || transformInProgress)
+    {
+        // If we were previously in warmup, keep UI responsive and prevent stall
+        if (withinWarmup)
+        {
+            // Heuristics to exit warmup: any server progress > 0, or a status past warming
+            const int warmProgressCheck = response.progress;
+            const juce::String& warmQueueStatus = response.queueStatus;
+            const juce::String& warmQueueMessage = response.queueMessage;
+
+            // Any progress, or any backend status that is no longer "warming", means the
+            // model is loaded and the run proper has started.
+            if (warmProgressCheck > 0
+                || (warmQueueStatus.isNotEmpty() && warmQueueStatus != "warming"))
+            {
+                DBG("Exiting warmup state (progress or non-warming status observed)");
+                withinWarmup = false;
+            }
+            else
+            {
+                // Stay in warmup: keep resetting the stall timer and show a gentle status
+                lastProgressUpdateTime = juce::Time::getCurrentTime().toMilliseconds();
+                showStatusMessage(warmQueueMessage.isNotEmpty() ? warmQueueMessage : "warming up...", 3000);
+                // Don't early-return: allow the rest of the block to parse queue info etc.
+            }
+        }
 
-                // Get real progress from server
-                int serverProgress = responseObj->getProperty("progress");
-                serverProgress = juce::jlimit(0, 100, serverProgress);
+        // Get real progress from server
+        const int serverProgress = juce::jlimit(0, 100, response.progress);
 
-                // NEW: Check for queue status information (from enhanced /task_notification)
-                bool hasValidQueueStatus = false;
-                bool isQueuedForProcessing = false;
-                juce::String queueMessage;
-                juce::String queueStatus;
+        // NEW: Check for queue status information (from enhanced /task_notification)
+        bool hasValidQueueStatus = false;
+        bool isQueuedForProcessing = false;
+        int queueEstimatedSeconds = 0;
+        juce::String queueMessage;
+        juce::String queueStatus;
 
-                if (auto* queueStatusObj = responseObj->getProperty("queue_status").getDynamicObject())
-                {
-                    queueStatus = queueStatusObj->getProperty("status").toString();
-                    queueMessage = queueStatusObj->getProperty("message").toString();
-                    hasValidQueueStatus = !queueStatus.isEmpty();
-                    isQueuedForProcessing = (queueStatus == "queued");
-
-                    // A cold start reports "warming" over a perfectly healthy 200 with no error
-                    // field, so this is the only place we learn a model is still downloading.
-                    // Without it a multi-GB hub download reads as an ordinary stalled generation.
-                    if (queueStatus == "warming")
-                        withinWarmup = true;
-
-                    DBG("Queue status found - Status: " + queueStatus + ", Message: " + queueMessage);
-                }
+        if (response.hasQueueStatus)
+        {
+            queueStatus = response.queueStatus;
+            queueMessage = response.queueMessage;
+            hasValidQueueStatus = !queueStatus.isEmpty();
+            isQueuedForProcessing = (queueStatus == "queued");
+            queueEstimatedSeconds = response.queueEstimatedSeconds;
+
+            // A cold start reports "warming" over a perfectly healthy 200 with no error
+            // field, so this is the only place we learn a model is still downloading.
+            // Without it a multi-GB hub download reads as an ordinary stalled generation.
+            if (queueStatus == "warming")
+                withinWarmup = true;
+
+            DBG("Queue status found - Status: " + queueStatus + ", Message: " + queueMessage);
+        }
 
-                // Update stall detection tracking
-                auto currentTime = juce::Time::getCurrentTime().toMilliseconds();
+        // Update stall detection tracking
+        auto currentTime = juce::Time::getCurrentTime().toMilliseconds();
 
-                // ENHANCED: Reset stall detection on progress changes OR valid queue status
-                if (serverProgress > lastKnownServerProgress || hasValidQueueStatus)
-                {
-                    lastProgressUpdateTime = currentTime;
-                    if (serverProgress > lastKnownServerProgress)
-                        lastKnownServerProgress = serverProgress;
-                    hasDetectedStall = false;
+        // ENHANCED: Reset stall detection on progress changes OR valid queue status
+        if (serverProgress > lastKnownServerProgress || hasValidQueueStatus)
+        {
+            lastProgressUpdateTime = currentTime;
+            if (serverProgress > lastKnownServerProgress)
+                lastKnownServerProgress = serverProgress;
+            hasDetectedStall = false;
 
-                    DBG("Stall detection reset - Progress: " + juce::String(serverProgress) +
-                        "%, Valid queue status: " + juce::String(hasValidQueueStatus ? "yes" : "no"));
-                }
+            DBG("Stall detection reset - Progress: " + juce::String(serverProgress) +
+                "%, Valid queue status: " + juce::String(hasValidQueueStatus ? "yes" : "no"));
+        }
 
-                // Set up smooth animation to new target (only if not queued)
-                if (!isQueuedForProcessing)
-                {
-                    lastKnownProgress = generationProgress;  // Where we are now (visually)
-                    targetProgress = serverProgress;         // Where server says we should be
-                    smoothProgressAnimation = true;          // Start smooth animation
-                }
+        // Set up smooth animation to new target (only if not queued)
+        if (!isQueuedForProcessing)
+        {
+            lastKnownProgress = generationProgress;  // Where we are now (visually)
+            targetProgress = serverProgress;         // Where server says we should be
+            smoothProgressAnimation = true;          // Start smooth animation
+        }
 
-                // Update isCurrentlyQueued state
-                isCurrentlyQueued = isQueuedForProcessing;
+        // Update isCurrentlyQueued state
+        isCurrentlyQueued = isQueuedForProcessing;
 
-                // ENHANCED: Show appropriate status messages based on queue state
-                if (isQueuedForProcessing && hasValidQueueStatus)
-                {
-                    // Parse queue status data for concise message
-                    if (auto* queueStatusObj = responseObj->getProperty("queue_status").getDynamicObject())
-                    {
-                        int position = (int)queueStatusObj->getProperty("position");
-                        juce::String estimatedTime = queueStatusObj->getProperty("estimated_time").toString();
-                        int estimatedSeconds = (int)queueStatusObj->getProperty("estimated_seconds");
+        // Pace the next poll by what the backend just reported
+        if (isQueuedForProcessing || withinWarmup)
+            pollScheduler.noteWaiting(queueEstimatedSeconds);
+        else
+            pollScheduler.noteProgress(serverProgress);
 
-                        // Create concise queue message
-                        juce::String conciseMessage;
+        // ENHANCED: Show appropriate status messages based on queue state
+        if (isQueuedForProcessing && hasValidQueueStatus)
+        {
+            // Queue status data for concise message
+            if (response.hasQueueStatus)
+            {
+                const int position = response.queuePosition;
+                const juce::String& estimatedTime = response.queueEstimatedTime;
+                const int estimatedSeconds = response.queueEstimatedSeconds;
 
-                        if (position > 0)
-                        {
-                            // Format: "busy rn - pos 2 - wait ~45s"
-                            juce::String shortTime;
-                            if (estimatedSeconds < 60)
-                                shortTime = juce::String(estimatedSeconds) + "s";
-                            else
-                                shortTime = juce::String(estimatedSeconds / 60) + "m";
-
-                            conciseMessage = "busy rn - queued -...position # " + juce::String(position) + " - wait ~" + shortTime;
-                        }
-                        else
-                        {
-                            // Position 0 or unknown - just show that we're queued
-                            conciseMessage = "queued - starting soon...";
-                        }
+                // Create concise queue message
+                juce::String conciseMessage;
 
-                        showStatusMessage(conciseMessage, 5000);
-                        DBG("Displaying concise queue message: " + conciseMessage);
-                        DBG("Full queue details - Position: " + juce::String(position) +
-                            ", Estimated time: " + estimatedTime);
-                    }
-                    else
-                    {
-                        // Fallback if queue data is missing
-                        showStatusMessage("queued for processing...", 5000);
-                    }
-                }
-                else if (queueStatus == "warming")
-                {
-                    // Backend already wrote a useful line ("loading <model> (first run / hub
-                    // download)") - show it instead of a generic progress message.
-                    showStatusMessage(queueMessage.isNotEmpty()
-                        ? queueMessage
-                        : "warming up (loading model)...", 5000);
-                    DBG("Warming: " + queueMessage);
-                }
-                else if (serverProgress > 0 || queueStatus == "ready")
+                if (position > 0)
                 {
-                    juce::String verb = currentOperationVerb();
-                    if (verb == "processing")
-                        verb = transformInProgress ? "transforming" : "cooking";
+                    // Format: "busy rn - pos 2 - wait ~45s"
+                    juce::String shortTime;
+                    if (estimatedSeconds < 60)
+                        shortTime = juce::String(estimatedSeconds) + "s";
+                    else
+                        shortTime = juce::String(estimatedSeconds / 60) + "m";
 
-                    showStatusMessage(verb + ": " + juce::String(serverProgress) + "%", 5000);
-                    DBG("Progress (" + verb + "): " + juce::String(serverProgress) + "%, animating from " +
-                        juce::String(lastKnownProgress));
+                    conciseMessage = "busy rn - queued -...position # " + juce::String(position) + " - wait ~" + shortTime;
                 }
                 else
                 {
-                    // Fallback message when we have no specific queue info but task is in progress
-                    if (getActiveOp() == ActiveOp::TerryTransform
-                        || getActiveOp() == ActiveOp::SA3Transform
-                        || transformInProgress)
-                        showStatusMessage("processing transform...", 5000);
-                    else if (getActiveOp() == ActiveOp::SA3Continue)
-                        showStatusMessage("processing continuation...", 5000);
-                    else
-                        showStatusMessage("processing audio...", 5000);
+                    // Position 0 or unknown - just show that we're queued
+                    conciseMessage = "queued - starting soon...";
                 }
 
-                return;
+                showStatusMessage(conciseMessage, 5000);
+                DBG("Displaying concise queue message: " + conciseMessage);
+                DBG("Full queue details - Position: " + juce::String(position) +
+                    ", Estimated time: " + estimatedTime);
+            }
+            else
+            {
+                // Fallback if queue data is missing
+                showStatusMessage("queued for processing...", 5000);
             }
+        }
+        else if (queueStatus == "warming")
+        {
+            // Backend already wrote a useful line ("loading <model> (first run / hub
+            // download)") - show it instead of a generic progress message.
+            showStatusMessage(queueMessage.isNotEmpty()
+                ? queueMessage
+                : "warming up (loading model)...", 5000);
+            DBG("Warming: " + queueMessage);
+        }
+        else if (serverProgress > 0 || queueStatus == "ready")
+        {
+            juce::String verb = currentOperationVerb();
+            if (verb == "processing")
+                verb = transformInProgress ? "transforming" : "cooking";
 
-            // COMPLETED - Check what TYPE of completion this is FIRST
-            auto audioData = responseObj->getProperty("audio_data").toString();
-            auto status = responseObj->getProperty("status").toString();
-            const auto activeOperation = getActiveOp();
-            const bool isSA3TransformOp = activeOperation == ActiveOp::SA3Transform;
-            const bool isSA3ContinueOp = activeOperation == ActiveOp::SA3Continue;
-            const bool isTerryTransformOp = activeOperation == ActiveOp::TerryTransform
-                || (transformInProgress && !isSA3TransformOp && !isSA3ContinueOp);
-            const bool isTransformOp = isTerryTransformOp || isSA3TransformOp;
+            showStatusMessage(verb + ": " + juce::String(serverProgress) + "%", 5000);
+            DBG("Progress (" + verb + "): " + juce::String(serverProgress) + "%, animating from " +
+                juce::String(lastKnownProgress));
+        }
+        else
+        {
+            // Fallback message when we have no specific queue info but task is in progress
+            if (getActiveOp() == ActiveOp::TerryTransform
+                || getActiveOp() == ActiveOp::SA3Transform
+                || transformInProgress)
+                showStatusMessage("processing transform...", 5000);
+            else if (getActiveOp() == ActiveOp::SA3Continue)
+                showStatusMessage("processing continuation...", 5000);
+            else
+                showStatusMessage("processing audio...", 5000);
+        }
 
-            withinWarmup = false; // completed/terminal statuses should clear warmup
+        return;
+    }
 
-            DBG("=== POLLING RESPONSE ANALYSIS ===");
-            DBG("Status: " + status);
-            DBG("Audio data length: " + juce::String(audioData.length()));
-            DBG("Audio data empty: " + juce::String(audioData.isEmpty() ? "YES" : "NO"));
-            DBG("Full response: " + responseText.substring(0, 500) + "...");
+    // COMPLETED - Check what TYPE of completion this is FIRST
+    const auto receivedAudioBytes = receivedAudio != nullptr ? receivedAudio->getFile().getSize() : (juce::int64)0;
+    const auto& status = response.status;
+    const auto activeOperation = getActiveOp();
+    const bool isSA3TransformOp = activeOperation == ActiveOp::SA3Transform;
+    const bool isSA3ContinueOp = activeOperation == ActiveOp::SA3Continue;
+    const bool isTerryTransformOp = activeOperation == ActiveOp::TerryTransform
+        || (transformInProgress && !isSA3TransformOp && !isSA3ContinueOp);
+    const bool isTransformOp = isTerryTransformOp || isSA3TransformOp;
 
-            // Reset queue state when task completes
-            isCurrentlyQueued = false;
+    withinWarmup = false; // completed/terminal statuses should clear warmup
 
-            if (audioData.isNotEmpty() && status == "completed")
-            {
-                DBG("=== LEGITIMATE COMPLETION DETECTED ===");
-                stopPolling();
-                isGenerating = false;
+    DBG("=== POLLING RESPONSE ANALYSIS ===");
+    DBG("Status: " + status);
+    DBG("Audio data bytes: " + juce::String(receivedAudioBytes));
+    DBG("Error: " + response.error);
 
-                // DIFFERENTIATE: Check if we're completing a transform vs generation
-                if (isTerryTransformOp)
-                {
-                    // TRANSFORM COMPLETION - Keep session ID for undo
-                    if (terryUI)
-                        terryUI->setTransformButtonText("transform with terry");
-                    showStatusMessage("transform complete!", 3000);
-                    saveGeneratedAudio(audioData);
-                    DBG("Successfully received transformed audio: " + juce::String(audioData.length()) + " chars");
+    // Reset queue state when task completes
+    isCurrentlyQueued = false;
 
-                    // Enable undo button now that transform is complete
-                    audioProcessor.setUndoTransformAvailable(true); // ADD THIS
-                    audioProcessor.setRetryAvailable(false);
-                    // DON'T clear currentSessionId - we need it for undo!
+    if (receivedAudio != nullptr && status == "completed")
+    {
+        DBG("=== LEGITIMATE COMPLETION DETECTED ===");
+        stopPolling();
+        isGenerating = false;
 
-                    updateTerryEnablementSnapshot();
+        // DIFFERENTIATE: Check if we're completing a transform vs generation
+        if (isTerryTransformOp)
+        {
+            // TRANSFORM COMPLETION - Keep session ID for undo
+            if (terryUI)
+                terryUI->setTransformButtonText("transform with terry");
+            showStatusMessage("transform complete!", 3000);
+            saveGeneratedAudioFile(receivedAudio);
+            DBG("Successfully received transformed audio: " + juce::String(receivedAudioBytes) + " bytes");
 
-                }
-                else
-                {
-                    // GENERATION COMPLETION (Gary/Jerry) or SA3 mode completion
-                    showStatusMessage(isSA3ContinueOp ? "sa3 continuation complete!"
-                                      : isSA3TransformOp ? "sa3 transform complete!"
-                                      : "audio generation complete!", 3000);
-                    audioProcessor.setUndoTransformAvailable(false);
-                    audioProcessor.setRetryAvailable(true);
-                    saveGeneratedAudio(audioData);
-                    DBG(juce::String(isSA3TransformOp ? "Successfully received SA3 transformed audio: "
-                                                       : isSA3ContinueOp ? "Successfully received SA3 continuation audio: "
-                                                       : "Successfully received generated audio: ")
-                        + juce::String(audioData.length()) + " chars");
-
-                    // Check if this was a continue operation using our flag
-                    if (continueInProgress)
-                    {
-                        // This was a continue operation - keep session ID and enable retry
-                        continueInProgress = false;  // Reset the flag
-                        if (garyUI)
-                            garyUI->setRetryButtonText("retry");  // Reset retry button text
-                        updateRetryButtonState();
-                        DBG("Continue operation completed - retry button enabled");
-                    }
-                    else if (isSA3TransformOp)
-                    {
-                        audioProcessor.setRetryAvailable(false);
-                        audioProcessor.clearCurrentSessionId();
-                        updateRetryButtonState();
-                        DBG("SA3 transform completed - retry disabled");
-                    }
-                    else if (isSA3ContinueOp)
-                    {
-                        audioProcessor.setRetryAvailable(false);
-                        audioProcessor.clearCurrentSessionId();
-                        updateRetryButtonState();
-                        DBG("SA3 continuation completed - retry disabled");
-                    }
-                    else
-                    {
-                        // This was initial generation - clear session ID, disable retry
-                        audioProcessor.setUndoTransformAvailable(false);
-                        audioProcessor.setRetryAvailable(false);
-                        audioProcessor.clearCurrentSessionId();
-                        updateRetryButtonState();
-                        DBG("Initial generation completed - retry button disabled");
-                    }
+            // Enable undo button now that transform is complete
+            audioProcessor.setUndoTransformAvailable(true); // ADD THIS
+            audioProcessor.setRetryAvailable(false);
+            // DON'T clear currentSessionId - we need it for undo!
 
-                    updateContinueButtonState();
-                }
+            updateTerryEnablementSnapshot();
 
-                setActiveOp(ActiveOp::None);
+        }
+        else
+        {
+            // GENERATION COMPLETION (Gary/Jerry) or SA3 mode completion
+            showStatusMessage(isSA3ContinueOp ? "sa3 continuation complete!"
+                              : isSA3TransformOp ? "sa3 transform complete!"
+                              : "audio generation complete!", 3000);
+            audioProcessor.setUndoTransformAvailable(false);
+            audioProcessor.setRetryAvailable(true);
+            saveGeneratedAudioFile(receivedAudio);
+            DBG(juce::String(isSA3TransformOp ? "Successfully received SA3 transformed audio: "
+                                               : isSA3ContinueOp ? "Successfully received SA3 continuation audio: "
+                                               : "Successfully received generated audio: ")
+                + juce::String(receivedAudioBytes) + " bytes");
+
+            // Check if this was a continue operation using our flag
+            if (continueInProgress)
+            {
+                // This was a continue operation - keep session ID and enable retry
+                continueInProgress = false;  // Reset the flag
+                if (garyUI)
+                    garyUI->setRetryButtonText("retry");  // Reset retry button text
+                updateRetryButtonState();
+                DBG("Continue operation completed - retry button enabled");
+            }
+            else if (isSA3TransformOp)
+            {
+                audioProcessor.setRetryAvailable(false);
+                audioProcessor.clearCurrentSessionId();
+                updateRetryButtonState();
+                DBG("SA3 transform completed - retry disabled");
+            }
+            else if (isSA3ContinueOp)
+            {
+                audioProcessor.setRetryAvailable(false);
+                audioProcessor.clearCurrentSessionId();
+                updateRetryButtonState();
+                DBG("SA3 continuation completed - retry disabled");
             }
             else
             {
-                // COMPLETED but no audio data
-                if (status == "failed")
-                {
-                    auto error = responseObj->getProperty("error").toString();
-                    juce::String message;
+                // This was initial generation - clear session ID, disable retry
+                audioProcessor.setUndoTransformAvailable(false);
+                audioProcessor.setRetryAvailable(false);
+                audioProcessor.clearCurrentSessionId();
+                updateRetryButtonState();
+                DBG("Initial generation completed - retry button disabled");
+            }
 
-                    if (isTransformOp)
-                    {
-                        message = "transform failed";
-                        if (error.isNotEmpty())
-                            message += ": " + error;
-
-                        audioProcessor.setUndoTransformAvailable(false);
-                        audioProcessor.setRetryAvailable(false);
-                        if (isSA3TransformOp)
-                            audioProcessor.clearCurrentSessionId();
-                    }
-                    else if (isSA3ContinueOp)
-                    {
-                        message = "continue failed";
-                        if (error.isNotEmpty())
-                            message += ": " + error;
+            updateContinueButtonState();
+        }
 
-                        audioProcessor.setRetryAvailable(false);
-                        audioProcessor.clearCurrentSessionId();
-                    }
-                    else
-                    {
-                        message = "generation failed";
-                        if (error.isNotEmpty())
-                            message += ": " + error;
+        setActiveOp(ActiveOp::None);
+    }
+    else
+    {
+        // COMPLETED but no audio data
+        if (status == "failed")
+        {
+            const auto& error = response.error;
+            juce::String message;
 
-                        applyTerminalFailureRetryPolicy();
-                    }
+            if (isTransformOp)
+            {
+                message = "transform failed";
+                if (error.isNotEmpty())
+                    message += ": " + error;
+
+                audioProcessor.setUndoTransformAvailable(false);
+                audioProcessor.setRetryAvailable(false);
+                if (isSA3TransformOp)
+                    audioProcessor.clearCurrentSessionId();
+            }
+            else if (isSA3ContinueOp)
+            {
+                message = "continue failed";
+                if (error.isNotEmpty())
+                    message += ": " + error;
 
-                    handleGenerationFailure(message);
-                }
-                else if (status == "completed")
-                {
-                    juce::String message;
+                audioProcessor.setRetryAvailable(false);
+                audioProcessor.clearCurrentSessionId();
+            }
+            else
+            {
+                message = "generation failed";
+                if (error.isNotEmpty())
+                    message += ": " + error;
 
-                    if (isTransformOp)
-                    {
-                        message = "transform completed but no audio received";
-                        if (isSA3TransformOp)
-                            audioProcessor.clearCurrentSessionId();
-                    }
-                    else if (isSA3ContinueOp)
-                    {
-                        message = "continuation completed but no audio received";
-                        audioProcessor.clearCurrentSessionId();
-                    }
-                    else
-                    {
-                        message = "generation completed but no audio received";
-                    }
+                applyTerminalFailureRetryPolicy();
+            }
 
-                    resetGenerationStateAfterTerminalResult();
-                    showStatusMessage(message, 3000);
-                }
-                else
-                {
-                    const juce::String fallbackStatus = status.trim().isNotEmpty()
-                        ? status.trim()
-                        : "missing terminal status";
-                    applyTerminalFailureRetryPolicy();
-                    handleGenerationFailure("processing failed: " + fallbackStatus);
-                }
+            handleGenerationFailure(message);
+        }
+        else if (status == "completed")
+        {
+            juce::String message;
+
+            if (isTransformOp)
+            {
+                message = "transform completed but no audio received";
+                if (isSA3TransformOp)
+                    audioProcessor.clearCurrentSessionId();
+            }
+            else if (isSA3ContinueOp)
+            {
+                message = "continuation completed but no audio received";
+                audioProcessor.clearCurrentSessionId();
             }
+            else
+            {
+                message = "generation completed but no audio received";
+            }
+
+            resetGenerationStateAfterTerminalResult();
+            showStatusMessage(message, 3000);
         }
         else
         {
-            DBG("Failed to parse polling response as JSON - backend likely down");
-            audioProcessor.checkBackendHealth();
+            const juce::String fallbackStatus = status.trim().isNotEmpty()
+                ? status.trim()
+                : "missing terminal status";
             applyTerminalFailureRetryPolicy();
-            handleGenerationFailure("polling failed - bad response from backend");
+            handleGenerationFailure("processing failed: " + fallbackStatus);
         }
     }
+}
 
-    catch (...)
+
+void Gary4juceAudioProcessorEditor::saveGeneratedAudioFile(JsonAudioStream::DecodedFile decodedAudio)
+{
+    if (decodedAudio == nullptr)
+        return;
+
+    installGeneratedAudio([this, decodedAudio](const juce::File& destination, ResultIngest::Callback callback)
     {
-        DBG("Exception parsing polling response - backend likely down");
-        audioProcessor.checkBackendHealth();
-        applyTerminalFailureRetryPolicy();
-        handleGenerationFailure("polling failed - could not parse backend response");
+        outputIngest.ingestFile(decodedAudio, destination, audioProcessor.getCurrentSampleRate(), std::move(callback));
+    });
+}
+
+double Gary4juceAudioProcessorEditor::getGenerationTempo() const
+{
+    // Standalone has no host tempo; the backends are sent the manual one
+    return juce::JUCEApplicationBase::isStandaloneApp() ? currentStandaloneBpm
+                                                        : audioProcessor.getCurrentBPM();
+}
+
+void Gary4juceAudioProcessorEditor::installGeneratedAudio(
+    const std::function<void(const juce::File&, ResultIngest::Callback)>& queueIngest)
+{
+    if (!ensureGaryDataDirectoryAvailable())
+        return;
+
+    audioProcessor.setOutputGenerationBpm(pendingGenerationBpm);
+
+    // FIXED: Always save as myOutput.wav
+    outputAudioFile = getGaryOutputFile();
+
+    // STOP any current playback before the new audio lands
+    // This prevents confusion where old audio plays but new waveform shows
+    const bool wasPlaying = isPlayingOutput || isPausedOutput;
+    if (wasPlaying)
+        stopOutputPlayback(); // Full stop - reset to beginning
+
+    auto* editor = this;
+    queueIngest(outputAudioFile, makeOutputIngestCallback([editor, wasPlaying]()
+    {
+        editor->showStatusMessage(wasPlaying ? "new audio ready. press play to hear it."
+                                             : "generated audio ready", 3000);
+        DBG("Generated audio saved to: " + editor->outputAudioFile.getFullPathName());
+    }));
+
+    // Reset button text after successful generation
+    if (garyUI)
+    {
+        garyUI->setSendButtonText("send to gary");
+        garyUI->setContinueButtonText("continue");
     }
+
+    // Reset generation state
+    isGenerating = false;
+    generationProgress = 0;
+
+    // Update all button states centrally
+    updateAllGenerationButtonStates();
+
+    // Update UI
+    repaint();
 }
 
+// Takes over from the single-request path once a send has checked its input
+// and built one submit per variation. The caller has already set the active
+// op and the generating state.
+void Gary4juceAudioProcessorEditor::startVariationBatch(ServiceType service,
+                                                        std::vector<VariationBatch::Variation> variations)
+{
+    clearVariationTakes();
+    variationTakesBpm = getGenerationTempo();
+
+    const int numVariations = (int)variations.size();
+    const auto statusUrlBase = getPollStatusUrl({}).toString(false);
+
+    // One at a time until the backend says how many it runs at once
+    variationBatch = std::make_unique<VariationBatch>(audioProcessor.getHttpClient(),
+                                                      std::move(variations),
+                                                      [statusUrlBase](const juce::String& sessionId)
+                                                      {
+                                                          return juce::URL(statusUrlBase + sessionId);
+                                                      },
+                                                      readBatchStatus,
+                                                      juce::StringArray { "audio_data" });
+    variationBatchService = service;
+    variationBatchError.clear();
+    const int batchSerial = ++variationBatchSerial;
+
+    audioProcessor.clearCurrentSessionId();
+    audioProcessor.setUndoTransformAvailable(false);
+    audioProcessor.setRetryAvailable(false);
+    updateRetryButtonState();
+
+    isCurrentlyQueued = true;
+    lastProgressUpdateTime = juce::Time::getCurrentTime().toMilliseconds();
+    showStatusMessage("sending " + juce::String(numVariations) + " variations...", 2500);
 
-void Gary4juceAudioProcessorEditor::saveGeneratedAudio(const juce::String& base64Audio)
+    const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
+    auto* editor = this;
+
+    audioProcessor.getMetadataCache().fetch(audioProcessor.getHttpClient(),
+        juce::URL(getServiceUrl(service, "/health")), kVariationBatchHealthMaxAgeMs,
+        [asyncAlive, editor, batchSerial, numVariations](const MetadataCache::Response& response)
+        {
+            const int limit = juce::jlimit(1, numVariations,
+                VariationBatch::readConcurrencyLimit(response.body, kVariationBatchDefaultConcurrency));
+
+            juce::MessageManager::callAsync([asyncAlive, editor, batchSerial, limit]()
+                {
+                    const auto alive = asyncAlive.lock();
+                    if (alive == nullptr || !alive->load(std::memory_order_acquire))
+                        return;
+
+                    if (editor->variationBatch != nullptr && editor->variationBatchSerial == batchSerial)
+                    {
+                        DBG("[batch] running " + juce::String(limit) + " at once");
+                        editor->variationBatch->setConcurrencyLimit(limit);
+                    }
+                });
+        });
+
+    variationBatch->service();
+    updateAllGenerationButtonStates();
+    repaint();
+}
+
+// Called from the timer: sends what's due and collects finished takes.
+void Gary4juceAudioProcessorEditor::serviceVariationBatch()
 {
-    try
+    if (variationBatch == nullptr)
+        return;
+
+    variationBatch->service();
+
+    const int numVariations = variationBatch->getNumVariations();
+    VariationBatch::Take take;
+
+    while (variationBatch->popTake(take))
     {
-        // Decode base64 audio using JUCE's proper API
-        juce::MemoryOutputStream outputStream;
+        if (take.audio == nullptr)
+        {
+            DBG("[batch] " + take.label + " failed: " + take.error);
+            variationBatchError = take.error;
+            continue;
+        }
+
+        variationTakes.push_back({ take, nullptr });
+        const int takeNumber = (int)variationTakes.size();
+        prepareVariationTake(takeNumber - 1);
 
-        if (!juce::Base64::convertFromBase64(outputStream, base64Audio))
+        if (isGenerating)
         {
-            DBG("Failed to decode base64 audio");
-            return;
+            // The first take ends the wait; the rest keep coming in behind it
+            resetGenerationStateAfterTerminalResult();
+            if (terryUI && variationBatchService == ServiceType::Terry)
+                terryUI->setTransformButtonText("transform with terry");
+
+            auditionTake(0, false);
+            updateContinueButtonState();
+            showStatusMessage(takeNumber < numVariations
+                ? "take 1 ready - " + juce::String(numVariations - takeNumber) + " more on the way"
+                : "take 1 ready", 4000);
+        }
+        else
+        {
+            showStatusMessage("take " + juce::String(takeNumber) + " of "
+                              + juce::String(numVariations) + " ready", 2500);
         }
+    }
 
-        // Get the decoded data
-        const juce::MemoryBlock& audioData = outputStream.getMemoryBlock();
+    if (variationBatch->isFinished())
+    {
+        variationBatch.reset();
 
-        if (!ensureGaryDataDirectoryAvailable())
+        if (isGenerating)
+            handleGenerationFailure(variationBatchError.isNotEmpty()
+                ? "generation failed: " + variationBatchError
+                : "generation failed");
+        else if (variationTakes.size() > 1)
+            showStatusMessage(juce::String((int)variationTakes.size())
+                              + " takes ready - pick one under settings > takes", 4000);
+        return;
+    }
+
+    if (isGenerating)
+    {
+        const int progress = variationBatch->getProgress();
+        isCurrentlyQueued = variationBatch->isWaiting() && progress == 0;
+
+        if (progress != targetProgress)
+        {
+            lastKnownProgress = generationProgress;
+            targetProgress = progress;
+            smoothProgressAnimation = true;
+            lastProgressUpdateTime = juce::Time::getCurrentTime().toMilliseconds();
+        }
+    }
+}
+
+void Gary4juceAudioProcessorEditor::auditionTake(int takeIndex, bool startPlaying)
+{
+    if (takeIndex < 0 || takeIndex >= (int)variationTakes.size() || !ensureGaryDataDirectoryAvailable())
+        return;
+
+    const auto ingested = variationTakes[(size_t)takeIndex].ingested;
+    const auto take = variationTakes[(size_t)takeIndex].take;
+
+    if (isPlayingOutput || isPausedOutput)
+        stopOutputPlayback();
+
+    outputAudioFile = getGaryOutputFile();
+    currentTakeIndex = takeIndex;
+    audioProcessor.setOutputGenerationBpm(variationTakesBpm);
+
+    auto* editor = this;
+    const int numTakes = (int)variationTakes.size();
+    auto onApplied = [editor, startPlaying, take, takeIndex, numTakes]()
+    {
+        if (!startPlaying)
             return;
 
-        // FIXED: Always save as myOutput.wav
-        outputAudioFile = getGaryOutputFile();
+        editor->playOutputAudio();
+        editor->showStatusMessage("playing " + take.label + " (" + juce::String(takeIndex + 1) + " of "
+                                  + juce::String(numTakes) + ")", 2500);
+    };
+
+    // Already decoded and playable from memory at this rate: swap it in now
+    // and let the file catch up behind it on the ingest thread.
+    if (ingested != nullptr && ingested->file == outputAudioFile && ingested->getPlaybackBuffer() != nullptr
+        && ingested->playbackRate == audioProcessor.getCurrentSampleRate())
+    {
+        ++outputIngestSerial;
+        applyIngestedOutput(ingested, {});
+        onApplied();
+
+        outputIngest.install(ingested, take.audio, [](ResultIngest::Handle installed, const juce::String& error)
+        {
+            if (installed == nullptr)
+                DBG("[batch] couldn't install take: " + error);
+        });
+    }
+    else
+    {
+        outputIngest.ingestFile(take.audio, outputAudioFile, audioProcessor.getCurrentSampleRate(),
+                                makeOutputIngestCallback(onApplied));
+    }
+
+    // So a favourite take's seed can be locked in
+    if (take.seed.isNotEmpty())
+    {
+        if (variationBatchService == ServiceType::Gary)
+            setGaryLastSeed(take.seed);
+        else if (variationBatchService == ServiceType::Terry)
+            setTerryLastSeed(take.seed);
+        else if (variationBatchService == ServiceType::SA3 && sa3UI)
+            sa3UI->setLastSeed(take.seed);
+    }
 
-        // Write to file
-        if (writeDataToFileSafely(outputAudioFile, audioData.getData(), audioData.getSize()))
+    repaint();
+}
+
+void Gary4juceAudioProcessorEditor::prepareVariationTake(int takeIndex)
+{
+    if (takeIndex < 0 || takeIndex >= (int)variationTakes.size() || !ensureGaryDataDirectoryAvailable())
+        return;
+
+    const auto source = variationTakes[(size_t)takeIndex].take.audio;
+    const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
+    auto* editor = this;
+
+    takeIngest.prepareFile(source, getGaryOutputFile(), audioProcessor.getCurrentSampleRate(),
+                           [asyncAlive, editor, source, takeIndex](ResultIngest::Handle ingested,
+                                                                   const juce::String& error)
+    {
+        juce::MessageManager::callAsync([asyncAlive, editor, source, takeIndex, ingested, error]()
         {
-            showStatusMessage("generated audio ready", 3000);
-            DBG("Generated audio saved to: " + outputAudioFile.getFullPathName());
+            const auto alive = asyncAlive.lock();
+            if (alive == nullptr || !alive->load(std::memory_order_acquire))
+                return;
 
-            // STOP any current playback before loading new audio
-            // This prevents confusion where old audio plays but new waveform shows
-            if (isPlayingOutput || isPausedOutput)
+            if (ingested == nullptr)
             {
-                stopOutputPlayback(); // Full stop - reset to beginning
-                showStatusMessage("new audio ready. press play to hear it.", 3000);
+                DBG("[batch] couldn't decode take " + juce::String(takeIndex + 1) + ": " + error);
+                return;
             }
 
-            // Load the audio file into our buffer for waveform display
-            loadOutputAudioFile();
+            // Still the same take, not one from a batch sent since
+            auto& takes = editor->variationTakes;
+            if (takeIndex < (int)takes.size() && takes[(size_t)takeIndex].take.audio == source)
+                takes[(size_t)takeIndex].ingested = ingested;
+        });
+    });
+}
 
-            // Reset button text after successful generation
-            if (garyUI)
-            {
-                garyUI->setSendButtonText("send to gary");
-                garyUI->setContinueButtonText("continue");
-            }
+void Gary4juceAudioProcessorEditor::clearVariationTakes()
+{
+    variationBatch.reset();
+    variationTakes.clear();
+    currentTakeIndex = -1;
+}
 
-            // Reset generation state
-            isGenerating = false;
-            generationProgress = 0;
+VariationBatch::Status Gary4juceAudioProcessorEditor::readBatchStatus(const juce::String& responseText)
+{
+    using State = VariationBatch::Status::State;
 
-            // Update all button states centrally
-            updateAllGenerationButtonStates();
+    const auto poll = parsePollStatus(responseText);
+    VariationBatch::Status status;
+    status.progress = poll.progress;
+    status.estimatedSeconds = poll.queueEstimatedSeconds;
+    if (poll.hasGenerationSeed)
+        status.seed = poll.generationSeed;
 
-            // Update UI
-            repaint();
-        }
-        else
-        {
-            DBG("Failed to save generated audio file");
-        }
+    if (!poll.parsed)
+    {
+        status.state = State::failed;
+        status.error = "bad response from backend";
     }
-    catch (...)
+    else if (!poll.success)
+    {
+        status.state = poll.errorLooksLikeWarmup ? State::waiting : State::failed;
+        status.error = poll.error.trim();
+    }
+    else if (poll.generationInProgress || poll.transformInProgress)
+    {
+        const bool waiting = poll.queueStatus == "queued" || poll.queueStatus == "warming";
+        status.state = waiting && poll.progress <= 0 ? State::waiting : State::running;
+    }
+    else if (poll.status == "completed")
+    {
+        status.state = State::completed;
+    }
+    else
     {
-        DBG("Exception saving generated audio");
+        status.state = State::failed;
+        status.error = poll.status == "failed" ? poll.error.trim() : "processing failed: " + poll.status;
     }
+
+    return status;
 }
 
 void Gary4juceAudioProcessorEditor::sendToGary()
@@ -3450,28 +4023,25 @@ void Gary4juceAudioProcessorEditor::sendToGary()
         return;
     }
 
-    // Read and encode audio file
-    juce::MemoryBlock audioData;
-    if (!audioFile.loadFileAsData(audioData))
+    // Verify we have audio data
+    if (audioFile.getSize() == 0)
     {
         cancelGaryOperation();
-        showStatusMessage("failed to read audio file");
+        showStatusMessage("audio file is empty");
         return;
     }
 
-    // Verify we have audio data
-    if (audioData.getSize() == 0)
+    // Copy the audio aside for the upload
+    const auto uploadAudio = AudioUpload::snapshot(audioFile);
+    if (uploadAudio == nullptr)
     {
         cancelGaryOperation();
-        showStatusMessage("audio file is empty");
+        showStatusMessage("failed to read audio file");
         return;
     }
 
-    auto base64Audio = juce::Base64::toBase64(audioData.getData(), audioData.getSize());
-
     // Debug: Log audio data size
-    DBG("Audio file size: " + juce::String(audioData.getSize()) + " bytes");
-    DBG("Base64 length: " + juce::String(base64Audio.length()) + " chars");
+    DBG("Audio file size: " + juce::String(audioFile.getSize()) + " bytes");
 
     // Button text feedback and status during processing (AFTER button state update)
     if (garyUI)
@@ -3487,49 +4057,71 @@ void Gary4juceAudioProcessorEditor::sendToGary()
     const juce::String description = currentGaryDescription;
     const juce::int64 requestSeed = garyUI != nullptr ? garyUI->getSeed() : -1;
     const juce::URL requestUrl(getServiceUrl(ServiceType::Gary, "/api/juce/process_audio"));
-    juce::Component::SafePointer<Gary4juceAudioProcessorEditor> safeThis(this);
-    const auto generationToken = beginGenerationAsyncWork();
-
-    // Create HTTP request in background thread
-    juce::Thread::launch([safeThis, generationToken, selectedModel, promptDuration, base64Audio, topK, cfgCoef, description, requestSeed, requestUrl]() {
-        if (safeThis == nullptr || !safeThis->isGenerationAsyncWorkCurrent(generationToken)) {
-            DBG("Gary request aborted - generation stopped");
-            return;
-        }
-
-        auto startTime = juce::Time::getCurrentTime();
 
-        // Create JSON payload - Clean construction without double encoding
+    // Create JSON payload - Clean construction without double encoding
+    const auto makeRequest = [selectedModel, promptDuration, topK, cfgCoef, description](juce::int64 seed)
+    {
         juce::DynamicObject::Ptr jsonRequest = new juce::DynamicObject();
         jsonRequest->setProperty("model_name", selectedModel);
         jsonRequest->setProperty("prompt_duration", promptDuration);
-        jsonRequest->setProperty("audio_data", base64Audio);
         jsonRequest->setProperty("top_k", topK);
         jsonRequest->setProperty("temperature", 1.0);
         jsonRequest->setProperty("cfg_coef", cfgCoef);
         jsonRequest->setProperty("description", description);
-        jsonRequest->setProperty("seed", requestSeed);
+        jsonRequest->setProperty("seed", seed);
+        return jsonRequest;
+    };
 
-        auto jsonString = juce::JSON::toString(juce::var(jsonRequest.get()));
+    if (variationsPerSend > 1)
+    {
+        // A locked seed counts up from there; otherwise each take gets its own
+        std::vector<VariationBatch::Variation> variations;
+        for (int i = 0; i < variationsPerSend; ++i)
+        {
+            const juce::int64 seed = requestSeed >= 0 ? requestSeed + i : (juce::int64)-1;
+            variations.push_back({ "take " + juce::String(i + 1), requestUrl,
+                [makeRequest, seed, uploadAudio, requestUrl](const HttpClient::CancellationToken&)
+                {
+                    auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
+                        .withConnectionTimeoutMs(30000)
+                        .withExtraHeaders("Content-Type: application/json");
+
+                    auto stream = AudioUpload::post(requestUrl, *makeRequest(seed), "audio_data", uploadAudio, options);
+                    return VariationBatch::readSubmitResponse(stream != nullptr ? stream->readEntireStreamAsString()
+                                                                                : juce::String());
+                } });
+        }
+
+        if (garyUI)
+            garyUI->setSendButtonText("cooking...");
+        startVariationBatch(ServiceType::Gary, std::move(variations));
+        return;
+    }
+
+    juce::Component::SafePointer<Gary4juceAudioProcessorEditor> safeThis(this);
+    const auto generationToken = beginGenerationAsyncWork();
+
+    // Create HTTP request in background thread
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Generation, requestUrl, [safeThis, generationToken, makeRequest, uploadAudio, requestSeed, requestUrl](const HttpClient::CancellationToken&) {
+        if (safeThis == nullptr || !safeThis->isGenerationAsyncWorkCurrent(generationToken)) {
+            DBG("Gary request aborted - generation stopped");
+            return;
+        }
 
-        // Debug: Log the JSON structure (not content due to size)
-        DBG("JSON payload size: " + juce::String(jsonString.length()) + " characters");
-        DBG("JSON preview: " + jsonString.substring(0, 100) + "...");
+        auto startTime = juce::Time::getCurrentTime();
+        const auto jsonRequest = makeRequest(requestSeed);
 
         juce::String responseText;
         int statusCode = 0;
 
         try
         {
-            // JUCE 8.0.8 CORRECT HYBRID APPROACH: 
-            // Use URL.withPOSTData for POST body, InputStreamOptions for modern settings
-            juce::URL postUrl = requestUrl.withPOSTData(jsonString);
-
+            // Audio goes up as a file part; AudioUpload falls back to base64 JSON
             auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                 .withConnectionTimeoutMs(30000)
                 .withExtraHeaders("Content-Type: application/json");
 
-            auto stream = postUrl.createInputStream(options);
+            auto stream = AudioUpload::post(requestUrl, *jsonRequest, "audio_data", uploadAudio, options);
 
             auto requestTime = juce::Time::getCurrentTime() - startTime;
             DBG("HTTP connection established in " + juce::String(requestTime.inMilliseconds()) + "ms");
@@ -3703,7 +4295,6 @@ void Gary4juceAudioProcessorEditor::continueMusic()
         return;
     }
 
-    // Encode current output audio as base64
     if (!outputAudioFile.exists())
     {
         showStatusMessage("output file not found", 2000);
@@ -3711,25 +4302,22 @@ void Gary4juceAudioProcessorEditor::continueMusic()
         return;
     }
 
-    // Read the audio file as binary data
-    juce::MemoryBlock audioData;
-    if (!outputAudioFile.loadFileAsData(audioData))
+    // Copy the output aside; it gets replaced when the continuation lands
+    auto uploadAudio = AudioUpload::snapshot(outputAudioFile);
+    if (uploadAudio == nullptr)
     {
         showStatusMessage("failed to read audio file", 3000);
         cancelContinueOperation();
         return;
     }
 
-    // Convert to base64
-    auto base64Audio = juce::Base64::toBase64(audioData.getData(), audioData.getSize());
-
-    sendContinueRequest(base64Audio);
+    sendContinueRequest(uploadAudio);
 }
 
 // UPDATED: sendContinueRequest with proper debugging
-void Gary4juceAudioProcessorEditor::sendContinueRequest(const juce::String& audioData)
+void Gary4juceAudioProcessorEditor::sendContinueRequest(const AudioUpload::Source& audioData)
 {
-    DBG("Sending continue request with " + juce::String(audioData.length()) + " chars of audio data");
+    DBG("Sending continue request with " + juce::String(audioData->getFile().getSize()) + " bytes of audio data");
     showStatusMessage("requesting continuation...", 3000);
 
     // Reset generation state immediately
@@ -3760,7 +4348,7 @@ void Gary4juceAudioProcessorEditor::sendContinueRequest(const juce::String& audi
     const auto generationToken = beginGenerationAsyncWork();
 
     // Create HTTP request in background thread
-    juce::Thread::launch([safeThis, generationToken, audioData, capturedModelPath, promptDuration, topK, cfgCoef, description, requestSeed, requestUrl]() {
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Generation, requestUrl, [safeThis, generationToken, audioData, capturedModelPath, promptDuration, topK, cfgCoef, description, requestSeed, requestUrl](const HttpClient::CancellationToken&) {
         if (safeThis == nullptr || !safeThis->isGenerationAsyncWorkCurrent(generationToken)) {
             DBG("Continue request aborted - generation stopped");
             return;
@@ -3772,7 +4360,6 @@ void Gary4juceAudioProcessorEditor::sendContinueRequest(const juce::String& audi
 
         // Create JSON payload - same structure as sendToGary
         juce::DynamicObject::Ptr jsonRequest = new juce::DynamicObject();
-        jsonRequest->setProperty("audio_data", audioData);
         jsonRequest->setProperty("prompt_duration", promptDuration);
         jsonRequest->setProperty("model_name", capturedModelPath); // Use captured model path
         jsonRequest->setProperty("top_k", topK);
@@ -3781,23 +4368,17 @@ void Gary4juceAudioProcessorEditor::sendContinueRequest(const juce::String& audi
         jsonRequest->setProperty("description", description);
         jsonRequest->setProperty("seed", requestSeed);
 
-        auto jsonString = juce::JSON::toString(juce::var(jsonRequest.get()));
-
-        DBG("Continue JSON payload size: " + juce::String(jsonString.length()) + " characters");
-
         juce::String responseText;
         int statusCode = 0;
 
         try
         {
-            // Use JUCE 8.0.8 pattern: withPOSTData + InputStreamOptions
-            juce::URL postUrl = requestUrl.withPOSTData(jsonString);
-
+            // Audio goes up as a file part; AudioUpload falls back to base64 JSON
             auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                 .withConnectionTimeoutMs(30000)
                 .withExtraHeaders("Content-Type: application/json");
 
-            auto stream = postUrl.createInputStream(options);
+            auto stream = AudioUpload::post(requestUrl, *jsonRequest, "audio_data", audioData, options);
 
             auto requestTime = juce::Time::getCurrentTime() - startTime;
             DBG("Continue HTTP connection established in " + juce::String(requestTime.inMilliseconds()) + "ms");
@@ -4004,7 +4585,7 @@ void Gary4juceAudioProcessorEditor::retryLastContinuation()
     const auto generationToken = beginGenerationAsyncWork();
 
     // Create HTTP request in background thread (same pattern as other requests)
-    juce::Thread::launch([safeThis, generationToken, sessionId, promptDuration, selectedModel, topK, cfgCoef, description, requestSeed, requestUrl]() {
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Generation, requestUrl, [safeThis, generationToken, sessionId, promptDuration, selectedModel, topK, cfgCoef, description, requestSeed, requestUrl](const HttpClient::CancellationToken&) {
         if (safeThis == nullptr || !safeThis->isGenerationAsyncWorkCurrent(generationToken)) {
             DBG("Retry request aborted - generation stopped");
             return;
@@ -4041,7 +4622,7 @@ void Gary4juceAudioProcessorEditor::retryLastContinuation()
                 .withConnectionTimeoutMs(30000)
                 .withExtraHeaders("Content-Type: application/json");
 
-            auto stream = postUrl.createInputStream(options);
+            auto stream = HttpClient::openStream(postUrl, options);
 
             if (stream != nullptr)
             {
@@ -4218,57 +4799,33 @@ void Gary4juceAudioProcessorEditor::fetchGaryAvailableModels()
         return;
     }
 
-    if (garyModelFetchInFlight.exchange(true, std::memory_order_acq_rel))
-        return;
-
     const auto modelsUrl = getServiceUrl(ServiceType::Gary, "/api/models");
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, modelsUrl]()
+    audioProcessor.getMetadataCache().fetch(audioProcessor.getHttpClient(), juce::URL(modelsUrl), kGaryModelsMaxAgeMs,
+        [asyncAlive, editor](const MetadataCache::Response& response)
         {
-            juce::URL url(modelsUrl);
-
-            std::unique_ptr<juce::InputStream> stream(url.createInputStream(
-                juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-                .withConnectionTimeoutMs(10000)
-            ));
-
-            juce::String responseText;
-            if (stream != nullptr)
-                responseText = stream->readEntireStreamAsString();
+            const auto menu = parseGaryModels(response.body);
 
-            juce::MessageManager::callAsync([asyncAlive, editor, responseText]()
+            juce::MessageManager::callAsync([asyncAlive, editor, menu]()
                 {
                     const auto alive = asyncAlive.lock();
                     if (alive == nullptr || !alive->load(std::memory_order_acquire))
                         return;
 
-                    editor->garyModelFetchInFlight.store(false, std::memory_order_release);
-                    editor->handleGaryModelsResponse(responseText);
+                    editor->handleGaryModelsResponse(menu);
                 });
         });
 }
 
-void Gary4juceAudioProcessorEditor::handleGaryModelsResponse(const juce::String& responseText)
+// Runs on the fetching thread; builds the whole dropdown without touching the editor.
+Gary4juceAudioProcessorEditor::GaryModelMenu Gary4juceAudioProcessorEditor::parseGaryModels(const juce::String& responseText)
 {
-    if (responseText.isEmpty())
-    {
-        DBG("Empty Gary models response - using fallback");
-        showStatusMessage("failed to load gary models", 3000);
-
-        // Fallback to safe defaults
-        garyModelList.clear();
-        garyModelList.push_back({"vanya ai dnb 0.1", "thepatch/vanya_ai_dnb_0.1", 1});
-
-        garyModelItems.clear();
-        garyModelItems.add("vanya ai dnb 0.1");
-
-        if (garyUI)
-            garyUI->setModelItems(garyModelItems, 0);
-
-        return;
-    }
+    GaryModelMenu menu;
+    menu.received = responseText.isNotEmpty();
+    if (!menu.received)
+        return menu;
 
     try
     {
@@ -4277,36 +4834,32 @@ void Gary4juceAudioProcessorEditor::handleGaryModelsResponse(const juce::String&
         if (!parsed.isObject())
         {
             DBG("Invalid Gary models response format - not an object");
-            return;
+            return menu;
         }
 
         auto* obj = parsed.getDynamicObject();
         if (!obj || !obj->hasProperty("models"))
         {
             DBG("Response missing 'models' property");
-            return;
+            return menu;
         }
 
         auto modelsVar = obj->getProperty("models");
         if (!modelsVar.isObject())
         {
             DBG("models property is not an object");
-            return;
+            return menu;
         }
 
         auto* modelsObj = modelsVar.getDynamicObject();
         if (!modelsObj)
-            return;
-
-        // Clear existing model data
-        garyModelList.clear();
-        garyModelItems.clear();
+            return menu;
 
         int nextId = 1;  // ComboBox IDs start at 1
-        int firstSelectableId = 0;  // Track first selectable item ID
+        int& firstSelectableId = menu.firstSelectableId;  // Track first selectable item ID
 
         // Build hierarchical menu structure
-        std::vector<CustomComboBox::MenuItem> menuItems;
+        auto& menuItems = menu.menuItems;
 
         // Process each size category (small, medium, large)
         const juce::StringArray sizeCategories = {"small", "medium", "large"};
@@ -4359,7 +4912,7 @@ void Gary4juceAudioProcessorEditor::handleGaryModelsResponse(const juce::String&
                     item.isSubMenu = false;
                     menuItems.push_back(item);
 
-                    garyModelList.push_back({name, path, nextId});
+                    menu.models.push_back({name, path, nextId});
                     if (firstSelectableId == 0)
                         firstSelectableId = nextId;
 
@@ -4405,7 +4958,7 @@ void Gary4juceAudioProcessorEditor::handleGaryModelsResponse(const juce::String&
                                 item.isSubMenu = false;
                                 menuItems.push_back(item);
 
-                                garyModelList.push_back({checkpointName, checkpointPath, nextId});
+                                menu.models.push_back({checkpointName, checkpointPath, nextId});
                                 if (firstSelectableId == 0)
                                     firstSelectableId = nextId;
 
@@ -4448,7 +5001,7 @@ void Gary4juceAudioProcessorEditor::handleGaryModelsResponse(const juce::String&
                             subItem.isSubMenu = false;
                             groupItem.subItems.push_back(subItem);
 
-                            garyModelList.push_back({checkpointName, checkpointPath, nextId});
+                            menu.models.push_back({checkpointName, checkpointPath, nextId});
                             if (firstSelectableId == 0)
                                 firstSelectableId = nextId;
 
@@ -4461,51 +5014,85 @@ void Gary4juceAudioProcessorEditor::handleGaryModelsResponse(const juce::String&
             }
         }
 
-        // Update UI with hierarchical menu
+
+        menu.valid = true;
+    }
+    catch (...)
+    {
+        DBG("Exception parsing Gary models response");
+    }
+
+    return menu;
+}
+
+void Gary4juceAudioProcessorEditor::handleGaryModelsResponse(const GaryModelMenu& response)
+{
+    if (!response.received)
+    {
+        DBG("Empty Gary models response - using fallback");
+        showStatusMessage("failed to load gary models", 3000);
+
+        // Fallback to safe defaults
+        garyModelList.clear();
+        garyModelList.push_back({"vanya ai dnb 0.1", "thepatch/vanya_ai_dnb_0.1", 1});
+
+        garyModelItems.clear();
+        garyModelItems.add("vanya ai dnb 0.1");
+
         if (garyUI)
+            garyUI->setModelItems(garyModelItems, 0);
+
+        return;
+    }
+
+    if (!response.valid)
+    {
+        showStatusMessage("failed to parse gary models", 3000);
+        return;
+    }
+
+    garyModelList = response.models;
+    garyModelItems.clear();
+
+    // Update UI with hierarchical menu
+    if (garyUI)
+    {
+        auto* modelComboBox = dynamic_cast<CustomComboBox*>(&garyUI->getModelComboBox());
+        if (modelComboBox)
         {
-            auto* modelComboBox = dynamic_cast<CustomComboBox*>(&garyUI->getModelComboBox());
-            if (modelComboBox)
-            {
-                modelComboBox->setHierarchicalItems(menuItems);
+            modelComboBox->setHierarchicalItems(response.menuItems);
 
-                int selectedId = firstSelectableId;
-                if (preferredGaryModelPath.isNotEmpty())
+            int selectedId = response.firstSelectableId;
+            if (preferredGaryModelPath.isNotEmpty())
+            {
+                for (const auto& model : garyModelList)
                 {
-                    for (const auto& model : garyModelList)
+                    if (model.fullPath == preferredGaryModelPath)
                     {
-                        if (model.fullPath == preferredGaryModelPath)
-                        {
-                            selectedId = model.dropdownId;
-                            break;
-                        }
+                        selectedId = model.dropdownId;
+                        break;
                     }
                 }
+            }
 
-                if (selectedId > 0)
-                {
-                    modelComboBox->setSelectedId(selectedId, juce::dontSendNotification);
+            if (selectedId > 0)
+            {
+                modelComboBox->setSelectedId(selectedId, juce::dontSendNotification);
 
-                    for (size_t i = 0; i < garyModelList.size(); ++i)
+                for (size_t i = 0; i < garyModelList.size(); ++i)
+                {
+                    if (garyModelList[i].dropdownId == selectedId)
                     {
-                        if (garyModelList[i].dropdownId == selectedId)
-                        {
-                            currentModelIndex = static_cast<int>(i);
-                            preferredGaryModelPath = garyModelList[i].fullPath;
-                            break;
-                        }
+                        currentModelIndex = static_cast<int>(i);
+                        preferredGaryModelPath = garyModelList[i].fullPath;
+                        break;
                     }
                 }
             }
         }
-
-        DBG("Loaded " + juce::String(garyModelList.size()) + " Gary models with hierarchical menu");
-    }
-    catch (...)
-    {
-        DBG("Exception parsing Gary models response");
-        showStatusMessage("failed to parse gary models", 3000);
     }
+
+    DBG("Loaded " + juce::String(garyModelList.size()) + " Gary models with hierarchical menu");
 }
 
 juce::String Gary4juceAudioProcessorEditor::getSelectedGaryModelPath() const
@@ -4573,35 +5160,51 @@ void Gary4juceAudioProcessorEditor::checkDariusHealth()
     auto* editor = this;
 
     // Create health check request in background thread
-    juce::Thread::launch([asyncAlive, editor, healthUrl]() {
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Metadata, healthUrl, [asyncAlive, editor, healthUrl](const HttpClient::CancellationToken&) {
         juce::URL url(healthUrl);
 
-        std::unique_ptr<juce::InputStream> stream(url.createInputStream(
+        std::unique_ptr<juce::InputStream> stream(HttpClient::openStream(url,
             juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
             .withConnectionTimeoutMs(10000)  // 10 second timeout
         ));
 
         juce::String responseText;
-        bool connectionSucceeded = false;
-
         if (stream != nullptr)
-        {
             responseText = stream->readEntireStreamAsString();
-            connectionSucceeded = !responseText.isEmpty();
-        }
+
+        const auto health = parseDariusHealth(responseText);
 
         // Handle response on main thread
-        juce::MessageManager::callAsync([asyncAlive, editor, responseText, connectionSucceeded]() {
+        juce::MessageManager::callAsync([asyncAlive, editor, health]() {
             const auto alive = asyncAlive.lock();
             if (alive == nullptr || !alive->load(std::memory_order_acquire))
                 return;
 
-            editor->handleDariusHealthResponse(responseText, connectionSucceeded);
+            editor->handleDariusHealthResponse(health);
             });
         });
 }
 
-void Gary4juceAudioProcessorEditor::handleDariusHealthResponse(const juce::String& response, bool connectionSucceeded)
+Gary4juceAudioProcessorEditor::DariusHealth Gary4juceAudioProcessorEditor::parseDariusHealth(const juce::String& responseText)
+{
+    DariusHealth result;
+    result.connected = responseText.isNotEmpty();
+    if (!result.connected)
+        return result;
+
+    const auto parsed = juce::JSON::parse(responseText);
+    auto* obj = parsed.getDynamicObject();
+    if (obj == nullptr)
+        return result;
+
+    result.valid = true;
+    result.status = obj->getProperty("status").toString();
+    result.ok = (bool)obj->getProperty("ok");
+    result.warmed = (bool)obj->getProperty("warmed");
+    return result;
+}
+
+void Gary4juceAudioProcessorEditor::handleDariusHealthResponse(const DariusHealth& response)
 {
     if (dariusUI)
         dariusUI->setHealthCheckInProgress(false);
@@ -4612,7 +5215,7 @@ void Gary4juceAudioProcessorEditor::handleDariusHealthResponse(const juce::Strin
             dariusUI->setModelStatus({}, {}, {}, false, false);
     };
 
-    if (!connectionSucceeded)
+    if (!response.connected)
     {
         dariusConnected = false;
         updateDariusModelControlsEnabled();
@@ -4623,20 +5226,7 @@ void Gary4juceAudioProcessorEditor::handleDariusHealthResponse(const juce::Strin
         return;
     }
 
-    juce::var parsed;
-    try { parsed = juce::JSON::parse(response); }
-    catch (...) {
-        dariusConnected = false;
-        updateDariusModelControlsEnabled();
-        clearModelStatus();
-        if (dariusUI)
-            dariusUI->setConnectionStatus("invalid health response", juce::Colours::red);
-        showStatusMessage("invalid health response");
-        return;
-    }
-
-    auto* obj = parsed.getDynamicObject();
-    if (obj == nullptr)
+    if (!response.valid)
     {
         dariusConnected = false;
         updateDariusModelControlsEnabled();
@@ -4647,8 +5237,8 @@ void Gary4juceAudioProcessorEditor::handleDariusHealthResponse(const juce::Strin
         return;
     }
 
-    juce::String status = obj->getProperty("status").toString();
-    const bool ok = (bool)obj->getProperty("ok");
+    const auto& status = response.status;
+    const bool ok = response.ok;
 
     if (status == "template_mode")
     {
@@ -4672,7 +5262,7 @@ void Gary4juceAudioProcessorEditor::handleDariusHealthResponse(const juce::Strin
     {
         dariusConnected = true;
         updateDariusModelControlsEnabled();
-        const bool warmed = (bool)obj->getProperty("warmed");
+        const bool warmed = response.warmed;
         if (dariusUI)
             dariusUI->setConnectionStatus(warmed ? "ready" : "initializing", juce::Colours::green);
         showStatusMessage(warmed ? "darius backend ready" : "darius backend initializing");
@@ -4708,92 +5298,92 @@ void Gary4juceAudioProcessorEditor::fetchDariusConfig()
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    // Launch background fetch (same pattern as health)
-    juce::Thread::launch([asyncAlive, editor, full]()
+    // Config is polled while the model warms up, so it is never served from
+    // the cache; concurrent fetches still share one request.
+    audioProcessor.getMetadataCache().fetch(audioProcessor.getHttpClient(), juce::URL(full), 0,
+        [asyncAlive, editor](const MetadataCache::Response& response)
         {
-            juce::URL url(full);
-
-            std::unique_ptr<juce::InputStream> stream(url.createInputStream(
-                juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
-                .withConnectionTimeoutMs(10000) // 10s like health
-            ));
-
-            juce::String responseText;
-            int statusCode = 0;
-
-            if (auto* p = dynamic_cast<juce::WebInputStream*>(stream.get()))
-            {
-                // If createInputStream returns WebInputStream, we can read status
-                statusCode = p->getStatusCode();
-            }
-
-            if (stream != nullptr)
-                responseText = stream->readEntireStreamAsString();
+            const auto config = parseDariusConfig(response.body, response.statusCode);
 
             // Bounce back to main thread
-            juce::MessageManager::callAsync([asyncAlive, editor, responseText, statusCode]()
+            juce::MessageManager::callAsync([asyncAlive, editor, config]()
                 {
                     const auto alive = asyncAlive.lock();
                     if (alive == nullptr || !alive->load(std::memory_order_acquire))
                         return;
 
-                    editor->handleDariusConfigResponse(responseText, statusCode);
+                    editor->handleDariusConfigResponse(config);
                 });
         });
 }
 
-void Gary4juceAudioProcessorEditor::handleDariusConfigResponse(const juce::String& responseText, int statusCode)
+Gary4juceAudioProcessorEditor::DariusConfig Gary4juceAudioProcessorEditor::parseDariusConfig(const juce::String& responseText, int statusCode)
 {
-    if (responseText.isEmpty())
-    {
-        juce::String msg;
-        if (statusCode == 0) msg = "failed to connect to /model/config";
-        else if (statusCode >= 400) msg = "server error (HTTP " + juce::String(statusCode) + ") for /model/config";
-        else msg = "empty response from /model/config";
-        DBG(msg);
-        showStatusMessage(msg, 4000);
-        return;
-    }
+    DariusConfig result;
+    result.statusCode = statusCode;
+    result.received = responseText.isNotEmpty();
+    if (!result.received)
+        return result;
 
     // Parse JSON safely
-    juce::var parsed;
     try
     {
-        parsed = juce::JSON::parse(responseText);
+        result.config = juce::JSON::parse(responseText);
     }
     catch (...)
     {
-        showStatusMessage("invalid /model/config payload", 4000);
         DBG("Failed to parse /model/config JSON");
+        return result;
+    }
+
+    auto* obj = result.config.getDynamicObject();
+    if (obj == nullptr)
+    {
+        DBG("Config JSON is not an object");
+        return result;
+    }
+
+    result.valid = true;
+    result.size = obj->getProperty("size").toString();
+    result.repo = obj->getProperty("repo").toString();
+    result.selectedStep = obj->getProperty("selected_step").toString();
+    result.loaded = (bool)obj->getProperty("loaded");
+    result.warmed = (bool)obj->getProperty("warmup_done");
+    return result;
+}
+
+void Gary4juceAudioProcessorEditor::handleDariusConfigResponse(const DariusConfig& response)
+{
+    if (!response.received)
+    {
+        const int statusCode = response.statusCode;
+        juce::String msg;
+        if (statusCode == 0) msg = "failed to connect to /model/config";
+        else if (statusCode >= 400) msg = "server error (HTTP " + juce::String(statusCode) + ") for /model/config";
+        else msg = "empty response from /model/config";
+        DBG(msg);
+        showStatusMessage(msg, 4000);
         return;
     }
 
-    if (!parsed.isObject())
+    if (!response.valid)
     {
         showStatusMessage("unexpected /model/config format", 4000);
-        DBG("Config JSON is not an object");
         return;
     }
 
     // Keep it simple for now: stash & log some headline fields
-    lastDariusConfig = parsed;
+    lastDariusConfig = response.config;
     updateDariusModelConfigUI();
 
-    auto* obj = parsed.getDynamicObject();
-    const auto size = obj->getProperty("size").toString();
-    const auto repo = obj->getProperty("repo").toString();
-    const auto selectedStep = obj->getProperty("selected_step").toString();
-    const bool loaded = (bool)obj->getProperty("loaded");
-    const bool warmed = (bool)obj->getProperty("warmup_done");
-
-    DBG("[/model/config] size=" + size +
-        " repo=" + (repo.isEmpty() ? "-" : repo) +
-        " step=" + (selectedStep.isEmpty() ? "-" : selectedStep) +
-        " loaded=" + juce::String(loaded ? "true" : "false") +
-        " warmup=" + juce::String(warmed ? "true" : "false"));
+    DBG("[/model/config] size=" + response.size +
+        " repo=" + (response.repo.isEmpty() ? "-" : response.repo) +
+        " step=" + (response.selectedStep.isEmpty() ? "-" : response.selectedStep) +
+        " loaded=" + juce::String(response.loaded ? "true" : "false") +
+        " warmup=" + juce::String(response.warmed ? "true" : "false"));
 
     // Friendly, short status ping so we can see something in the UI for now
-    showStatusMessage("config: " + size + (warmed ? " (warm)" : ""), 2500);
+    showStatusMessage("config: " + response.size + (response.warmed ? " (warm)" : ""), 2500);
 
     fetchDariusAssetsStatus();
 }
@@ -4823,75 +5413,80 @@ void Gary4juceAudioProcessorEditor::fetchDariusCheckpoints(const juce::String& r
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, repo, revision, endpoint]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Metadata, endpoint, [asyncAlive, editor, repo, revision, endpoint](const HttpClient::CancellationToken&)
         {
             juce::URL url(endpoint);
             // Add query parameters like the Swift service (repo_id, revision)
             url = url.withParameter("repo_id", repo)
                 .withParameter("revision", revision);
 
-            std::unique_ptr<juce::InputStream> stream(url.createInputStream(
+            int statusCode = 0;
+            std::unique_ptr<juce::InputStream> stream(HttpClient::openStream(url,
                 juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                 .withConnectionTimeoutMs(10000) // same 10s as health
+                .withStatusCode(&statusCode)
             ));
 
             juce::String responseText;
-            int statusCode = 0;
-            if (auto* web = dynamic_cast<juce::WebInputStream*>(stream.get()))
-                statusCode = web->getStatusCode();
-
             if (stream != nullptr)
                 responseText = stream->readEntireStreamAsString();
 
-            juce::MessageManager::callAsync([asyncAlive, editor, responseText, statusCode]()
+            const auto checkpoints = parseDariusCheckpoints(responseText, statusCode);
+
+            juce::MessageManager::callAsync([asyncAlive, editor, checkpoints]()
                 {
                     const auto alive = asyncAlive.lock();
                     if (alive == nullptr || !alive->load(std::memory_order_acquire))
                         return;
 
-                    editor->handleDariusCheckpointsResponse(responseText, statusCode);
+                    editor->handleDariusCheckpointsResponse(checkpoints);
                 });
         });
 }
 
-void Gary4juceAudioProcessorEditor::handleDariusCheckpointsResponse(const juce::String& responseText, int statusCode)
+Gary4juceAudioProcessorEditor::DariusCheckpoints Gary4juceAudioProcessorEditor::parseDariusCheckpoints(const juce::String& responseText, int statusCode)
 {
-    if (responseText.isEmpty())
-    {
-        const juce::String msg = (statusCode == 0) ? "failed to fetch checkpoints" :
-            (statusCode >= 400) ? "checkpoints error (HTTP " + juce::String(statusCode) + ")" :
-            "empty checkpoints response";
-        DBG(msg);
-        showStatusMessage(msg, 3500);
-        dariusIsFetchingCheckpoints = false;
-        updateDariusModelControlsEnabled();
-        return;
-    }
+    DariusCheckpoints result;
+    result.statusCode = statusCode;
+    result.received = responseText.isNotEmpty();
+    if (!result.received)
+        return result;
 
-    juce::var parsed;
-    try { parsed = juce::JSON::parse(responseText); }
-    catch (...)
+    const auto parsed = juce::JSON::parse(responseText);
+    auto* obj = parsed.getDynamicObject();
+    if (obj == nullptr)
+        return result;
+
+    result.valid = true;
+    if (auto* arr = obj->getProperty("steps").getArray())
+        for (auto& v : *arr)
+            result.steps.add((int)v);
+
+    if (obj->hasProperty("latest"))
+        result.latest = (int)obj->getProperty("latest");
+
+    return result;
+}
+
+void Gary4juceAudioProcessorEditor::handleDariusCheckpointsResponse(const DariusCheckpoints& response)
+{
+    if (!response.received)
     {
-        showStatusMessage("invalid checkpoints payload", 3000);
+        const int statusCode = response.statusCode;
+        const juce::String msg = (statusCode == 0) ? "failed to fetch checkpoints" :
+            (statusCode >= 400) ? "checkpoints error (HTTP " + juce::String(statusCode) + ")" :
+            "empty checkpoints response";
+        DBG(msg);
+        showStatusMessage(msg, 3500);
         dariusIsFetchingCheckpoints = false;
         updateDariusModelControlsEnabled();
         return;
     }
 
-    if (auto* obj = parsed.getDynamicObject())
+    if (response.valid)
     {
-        dariusCheckpointSteps.clearQuick();
-        if (auto stepsVar = obj->getProperty("steps"); stepsVar.isArray())
-        {
-            auto* arr = stepsVar.getArray();
-            for (auto& v : *arr)
-                dariusCheckpointSteps.add((int)v);
-        }
-        int latest = -1;
-        if (obj->hasProperty("latest"))
-            latest = (int)obj->getProperty("latest");
-
-        dariusLatestCheckpoint = latest;
+        dariusCheckpointSteps = response.steps;
+        dariusLatestCheckpoint = response.latest;
 
         dariusIsFetchingCheckpoints = false;
         updateDariusModelControlsEnabled();
@@ -5011,7 +5606,7 @@ void Gary4juceAudioProcessorEditor::postDariusSelect(const juce::var& requestObj
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, endpoint, jsonString]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Metadata, endpoint, [asyncAlive, editor, endpoint, jsonString](const HttpClient::CancellationToken&)
         {
             juce::URL url(endpoint);
             juce::URL postUrl = url.withPOSTData(jsonString);
@@ -5023,12 +5618,10 @@ void Gary4juceAudioProcessorEditor::postDariusSelect(const juce::var& requestObj
             {
                 auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                     .withConnectionTimeoutMs(180000)
-                    .withExtraHeaders("Content-Type: application/json");
+                    .withExtraHeaders("Content-Type: application/json")
+                    .withStatusCode(&statusCode);
 
-                auto stream = postUrl.createInputStream(options);
-
-                if (auto* web = dynamic_cast<juce::WebInputStream*>(stream.get()))
-                    statusCode = web->getStatusCode();
+                auto stream = HttpClient::openStream(postUrl, options);
 
                 if (stream != nullptr)
                     responseText = stream->readEntireStreamAsString();
@@ -5393,6 +5986,7 @@ void Gary4juceAudioProcessorEditor::postDariusGenerate()
     startDariusProgressPoll(reqId);
 
     // mark UI busy state (reuse your existing flags)
+    pendingGenerationBpm = dariusUI ? dariusUI->getBpm() : audioProcessor.getCurrentBPM();
     isGenerating = true;
     genIsGenerating = true;
     setActiveOp(ActiveOp::DariusGenerate);
@@ -5409,43 +6003,46 @@ void Gary4juceAudioProcessorEditor::postDariusGenerate()
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, url]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Generation, url, [asyncAlive, editor, url](const HttpClient::CancellationToken&)
         {
-            juce::String responseText;
-            int statusCode = 0;
+            DariusGenerateResult result;
 
             try
             {
                 auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inPostData)
                     .withHttpRequestCmd("POST")
-                    .withConnectionTimeoutMs(180000);
-
-                auto stream = url.createInputStream(options);
+                    .withConnectionTimeoutMs(180000)
+                    .withStatusCode(&result.statusCode);
 
-                if (auto* web = dynamic_cast<juce::WebInputStream*>(stream.get()))
-                    statusCode = web->getStatusCode();
+                auto stream = HttpClient::openStream(url, options);
 
                 if (stream != nullptr)
-                    responseText = stream->readEntireStreamAsString();
+                {
+                    // audio_base64 goes straight to a temp file as it arrives
+                    auto response = JsonAudioStream::read(*stream, { "audio_base64" });
+                    result.responded = response.json.isNotEmpty();
+                    result.validJson = response.complete && juce::JSON::parse(response.json).isObject();
+                    result.audio = response.audio;
+                }
             }
             catch (const std::exception& e)
             {
                 DBG("generate exception: " + juce::String(e.what()));
             }
 
-            juce::MessageManager::callAsync([asyncAlive, editor, responseText, statusCode]()
+            juce::MessageManager::callAsync([asyncAlive, editor, result]()
                 {
                     const auto alive = asyncAlive.lock();
                     if (alive == nullptr || !alive->load(std::memory_order_acquire))
                         return;
 
-                    editor->handleDariusGenerateResponse(responseText, statusCode);
+                    editor->handleDariusGenerateResponse(result);
                 });
         });
 }
 
 
-void Gary4juceAudioProcessorEditor::handleDariusGenerateResponse(const juce::String& responseText, int statusCode)
+void Gary4juceAudioProcessorEditor::handleDariusGenerateResponse(const DariusGenerateResult& result)
 {
     auto finish = [this]()
         {
@@ -5463,29 +6060,24 @@ void Gary4juceAudioProcessorEditor::handleDariusGenerateResponse(const juce::Str
             repaint();
         };
 
-    if (responseText.isEmpty())
+    if (!result.responded)
     {
-        showStatusMessage(statusCode == 0 ? "generate: no connection"
-            : "generate error (HTTP " + juce::String(statusCode) + ")", 3500);
+        showStatusMessage(result.statusCode == 0 ? "generate: no connection"
+            : "generate error (HTTP " + juce::String(result.statusCode) + ")", 3500);
         generationProgress = 0;             // reset on error
         finish();
         return;
     }
 
-    juce::var parsed;
-    try { parsed = juce::JSON::parse(responseText); }
-    catch (...) {
+    if (!result.validJson)
+    {
         showStatusMessage("invalid generate response", 3000);
         generationProgress = 0;
         finish();
         return;
     }
 
-    juce::String audio64;
-    if (auto* o = parsed.getDynamicObject())
-        audio64 = o->getProperty("audio_base64").toString();
-
-    if (audio64.isEmpty())
+    if (result.audio == nullptr)
     {
         showStatusMessage("generate failed (no audio)", 3000);
         generationProgress = 0;
@@ -5494,7 +6086,7 @@ void Gary4juceAudioProcessorEditor::handleDariusGenerateResponse(const juce::Str
     }
 
     // success
-    saveGeneratedAudio(audio64);
+    saveGeneratedAudioFile(result.audio);
     generationProgress = 100;               // snap to full
     showStatusMessage("Generated!", 1500);
     finish();
@@ -5512,7 +6104,8 @@ void Gary4juceAudioProcessorEditor::startDariusProgressPoll(const juce::String&
 {
     dariusProgressRequestId = requestId;
     dariusIsPollingProgress = true;
-    dariusProgressPollTick = 0;
+    dariusPollScheduler.start();
+    dariusProgressStream = std::make_unique<ProgressStream>(makeDariusProgressURL(requestId));
     // ensure the main 50ms timer is running (you already startTimer(50) in ctor)
 }
 
@@ -5520,6 +6113,7 @@ void Gary4juceAudioProcessorEditor::stopDariusProgressPoll()
 {
     dariusIsPollingProgress = false;
     dariusProgressRequestId.clear();
+    dariusProgressStream.reset();
 }
 
 void Gary4juceAudioProcessorEditor::pollDariusProgress()
@@ -5528,15 +6122,16 @@ void Gary4juceAudioProcessorEditor::pollDariusProgress()
         return;
 
     auto url = makeDariusProgressURL(dariusProgressRequestId);
+    dariusPollScheduler.notePolled();
 
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, url]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Polling, url, [asyncAlive, editor, url](const HttpClient::CancellationToken&)
         {
             auto options = juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                 .withConnectionTimeoutMs(10000);
-            std::unique_ptr<juce::InputStream> s(url.createInputStream(options));
+            std::unique_ptr<juce::InputStream> s(HttpClient::openStream(url, options));
             if (!s) return;
 
             auto jsonText = s->readEntireStreamAsString();
@@ -5558,24 +6153,31 @@ void Gary4juceAudioProcessorEditor::pollDariusProgress()
                         if (alive == nullptr || !alive->load(std::memory_order_acquire))
                             return;
 
-                        if (!editor->dariusIsPollingProgress) return;
-
-                        // feed your smoothing fields
-                        editor->lastKnownProgress = editor->generationProgress;
-                        editor->targetProgress = juce::jlimit(0, 100, pct);
-                        editor->lastProgressUpdateTime = juce::Time::getCurrentTime().toMilliseconds();
-                        editor->smoothProgressAnimation = true;
-
-                        if (stage == "done" || stage == "error" || pct >= 100)
-                        {
-                            editor->stopDariusProgressPoll();
-                            // leave isGenerating changes to the POST response handler
-                        }
+                        editor->applyDariusProgress(pct, stage);
                     });
             }
         });
 }
 
+void Gary4juceAudioProcessorEditor::applyDariusProgress(int percent, const juce::String& stage)
+{
+    if (!dariusIsPollingProgress) return;
+
+    dariusPollScheduler.noteProgress(percent);
+
+    // feed your smoothing fields
+    lastKnownProgress = generationProgress;
+    targetProgress = juce::jlimit(0, 100, percent);
+    lastProgressUpdateTime = juce::Time::getCurrentTime().toMilliseconds();
+    smoothProgressAnimation = true;
+
+    if (stage == "done" || stage == "error" || percent >= 100)
+    {
+        stopDariusProgressPoll();
+        // leave isGenerating changes to the POST response handler
+    }
+}
+
 
 
 
@@ -5593,63 +6195,65 @@ void Gary4juceAudioProcessorEditor::fetchDariusAssetsStatus()
     const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
     auto* editor = this;
 
-    juce::Thread::launch([asyncAlive, editor, assetsStatusUrl]()
+    audioProcessor.getHttpClient().submit(HttpClient::Priority::Metadata, assetsStatusUrl, [asyncAlive, editor, assetsStatusUrl](const HttpClient::CancellationToken&)
         {
             juce::URL url(assetsStatusUrl);
 
             juce::String responseText;
-            int statusCode = 0;
 
-            std::unique_ptr<juce::InputStream> stream(url.createInputStream(
+            std::unique_ptr<juce::InputStream> stream(HttpClient::openStream(url,
                 juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                 .withConnectionTimeoutMs(10000)
             ));
-            if (auto* web = dynamic_cast<juce::WebInputStream*>(stream.get()))
-                statusCode = web->getStatusCode();
             if (stream) responseText = stream->readEntireStreamAsString();
 
-            juce::MessageManager::callAsync([asyncAlive, editor, responseText, statusCode]() {
+            const auto assets = parseDariusAssetsStatus(responseText);
+
+            juce::MessageManager::callAsync([asyncAlive, editor, assets]() {
                 const auto alive = asyncAlive.lock();
                 if (alive == nullptr || !alive->load(std::memory_order_acquire))
                     return;
 
-                editor->handleDariusAssetsStatusResponse(responseText, statusCode);
+                editor->handleDariusAssetsStatusResponse(assets);
                 });
         });
 }
 
-void Gary4juceAudioProcessorEditor::handleDariusAssetsStatusResponse(const juce::String& responseText, int statusCode)
+Gary4juceAudioProcessorEditor::DariusAssetsStatus Gary4juceAudioProcessorEditor::parseDariusAssetsStatus(const juce::String& responseText)
 {
+    DariusAssetsStatus result;
     if (responseText.isEmpty())
-        return;
+        return result;
 
-    juce::var parsed;
-    try { parsed = juce::JSON::parse(responseText); }
-    catch (...) { return; }
+    const auto parsed = juce::JSON::parse(responseText);
+    auto* o = parsed.getDynamicObject();
+    if (o == nullptr)
+        return result;
+
+    result.valid = true;
+    result.meanLoaded = (bool)o->getProperty("mean_loaded");
+    if (o->hasProperty("centroid_count") && !o->getProperty("centroid_count").isVoid())
+        result.centroidCount = (int)o->getProperty("centroid_count");
 
-    if (auto* o = parsed.getDynamicObject())
+    if (auto* arr = o->getProperty("centroid_weights").getArray())
     {
-        const bool meanLoaded = (bool)o->getProperty("mean_loaded");
-        int centroidCount = 0;
-        if (o->hasProperty("centroid_count") && !o->getProperty("centroid_count").isVoid())
-            centroidCount = (int)o->getProperty("centroid_count");
+        result.centroidWeights.reserve((size_t)arr->size());
+        for (const auto& v : *arr)
+            result.centroidWeights.push_back((double)v);
+    }
 
-        std::vector<double> weights;
-        if (auto weightsVar = o->getProperty("centroid_weights"); weightsVar.isArray())
-        {
-            if (auto* arr = weightsVar.getArray())
-            {
-                weights.reserve(arr->size());
-                for (const auto& v : *arr)
-                    weights.push_back((double)v);
-            }
-        }
+    return result;
+}
 
-        dariusAssetsMeanAvailable = meanLoaded;
-        dariusAssetsCentroidCount = juce::jmax(0, centroidCount);
+void Gary4juceAudioProcessorEditor::handleDariusAssetsStatusResponse(const DariusAssetsStatus& response)
+{
+    if (response.valid)
+    {
+        dariusAssetsMeanAvailable = response.meanLoaded;
+        dariusAssetsCentroidCount = juce::jmax(0, response.centroidCount);
 
-        if (!weights.empty())
-            dariusCentroidWeights = weights;
+        if (!response.centroidWeights.empty())
+            dariusCentroidWeights = response.centroidWeights;
         else
             dariusCentroidWeights.assign((size_t)dariusAssetsCentroidCount, 0.0);
 
@@ -5716,6 +6320,8 @@ void Gary4juceAudioProcessorEditor::changeListenerCallback(juce::ChangeBroadcast
     if (source != &audioProcessor || !isEditorValid.load())
         return;
 
+    installRestoredEmbeddedAudio();
+
     const auto hostStateRevision = audioProcessor.getHostStateRevision();
     if (hostStateRevision != lastAppliedHostStateRevision)
     {
@@ -5785,75 +6391,56 @@ void Gary4juceAudioProcessorEditor::loadOutputAudioFile()
 {
     if (!outputAudioFile.exists())
     {
-        if (activePlaybackSource == PlaybackSource::Output)
-        {
-            stopOutputPlayback();
-            activePlaybackSource = PlaybackSource::None;
-        }
-
-        hasOutputAudio = false;
-        playOutputButton.setEnabled(false);
-        stopOutputButton.setEnabled(false);
-        clearOutputButton.setEnabled(false);
-        cropButton.setEnabled(false);
-        totalAudioDuration = 0.0;
-        currentAudioSampleRate = 44100.0;
-        updateGaryButtonStates(!isGenerating);
+        applyIngestedOutput(nullptr, {});
         return;
     }
 
-    // Read the audio file for waveform display
-    juce::AudioFormatManager formatManager;
-    formatManager.registerBasicFormats();
-    std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(outputAudioFile));
-
-    if (reader != nullptr)
-    {
-        // Load into editor buffer for waveform visualization
-        outputAudioBuffer.setSize((int)reader->numChannels, (int)reader->lengthInSamples);
-        reader->read(&outputAudioBuffer, 0, (int)reader->lengthInSamples, 0, true, true);
-
-        // Store properties
-        totalAudioDuration = (double)reader->lengthInSamples / reader->sampleRate;
-        currentAudioSampleRate = reader->sampleRate;
-
-        // Loading a new output replaces any input-buffer snapshot in the
-        // shared host playback engine.
-        isPlayingInput = false;
-        isPausedInput = false;
-        currentInputPlaybackPosition = 0.0;
-        updateInputPlayButtonIcon();
+    // Read and decoded off the message thread; the editor picks up the result
+    // in applyIngestedOutput
+    outputIngest.reload(outputAudioFile, audioProcessor.getCurrentSampleRate(), makeOutputIngestCallback());
+}
 
-        isPlayingOutput = false;
-        isPausedOutput = false;
-        currentPlaybackPosition = 0.0;
-        pausedPosition = 0.0;
+ResultIngest::Callback Gary4juceAudioProcessorEditor::makeOutputIngestCallback(std::function<void()> onApplied)
+{
+    const int serial = ++outputIngestSerial;
+    const std::weak_ptr<std::atomic<bool>> asyncAlive = editorAsyncAlive;
+    auto* editor = this;
 
-        audioProcessor.loadOutputAudioForPlayback(outputAudioFile);
-        activePlaybackSource = PlaybackSource::Output;
-        updatePlayButtonIcon();
+    return [asyncAlive, editor, serial, onApplied](ResultIngest::Handle ingested, const juce::String& error)
+    {
+        juce::MessageManager::callAsync([asyncAlive, editor, serial, onApplied, ingested, error]()
+        {
+            const auto alive = asyncAlive.lock();
+            if (alive == nullptr || !alive->load(std::memory_order_acquire))
+                return;
 
-        hasOutputAudio = true;
-        playOutputButton.setEnabled(true);
-        stopOutputButton.setEnabled(true);
-        clearOutputButton.setEnabled(true);
-        cropButton.setEnabled(true);
+            // A newer load has been asked for since this one was queued
+            if (editor->outputIngestSerial != serial)
+                return;
 
-        DBG("Loaded output audio: " + juce::String(reader->lengthInSamples) + " samples, " +
-            juce::String(reader->numChannels) + " channels, " +
-            juce::String(totalAudioDuration, 2) + " seconds at " +
-            juce::String(reader->sampleRate) + " Hz");
+            editor->applyIngestedOutput(ingested, error);
+            if (ingested != nullptr && onApplied)
+                onApplied();
+        });
+    };
+}
 
-        updateGaryButtonStates(!isGenerating);
-    }
-    else
+void Gary4juceAudioProcessorEditor::applyIngestedOutput(const ResultIngest::Handle& ingested,
+                                                        const juce::String& error)
+{
+    if (ingested == nullptr)
     {
-        DBG("Failed to read output audio file");
+        if (error.isNotEmpty())
+            DBG("Failed to load output audio: " + error);
+
+        ++outputIngestSerial;
         if (activePlaybackSource == PlaybackSource::Output)
         {
             stopOutputPlayback();
             activePlaybackSource = PlaybackSource::None;
         }
+
+        outputAudio = nullptr;
         hasOutputAudio = false;
         playOutputButton.setEnabled(false);
         stopOutputButton.setEnabled(false);
@@ -5862,7 +6449,43 @@ void Gary4juceAudioProcessorEditor::loadOutputAudioFile()
         totalAudioDuration = 0.0;
         currentAudioSampleRate = 44100.0;
         updateGaryButtonStates(!isGenerating);
+        repaint();
+        return;
     }
+
+    outputAudio = ingested;
+    totalAudioDuration = ingested->getDurationSeconds();
+    currentAudioSampleRate = ingested->sampleRate;
+
+    // Loading a new output replaces any input-buffer snapshot in the
+    // shared host playback engine.
+    isPlayingInput = false;
+    isPausedInput = false;
+    currentInputPlaybackPosition = 0.0;
+    updateInputPlayButtonIcon();
+
+    isPlayingOutput = false;
+    isPausedOutput = false;
+    currentPlaybackPosition = 0.0;
+    pausedPosition = 0.0;
+
+    audioProcessor.loadOutputAudioForPlayback(ingested);
+    activePlaybackSource = PlaybackSource::Output;
+    updatePlayButtonIcon();
+
+    hasOutputAudio = true;
+    playOutputButton.setEnabled(true);
+    stopOutputButton.setEnabled(true);
+    clearOutputButton.setEnabled(true);
+    cropButton.setEnabled(true);
+
+    DBG("Loaded output audio: " + juce::String(ingested->getNumSamples()) + " samples, " +
+        juce::String(ingested->audio.getNumChannels()) + " channels, " +
+        juce::String(totalAudioDuration, 2) + " seconds at " +
+        juce::String(ingested->sampleRate) + " Hz");
+
+    updateGaryButtonStates(!isGenerating);
+    repaint();
 }
 
 juce::String Gary4juceAudioProcessorEditor::currentOperationVerb() const
@@ -5906,7 +6529,7 @@ void Gary4juceAudioProcessorEditor::drawOutputWaveform(juce::Graphics& g, const
         // PROGRESS VISUALIZATION during generation
 
         // If we have existing output, draw it first (dimmed)
-        if (hasOutputAudio && outputAudioBuffer.getNumSamples() > 0)
+        if (hasOutputAudio && getOutputNumSamples() > 0)
         {
             drawExistingOutput(g, area, 0.3f); // 30% opacity
         }
@@ -6003,7 +6626,7 @@ void Gary4juceAudioProcessorEditor::drawOutputWaveform(juce::Graphics& g, const
 
         g.drawText(displayText, area, juce::Justification::centred);
     }
-    else if (hasOutputAudio && outputAudioBuffer.getNumSamples() > 0)
+    else if (hasOutputAudio && getOutputNumSamples() > 0)
     {
         // NORMAL OUTPUT WAVEFORM display
         drawExistingOutput(g, area, 1.0f); // Full opacity
@@ -6046,61 +6669,21 @@ void Gary4juceAudioProcessorEditor::drawOutputWaveform(juce::Graphics& g, const
 void Gary4juceAudioProcessorEditor::drawExistingOutput(juce::Graphics& g, const juce::Rectangle<int>& area, float opacity)
 {
     const int waveWidth = area.getWidth() - 2;
-    const int waveHeight = area.getHeight() - 2;
-    const int centerY = area.getCentreY();
 
-    if (waveWidth <= 0 || outputAudioBuffer.getNumSamples() <= 0)
+    if (waveWidth <= 0 || getOutputNumSamples() <= 0)
         return;
 
-    // Calculate samples per pixel
-    const int samplesPerPixel = juce::jmax(1, outputAudioBuffer.getNumSamples() / waveWidth);
-
-    // Draw waveform in brand red color
-    g.setColour(juce::Colours::red.withAlpha(opacity));
+    // The columns depend only on which result is shown and how brightly, so
+    // cursor steps and progress updates reuse them
+    auto bodyKey = WaveformImageCache::initialKey;
+    bodyKey = WaveformImageCache::combine(bodyKey, (double)outputIngestSerial);
+    bodyKey = WaveformImageCache::combine(bodyKey, outputAudio.get());
+    bodyKey = WaveformImageCache::combine(bodyKey, (double)opacity);
 
-    for (int x = 0; x < waveWidth; ++x)
+    outputWaveformCache.draw(g, area, bodyKey, [this, opacity](juce::Graphics& bodyGraphics, const juce::Rectangle<int>& bodyArea)
     {
-        const int startSample = x * samplesPerPixel;
-        const int endSample = juce::jmin(startSample + samplesPerPixel, outputAudioBuffer.getNumSamples());
-
-        if (endSample > startSample)
-        {
-            // Find min/max in this pixel's worth of samples
-            float minVal = 0.0f, maxVal = 0.0f;
-
-            for (int sample = startSample; sample < endSample; ++sample)
-            {
-                // Average across channels
-                float sampleValue = 0.0f;
-                for (int ch = 0; ch < outputAudioBuffer.getNumChannels(); ++ch)
-                {
-                    sampleValue += outputAudioBuffer.getSample(ch, sample);
-                }
-                sampleValue /= outputAudioBuffer.getNumChannels();
-
-                minVal = juce::jmin(minVal, sampleValue);
-                maxVal = juce::jmax(maxVal, sampleValue);
-            }
-
-            // Scale to display area
-            const int minY = juce::jlimit(area.getY(), area.getBottom(),
-                centerY - (int)(minVal * waveHeight * 0.4f));
-            const int maxY = juce::jlimit(area.getY(), area.getBottom(),
-                centerY - (int)(maxVal * waveHeight * 0.4f));
-
-            const int drawX = area.getX() + 1 + x;
-
-            // Draw waveform line
-            if (maxY != minY)
-            {
-                g.drawVerticalLine(drawX, (float)maxY, (float)minY);
-            }
-            else
-            {
-                g.fillRect(drawX, centerY - 1, 1, 2);
-            }
-        }
-    }
+        drawOutputWaveformBody(bodyGraphics, bodyArea, opacity);
+    });
 
     // Draw playback cursor when playing, paused, OR when we have a seek position
     if ((isPlayingOutput || isPausedOutput || currentPlaybackPosition > 0.0) && totalAudioDuration > 0.0)
@@ -6140,6 +6723,73 @@ void Gary4juceAudioProcessorEditor::drawExistingOutput(juce::Graphics& g, const
     }
 }
 
+// Waveform columns of the output display, drawn over the background that
+// drawOutputWaveform has already filled.
+void Gary4juceAudioProcessorEditor::drawOutputWaveformBody(juce::Graphics& g, const juce::Rectangle<int>& area, float opacity)
+{
+    const int waveWidth = area.getWidth() - 2;
+    const int waveHeight = area.getHeight() - 2;
+    const int centerY = area.getCentreY();
+
+    const auto& audio = outputAudio->audio;
+    const auto& peaks = outputAudio->peaks;
+    const int numSamples = audio.getNumSamples();
+
+    // Calculate samples per pixel
+    const int samplesPerPixel = juce::jmax(1, numSamples / waveWidth);
+
+    // Once a pixel spans whole peak buckets, the ingest's summary is enough
+    const bool usePeaks = samplesPerPixel >= PeakPyramid::baseBlockSamples && !peaks.isEmpty();
+
+    // Draw waveform in brand red color
+    g.setColour(juce::Colours::red.withAlpha(opacity));
+
+    for (int x = 0; x < waveWidth; ++x)
+    {
+        const int startSample = x * samplesPerPixel;
+        const int endSample = juce::jmin(startSample + samplesPerPixel, numSamples);
+
+        if (endSample > startSample)
+        {
+            // Find min/max in this pixel's worth of samples
+            float minVal = 0.0f, maxVal = 0.0f;
+
+            if (usePeaks)
+            {
+                const auto peak = peaks.getPeak(startSample, endSample);
+                minVal = peak.min;
+                maxVal = peak.max;
+            }
+            else
+            {
+                // Average across channels
+                const auto summary = PeakKernel::summarise(audio, startSample, endSample - startSample,
+                                                           audio.getNumChannels());
+                minVal = summary.min;
+                maxVal = summary.max;
+            }
+
+            // Scale to display area
+            const int minY = juce::jlimit(area.getY(), area.getBottom(),
+                centerY - (int)(minVal * waveHeight * 0.4f));
+            const int maxY = juce::jlimit(area.getY(), area.getBottom(),
+                centerY - (int)(maxVal * waveHeight * 0.4f));
+
+            const int drawX = area.getX() + 1 + x;
+
+            // Draw waveform line
+            if (maxY != minY)
+            {
+                g.drawVerticalLine(drawX, (float)maxY, (float)minY);
+            }
+            else
+            {
+                g.fillRect(drawX, centerY - 1, 1, 2);
+            }
+        }
+    }
+}
+
 void Gary4juceAudioProcessorEditor::playOutputAudio()
 {
     if (!hasOutputAudio || !outputAudioFile.exists())
@@ -6156,7 +6806,12 @@ void Gary4juceAudioProcessorEditor::playOutputAudio()
         currentInputPlaybackPosition = 0.0;
         updateInputPlayButtonIcon();
 
-        audioProcessor.loadOutputAudioForPlayback(outputAudioFile);
+        // Already decoded by the ingest when it landed; the file is only
+        // streamed if that hasn't happened
+        if (outputAudio != nullptr)
+            audioProcessor.loadOutputAudioForPlayback(outputAudio);
+        else
+            audioProcessor.loadOutputAudioForPlayback(outputAudioFile);
         activePlaybackSource = PlaybackSource::Output;
         isPlayingOutput = false;
         isPausedOutput = false;
@@ -6357,45 +7012,100 @@ void Gary4juceAudioProcessorEditor::fullStopOutputPlayback()
     stopOutputPlayback(); // This does everything we need for a full stop
 }
 
-// Updated checkPlaybackStatus() - full stop when audio finishes naturally
+// Called on every display refresh. The cursor is extrapolated from the
+// processor's per-block transport snapshot rather than polled, and only the
+// strips under the old and new cursor are repainted.
 void Gary4juceAudioProcessorEditor::checkPlaybackStatus()
 {
+    if (!isPlayingInput && !isPlayingOutput)
+        return;
+
+    const auto transport = audioProcessor.getOutputTransportSnapshot();
+    const bool processorIsPlaying = audioProcessor.getIsPlayingOutput();
+
+    // Until the audio thread has run a block since the last start or seek the
+    // snapshot still describes the old position, so hold the cursor.
+    const bool snapshotIsCurrent = transport.playing
+        && transport.seekSerial == audioProcessor.getLastOutputSeekSerial();
+
     if (isPlayingInput && activePlaybackSource == PlaybackSource::Input)
     {
-        currentInputPlaybackPosition = audioProcessor.getOutputPlaybackPosition();
+        const double previousPosition = currentInputPlaybackPosition;
 
-        if (!audioProcessor.getIsPlayingOutput())
+        if (!processorIsPlaying)
         {
             isPlayingInput = false;
             isPausedInput = false;
             currentInputPlaybackPosition = 0.0;
             updateInputPlayButtonIcon();
             showStatusMessage("buffer playback finished", 1500);
+            repaint(waveformArea);
+            return;
         }
 
-        repaint();
+        if (snapshotIsCurrent)
+            currentInputPlaybackPosition = transport.getPositionSecondsAt(juce::Time::getMillisecondCounterHiRes());
+
+        repaintPlaybackCursor(waveformArea, previousPosition, currentInputPlaybackPosition,
+                              getInputWaveformDisplayDuration());
         return;
     }
 
-    // Update position from processor
     if (isPlayingOutput)
     {
-        currentPlaybackPosition = audioProcessor.getOutputPlaybackPosition();
+        const double previousPosition = currentPlaybackPosition;
 
         // Check if processor has stopped (reached end)
-        if (!audioProcessor.getIsPlayingOutput())
+        if (!processorIsPlaying)
         {
             isPlayingOutput = false;
             isPausedOutput = false;
             currentPlaybackPosition = 0.0;
+
+            // Batch takes play through one after another
+            if (currentTakeIndex >= 0 && currentTakeIndex + 1 < (int)variationTakes.size())
+            {
+                auditionTake(currentTakeIndex + 1, true);
+                return;
+            }
+
             updatePlayButtonIcon();
             showStatusMessage("playback finished", 1500);
+            repaint(outputWaveformArea);
+            return;
         }
 
-        repaint();
+        if (snapshotIsCurrent)
+            currentPlaybackPosition = transport.getPositionSecondsAt(juce::Time::getMillisecondCounterHiRes());
+
+        repaintPlaybackCursor(outputWaveformArea, previousPosition, currentPlaybackPosition, totalAudioDuration);
     }
 }
 
+void Gary4juceAudioProcessorEditor::repaintPlaybackCursor(const juce::Rectangle<int>& area,
+                                                          double previousSeconds,
+                                                          double currentSeconds,
+                                                          double durationSeconds)
+{
+    if (durationSeconds <= 0.0 || area.isEmpty())
+        return;
+
+    // Same mapping as the cursor drawing code, plus the one-pixel glow
+    const int waveWidth = juce::jmax(1, area.getWidth() - 2);
+    const auto cursorX = [&](double seconds)
+    {
+        return area.getX() + 1 + (int)(juce::jlimit(0.0, 1.0, seconds / durationSeconds) * waveWidth);
+    };
+
+    const int previousX = cursorX(previousSeconds);
+    const int currentX = cursorX(currentSeconds);
+    if (previousX == currentX)
+        return;
+
+    repaint(juce::Rectangle<int>(previousX - 1, area.getY(), 3, area.getHeight()));
+    repaint(juce::Rectangle<int>(currentX - 1, area.getY(), 3, area.getHeight()));
+}
+
 void Gary4juceAudioProcessorEditor::clearOutputAudio()
 {
     if (activePlaybackSource == PlaybackSource::Output)
@@ -6405,7 +7115,9 @@ void Gary4juceAudioProcessorEditor::clearOutputAudio()
     }
 
     hasOutputAudio = false;
-    outputAudioBuffer.clear();
+    outputAudio = nullptr;
+    ++outputIngestSerial;
+    currentTakeIndex = -1;
     playOutputButton.setEnabled(false);
     stopOutputButton.setEnabled(false);
     clearOutputButton.setEnabled(false);
@@ -6809,48 +7521,22 @@ void Gary4juceAudioProcessorEditor::loadAudioFileIntoBuffer(const juce::File& au
         // File is short enough - load directly
         DBG("File ≤" + juce::String(directLoadLimit, 0) + "s - loading directly into buffer");
 
-        // Read entire file into temp buffer
-        juce::AudioBuffer<float> tempBuffer((int)reader->numChannels, (int)reader->lengthInSamples);
-        reader->read(&tempBuffer, 0, (int)reader->lengthInSamples, 0, true, true);
-
-        // Check if resampling is needed (match existing pattern from loadOutputAudioForPlayback)
+        // Read the file, resampling block by block if it isn't at the host rate
         double fileSampleRate = reader->sampleRate;
         double hostSampleRate = audioProcessor.getCurrentSampleRate();
+        juce::AudioBuffer<float> tempBuffer;
 
         if (std::abs(fileSampleRate - hostSampleRate) > 1.0)  // Different sample rates
         {
             DBG("Resampling from " + juce::String(fileSampleRate) +
                 "Hz to " + juce::String(hostSampleRate) + "Hz");
 
-            // Calculate resampled size
-            double sizeRatio = hostSampleRate / fileSampleRate;
-            int resampledNumSamples = (int)((double)tempBuffer.getNumSamples() * sizeRatio);
-            double speedRatio = fileSampleRate / hostSampleRate;
-
-            // Create resampled buffer
-            juce::AudioBuffer<float> resampledBuffer((int)reader->numChannels, resampledNumSamples);
-
-            // Resample each channel
-            for (int channel = 0; channel < (int)reader->numChannels; ++channel)
-            {
-                juce::LagrangeInterpolator interpolator;
-                interpolator.reset();
-
-                const float* readPtr = tempBuffer.getReadPointer(channel);
-                float* writePtr = resampledBuffer.getWritePointer(channel);
-
-                interpolator.process(
-                    speedRatio,
-                    readPtr,
-                    writePtr,
-                    resampledNumSamples,
-                    tempBuffer.getNumSamples(),
-                    0
-                );
-            }
-
-            // Use resampled buffer
-            tempBuffer = std::move(resampledBuffer);
+            tempBuffer = StreamingResampler::resampleReader(*reader, 0, reader->lengthInSamples, hostSampleRate);
+        }
+        else
+        {
+            tempBuffer.setSize((int)reader->numChannels, (int)reader->lengthInSamples);
+            reader->read(&tempBuffer, 0, (int)reader->lengthInSamples, 0, true, true);
         }
 
         // Load into processor's recording buffer
@@ -6957,60 +7643,26 @@ void Gary4juceAudioProcessorEditor::loadAudioFileIntoBuffer(const juce::File& au
             // Store the selection start time for future reopening
             editor->lastSelectionStartTime = selectionStartTime;
 
-            // Make a copy of the selected buffer
-            juce::AudioBuffer<float> tempBuffer(selectedBuffer.getNumChannels(), selectedBuffer.getNumSamples());
-            for (int ch = 0; ch < selectedBuffer.getNumChannels(); ++ch)
-            {
-                tempBuffer.copyFrom(ch, 0, selectedBuffer, ch, 0, selectedBuffer.getNumSamples());
-            }
-
-            // Check if resampling is needed (match existing pattern from loadOutputAudioForPlayback)
+            // Check if resampling is needed and bring the selection to the host rate
             double hostSampleRate = editor->audioProcessor.getCurrentSampleRate();
             DBG("Host sample rate: " + juce::String(hostSampleRate) + " Hz");
 
+            juce::AudioBuffer<float> tempBuffer;
+
             if (std::abs(sourceSampleRate - hostSampleRate) > 1.0)  // Different sample rates
             {
                 DBG("Resampling from " + juce::String(sourceSampleRate) +
                     " Hz to " + juce::String(hostSampleRate) + " Hz");
 
-                // Calculate resampled size
-                double sizeRatio = hostSampleRate / sourceSampleRate;
-                int resampledNumSamples = (int)((double)tempBuffer.getNumSamples() * sizeRatio);
-                double speedRatio = sourceSampleRate / hostSampleRate;
-
-                DBG("Size ratio: " + juce::String(sizeRatio) +
-                    ", Speed ratio: " + juce::String(speedRatio));
-                DBG("Original samples: " + juce::String(tempBuffer.getNumSamples()) +
-                    ", Resampled samples: " + juce::String(resampledNumSamples));
-
-                // Create resampled buffer
-                juce::AudioBuffer<float> resampledBuffer(tempBuffer.getNumChannels(), resampledNumSamples);
-
-                // Resample each channel using JUCE's Lagrange interpolator
-                for (int channel = 0; channel < tempBuffer.getNumChannels(); ++channel)
-                {
-                    juce::LagrangeInterpolator interpolator;
-                    interpolator.reset();
-
-                    const float* readPtr = tempBuffer.getReadPointer(channel);
-                    float* writePtr = resampledBuffer.getWritePointer(channel);
-
-                    interpolator.process(
-                        speedRatio,             // Speed ratio for reading input
-                        readPtr,                // Source data
-                        writePtr,               // Destination data
-                        resampledNumSamples,    // Number of output samples
-                        tempBuffer.getNumSamples(), // Number of input samples available
-                        0                       // Wrap (0 = no wrap)
-                    );
-                }
+                tempBuffer = StreamingResampler::resampleBuffer(selectedBuffer, sourceSampleRate, hostSampleRate);
 
-                DBG("Resampling complete");
-                tempBuffer = std::move(resampledBuffer);
+                DBG("Original samples: " + juce::String(selectedBuffer.getNumSamples()) +
+                    ", Resampled samples: " + juce::String(tempBuffer.getNumSamples()));
             }
             else
             {
                 DBG("Sample rates match - no resampling needed");
+                tempBuffer.makeCopyOf(selectedBuffer);
             }
 
             // Load into processor's recording buffer (now at correct host rate)
@@ -7069,7 +7721,10 @@ void Gary4juceAudioProcessorEditor::seekToPosition(double timeInSeconds)
     if (activePlaybackSource != PlaybackSource::Output && outputAudioFile.existsAsFile())
     {
         stopInputPlayback();
-        audioProcessor.loadOutputAudioForPlayback(outputAudioFile);
+        if (outputAudio != nullptr)
+            audioProcessor.loadOutputAudioForPlayback(outputAudio);
+        else
+            audioProcessor.loadOutputAudioForPlayback(outputAudioFile);
         activePlaybackSource = PlaybackSource::Output;
         isPlayingOutput = false;
         isPausedOutput = false;
@@ -7621,7 +8276,7 @@ void Gary4juceAudioProcessorEditor::cropAudioAtCurrentPosition()
     isPausedOutput = false;
 
     // FIXED: Use the output file's native sample rate for accurate duration display
-    double newDuration = (double)outputAudioBuffer.getNumSamples() / currentAudioSampleRate;
+    double newDuration = (double)croppedBuffer.getNumSamples() / reader->sampleRate;
     DBG("New audio duration after reload: " + juce::String(newDuration, 2) + "s");
 
     showStatusMessage("audio cropped at " + juce::String(cropPosition, 1) + "s", 3000);
@@ -7733,8 +8388,10 @@ void Gary4juceAudioProcessorEditor::paint(juce::Graphics& g)
     g.setColour(juce::Colours::white);
     g.drawFittedText("recording buffer", recordingLabelArea, juce::Justification::centred, 1);
 
-    // Draw the INPUT waveform
-    drawWaveform(g, waveformArea);
+    // Draw the INPUT waveform. Timer repaints usually cover one small region,
+    // so skip the waveforms when it doesn't touch them.
+    if (g.clipRegionIntersects(waveformArea))
+        drawWaveform(g, waveformArea);
 
     // Add drag hover feedback for input waveform
     if (isDragHoveringInput)
@@ -7840,15 +8497,16 @@ void Gary4juceAudioProcessorEditor::paint(juce::Graphics& g)
     g.drawRoundedRectangle(fullTabArea.toFloat(), 5.0f, 1.0f);
 
     // Draw the OUTPUT waveform
-    drawOutputWaveform(g, outputWaveformArea);
+    if (g.clipRegionIntersects(outputWaveformArea))
+        drawOutputWaveform(g, outputWaveformArea);
 
     // Output info below output waveform
-    if (hasOutputAudio && outputAudioBuffer.getNumSamples() > 0)
+    if (hasOutputAudio && getOutputNumSamples() > 0)
     {
         // FIXED: Use stored output file sample rate instead of hardcoded 44100
-        double outputSeconds = (double)outputAudioBuffer.getNumSamples() / currentAudioSampleRate;
+        double outputSeconds = (double)getOutputNumSamples() / currentAudioSampleRate;
         juce::String outputInfo = juce::String::formatted("output: %.1fs - %d samples",
-            outputSeconds, outputAudioBuffer.getNumSamples());
+            outputSeconds, getOutputNumSamples());
         g.setFont(juce::FontOptions(11.0f));
         g.setColour(juce::Colours::lightgrey);
         // auto outputInfoArea = juce::Rectangle<int>(0, outputWaveformArea.getBottom() + 5, getWidth(), 15);
@@ -8341,6 +8999,10 @@ void Gary4juceAudioProcessorEditor::layoutOutputSection(juce::Rectangle<int> sec
     stopItem.flexGrow = 1;
     stopItem.margin = juce::FlexItem::Margin(0, 2, 0, 2);
 
+    juce::FlexItem loopItem(loopOutputButton);
+    loopItem.flexGrow = 1;
+    loopItem.margin = juce::FlexItem::Margin(0, 2, 0, 2);
+
     juce::FlexItem clearItem(clearOutputButton);
     clearItem.flexGrow = 1;
     clearItem.margin = juce::FlexItem::Margin(0, 2, 0, 2);
@@ -8348,6 +9010,7 @@ void Gary4juceAudioProcessorEditor::layoutOutputSection(juce::Rectangle<int> sec
     // Add button items to button FlexBox
     buttonFlexBox.items.add(playItem);
     buttonFlexBox.items.add(stopItem);
+    buttonFlexBox.items.add(loopItem);
     buttonFlexBox.items.add(clearItem);
 
     // Layout the buttons within their container
@@ -10,6 +10,7 @@
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
 #include "Components/Base/CustomButton.h"
+#include "Components/Base/CustomComboBox.h"
 #include "Components/Terry/TerryUI.h"
 #include "Components/Darius/DariusUI.h"
 #include "Components/Gary/GaryUI.h"
@@ -20,6 +21,12 @@
 #include "Components/AudioSelectionDialog.h"
 #include "Utils/Theme.h"
 #include "Utils/IconFactory.h"
+#include "Utils/WaveformImageCache.h"
+#include "Network/AudioUpload.h"
+#include "Network/JsonAudioStream.h"
+#include "Network/PollScheduler.h"
+#include "Network/ProgressStream.h"
+#include "Network/VariationBatch.h"
 
 #include <atomic>
 #include <memory>
@@ -51,12 +58,49 @@ public:
     void startPollingForResults(const juce::String& sessionId);
     void stopPolling();
     void pollForResults();
-    void handlePollingResponse(const juce::String& responseText);
-    void saveGeneratedAudio(const juce::String& base64Audio);
+    juce::URL getPollStatusUrl(const juce::String& sessionId) const;
+    void drainProgressStreams();
 
+    // One status from a poll or a pushed event, read out of the JSON on the
+    // thread that received it.
+    struct PollStatus
+    {
+        bool received = false;              // There was a body at all
+        bool parsed = false;                // ...and it was a JSON object
+        bool success = false;
+        juce::String error;
+        bool errorLooksLikeWarmup = false;  // Model download / cold start
+        bool generationInProgress = false;
+        bool transformInProgress = false;
+        bool hasGenerationSeed = false;
+        juce::String generationSeed;
+        int progress = 0;                   // As reported, not clamped
+        bool hasQueueStatus = false;        // A queue_status object was present
+        juce::String queueStatus;
+        juce::String queueMessage;
+        juce::String queueEstimatedTime;
+        int queuePosition = 0;
+        int queueEstimatedSeconds = 0;
+        juce::String status;
+    };
+    static PollStatus parsePollStatus(const juce::String& responseText);
+    static PollStatus readPollStatus(const juce::var& response);
+
+    void handlePollingResponse(const PollStatus& response,
+                               const JsonAudioStream::DecodedFile& receivedAudio);
+    void saveGeneratedAudioFile(JsonAudioStream::DecodedFile decodedAudio);
+    double getGenerationTempo() const;
+    void installGeneratedAudio(const std::function<void(const juce::File&, ResultIngest::Callback)>& queueIngest);
+
+    // Output audio is read, installed and decoded on outputIngest; the
+    // editor only ever sees the finished handle.
     void loadOutputAudioFile();
+    ResultIngest::Callback makeOutputIngestCallback(std::function<void()> onApplied = {});
+    void applyIngestedOutput(const ResultIngest::Handle& ingested, const juce::String& error);
+    int getOutputNumSamples() const noexcept { return outputAudio != nullptr ? outputAudio->getNumSamples() : 0; }
     void drawOutputWaveform(juce::Graphics& g, const juce::Rectangle<int>& area);
     void drawExistingOutput(juce::Graphics& g, const juce::Rectangle<int>& area, float opacity);
+    void drawOutputWaveformBody(juce::Graphics& g, const juce::Rectangle<int>& area, float opacity);
     void playOutputAudio();
     void clearOutputAudio();
 
@@ -126,6 +170,18 @@ private:
     int recordedSamples = 0;
     int savedSamples = 0;  // Track which samples have been saved
 
+    // Input waveform summary, kept in step with recordedSamples
+    PeakPyramid inputPeaks;
+    juce::uint32 inputPeaksRevision = 0;
+    juce::uint32 inputPeaksDropped = 0;     // Feed's drop count when last drained
+
+    // Waveform bodies as last drawn; only cursors and overlays paint live
+    WaveformImageCache inputWaveformCache;
+    std::uint64_t inputBodyKey = 0;         // What the cached input body was last drawn from
+    int inputBodyRecordedSamples = 0;
+    int inputBodyPeakSamples = 0;
+    WaveformImageCache outputWaveformCache;
+
     // Status message system
     juce::String statusMessage = "";
     juce::int64 statusMessageTime = 0;
@@ -230,7 +286,9 @@ private:
     void migrateGaryDataDirectory(const juce::File& destination);
     void activateGaryDataDirectory(const juce::File& directory, bool isFallback);
     void recoverCurrentAudioFiles();
+    void installRestoredEmbeddedAudio();
     bool writeDataToFileSafely(const juce::File& file, const void* data, size_t dataSize) const;
+    bool installFileSafely(const juce::File& source, const juce::File& file) const;
     bool writeAudioBufferToFileSafely(const juce::AudioBuffer<float>& buffer,
                                       double sampleRate,
                                       const juce::File& file) const;
@@ -252,6 +310,17 @@ private:
     };
     std::vector<GaryModelInfo> garyModelList;  // Maps dropdown ID -> model path
 
+    // /api/models, turned into the dropdown on the fetching thread
+    struct GaryModelMenu
+    {
+        bool received = false;
+        bool valid = false;
+        std::vector<GaryModelInfo> models;
+        std::vector<CustomComboBox::MenuItem> menuItems;
+        int firstSelectableId = 0;
+    };
+    static GaryModelMenu parseGaryModels(const juce::String& responseText);
+
     // Current Gary settings
     float currentPromptDuration = 6.0f;
     int currentModelIndex = 0;
@@ -278,16 +347,47 @@ private:
 
     // --- Darius model/config helper (first network helper)
     void fetchDariusConfig();
-    void handleDariusConfigResponse(const juce::String& responseText, int statusCode);
+    struct DariusConfig
+    {
+        int statusCode = 0;
+        bool received = false;
+        bool valid = false;
+        juce::var config;           // The whole object, kept as lastDariusConfig
+        juce::String size;
+        juce::String repo;
+        juce::String selectedStep;
+        bool loaded = false;
+        bool warmed = false;
+    };
+    static DariusConfig parseDariusConfig(const juce::String& responseText, int statusCode);
+    void handleDariusConfigResponse(const DariusConfig& response);
 
     juce::var lastDariusConfig;
 
     void checkDariusHealth();
-    void handleDariusHealthResponse(const juce::String& response, bool connectionSucceeded);
+    struct DariusHealth
+    {
+        bool connected = false;     // A non-empty body arrived
+        bool valid = false;         // ...and it was a JSON object
+        juce::String status;
+        bool ok = false;
+        bool warmed = false;
+    };
+    static DariusHealth parseDariusHealth(const juce::String& responseText);
+    void handleDariusHealthResponse(const DariusHealth& response);
 
     // --- Darius: checkpoints & select ---
     void fetchDariusCheckpoints(const juce::String& repo, const juce::String& revision);
-    void handleDariusCheckpointsResponse(const juce::String& responseText, int statusCode);
+    struct DariusCheckpoints
+    {
+        int statusCode = 0;
+        bool received = false;
+        bool valid = false;
+        juce::Array<int> steps;
+        int latest = -1;
+    };
+    static DariusCheckpoints parseDariusCheckpoints(const juce::String& responseText, int statusCode);
+    void handleDariusCheckpointsResponse(const DariusCheckpoints& response);
     void postDariusSelect(const juce::var& requestObj);
     void handleDariusSelectResponse(const juce::String& responseText, int statusCode);
 
@@ -316,7 +416,15 @@ private:
     void startDariusWarmPolling(int attempt = 0);
 
     void fetchDariusAssetsStatus();
-    void handleDariusAssetsStatusResponse(const juce::String& responseText, int statusCode);
+    struct DariusAssetsStatus
+    {
+        bool valid = false;
+        bool meanLoaded = false;
+        int centroidCount = 0;
+        std::vector<double> centroidWeights;
+    };
+    static DariusAssetsStatus parseDariusAssetsStatus(const juce::String& responseText);
+    void handleDariusAssetsStatusResponse(const DariusAssetsStatus& response);
     void clearDariusSteeringAssets();
 
     bool dariusAssetsMeanAvailable = false;
@@ -332,11 +440,22 @@ private:
     void onClickGenerate();
     void postDariusGenerate();
     juce::URL makeGenerateURL(const juce::String& requestId) const;  // NEW
-    void handleDariusGenerateResponse(const juce::String& responseText, int statusCode);
+
+    // What the generate worker reports back; the response itself is parsed
+    // and its audio decoded to disk off the message thread.
+    struct DariusGenerateResult
+    {
+        int statusCode = 0;
+        bool responded = false;     // A non-empty body arrived
+        bool validJson = false;
+        JsonAudioStream::DecodedFile audio;
+    };
+
+    void handleDariusGenerateResponse(const DariusGenerateResult& result);
 
     bool        dariusIsPollingProgress = false;
     juce::String dariusProgressRequestId;
-    int         dariusProgressPollTick = 0;   // ticks within timerCallback
+    PollScheduler dariusPollScheduler { PollScheduler::Intervals { 150, 500, 2000 } };
     int         dariusLastKnownPercent = 0;   // for local smoothing if you prefer
     int         dariusTargetPercent = 0;
     juce::int64 dariusLastUpdateMs = 0;
@@ -344,6 +463,7 @@ private:
     void startDariusProgressPoll(const juce::String& requestId);
     void stopDariusProgressPoll();
     void pollDariusProgress();                       // GET /progress?request_id=...
+    void applyDariusProgress(int percent, const juce::String& stage);
     juce::URL makeDariusProgressURL(const juce::String& reqId) const;
 
 
@@ -384,9 +504,6 @@ private:
     double currentCareyCompleteLoraScale = 1.0;
     bool currentCompleteUseSrcAsRef = false;
     juce::StringArray availableCareyLoras;
-    juce::String careyLoraFetchBackendUrl;
-    juce::int64 careyLoraLastFetchMs = 0;
-    std::atomic<bool> careyLoraFetchInFlight { false };
     std::atomic<int> careyLoraFetchNonce { 0 };
     std::atomic<int> careyCaptionRequestNonce { 0 };
     juce::String currentCoverCaption = "";
@@ -464,7 +581,6 @@ private:
     juce::StringArray availableSA3Loras;
     juce::String sa3LoraFetchBackendUrl;
     juce::int64 sa3LoraLastFetchMs = 0;
-    std::atomic<bool> sa3LoraFetchInFlight { false };
     std::atomic<int> sa3LoraFetchNonce { 0 };
     std::atomic<int> sa3PromptRequestNonce { 0 };
     void sendToSA3();
@@ -500,35 +616,72 @@ private:
 
     // Gary model API methods
     void fetchGaryAvailableModels();
-    void handleGaryModelsResponse(const juce::String& responseText);
+    static constexpr int kGaryModelsMaxAgeMs = 60 * 1000;
+    void handleGaryModelsResponse(const GaryModelMenu& response);
     juce::String getSelectedGaryModelPath() const;
 
     void fetchJerryAvailableModels(bool force = false);
-    void handleJerryModelsResponse(const juce::String& responseText);
+    juce::String getJerryModelsStatusUrl() const;
+    // Short: the list also says which model is live, and a switch made from
+    // another client wouldn't invalidate it
+    static constexpr int kJerryModelsMaxAgeMs = 5 * 1000;
+
+    // /models/status, one entry per cached model
+    struct JerryModelList
+    {
+        bool valid = false;
+        juce::StringArray names;
+        juce::StringArray keys;
+        juce::StringArray types;
+        juce::StringArray repos;
+        juce::StringArray checkpoints;
+        juce::Array<bool> isFinetune;
+        juce::String activeKey;     // The model the backend has live
+    };
+    static JerryModelList parseJerryModels(const juce::String& responseText);
+    void handleJerryModelsResponse(const JerryModelList& response);
 
     // Custom finetune methods
     void fetchJerryCheckpoints(const juce::String& repo);
-    void handleJerryCheckpointsResponse(const juce::String& responseText);
+    static constexpr int kJerryCheckpointsMaxAgeMs = 30 * 1000;
+    // /models/checkpoints for a finetune repo
+    struct JerryCheckpoints
+    {
+        bool received = false;      // A non-empty body arrived
+        bool valid = false;         // ...and it was a JSON object
+        bool success = false;
+        juce::StringArray checkpoints;
+        juce::String error;
+    };
+    static JerryCheckpoints parseJerryCheckpoints(const juce::String& responseText);
+    void handleJerryCheckpointsResponse(const JerryCheckpoints& response);
     void addCustomJerryModel(const juce::String& repo, const juce::String& checkpoint);
     void handleAddCustomModelResponse(const juce::String& responseText,
                                        const juce::String& repo,
                                        const juce::String& checkpoint);
-    juce::String extractCheckpointInfo(const juce::String& checkpoint);
+    static juce::String extractCheckpointInfo(const juce::String& checkpoint);
+
+    // /models/prompts for one finetune
+    struct JerryPromptBank
+    {
+        bool valid = false;
+        juce::String repo;
+        juce::String checkpoint;
+        juce::var prompts;
+    };
+    static JerryPromptBank parseJerryPrompts(const juce::String& jsonText,
+        const juce::String& repo,
+        const juce::String& checkpoint);
 
     void fetchJerryPrompts(const juce::String& repo, const juce::String& checkpoint);
-    void applyJerryPromptsToUI(const juce::String& repo,
-        const juce::String& checkpoint,
-        const juce::String& jsonText,
-        int statusCode = 200);
+    void applyJerryPromptsToUI(const JerryPromptBank& bank);
 
     void maybeFetchRemoteJerryPrompts(); // gatekeeper for remote mode, avoids hammering
 
     // Optional local cache to avoid re-fetching
-    juce::HashMap<juce::String, juce::String> promptsCache; // key: repo + "|" + checkpoint
+    juce::HashMap<juce::String, JerryPromptBank> promptsCache; // key: repo + "|" + checkpoint
 
-    // Debounce/TTL state
-    std::atomic<bool> promptsFetchInFlight{ false };
-    std::int64_t lastPromptsFetchMs = 0;
+    // How long the shared cache may answer a prompts fetch
     static constexpr std::int64_t kPromptsTTLms = 5 * 60 * 1000; // 5 minutes
 
     juce::URL buildPromptsUrl(const juce::String& repo,
@@ -559,6 +712,18 @@ private:
     void sendToTerry();
     void undoTerryTransform();
 
+    // What the undo worker reports back; the restored audio is decoded to
+    // disk and the rest of the response parsed off the message thread.
+    struct TerryUndoResult
+    {
+        int statusCode = 0;
+        bool responded = false;     // A non-empty body arrived
+        bool validJson = false;
+        bool success = false;
+        juce::String error;
+        JsonAudioStream::DecodedFile audio;
+    };
+
     // Backend toggle methods
     juce::String getServiceUrl(ServiceType service, const juce::String& endpoint) const;
     void toggleBackend();
@@ -575,9 +740,11 @@ private:
 
     // UI Helper methods
     void updateRecordingStatus();
+    void updateInputPeaks();
     void saveRecordingBuffer();
     void clearRecordingBuffer();
     void drawWaveform(juce::Graphics& g, const juce::Rectangle<int>& area);
+    void drawInputWaveformBody(juce::Graphics& g, const juce::Rectangle<int>& area);
     void showStatusMessage(const juce::String& message, int durationMs = 3000);
     juce::String cleanCareyQueueMessage(const juce::String& raw);
     void sendToGary();
@@ -606,7 +773,10 @@ private:
     bool isPolling = false;
 
     // Output audio management
-    juce::AudioBuffer<float> outputAudioBuffer;
+    ResultIngest outputIngest;
+    ResultIngest::Handle outputAudio;     // nullptr until an ingest lands
+    int outputIngestSerial = 0;           // Only the newest ingest is applied
+    double pendingGenerationBpm = 0.0;    // Tempo of the request in flight, for loop length
     juce::File outputAudioFile;
     double currentAudioSampleRate = 44100.0;  // Store the actual sample rate of loaded audio
     bool hasOutputAudio = false;
@@ -628,6 +798,7 @@ private:
     CustomButton clearOutputButton;
     juce::Label outputLabel;
     CustomButton stopOutputButton;
+    CustomButton loopOutputButton;
     juce::DrawableButton cropButton;
     juce::DrawableButton uploadButton;
 
@@ -642,6 +813,10 @@ private:
     double inputPlaybackDuration = 0.0;
     int inputPlaybackSnapshotSamples = 0;
 
+    // Last recording journal overflow state reported to the user
+    int lastRecordingOverflowCount = 0;
+    juce::int64 lastRecordingDroppedSamples = 0;
+
     // Playback cursor tracking
     double currentPlaybackPosition = 0.0;  // Current position in seconds
     double totalAudioDuration = 0.0;      // Total duration of loaded audio in seconds
@@ -712,7 +887,7 @@ private:
     // Crop and continue functionality
     void cropAudioAtCurrentPosition();
     void continueMusic();
-    void sendContinueRequest(const juce::String& audioData);
+    void sendContinueRequest(const AudioUpload::Source& audioData);
     void retryLastContinuation();
     void updateRetryButtonState();
     void updateContinueButtonState();
@@ -784,7 +959,6 @@ private:
     std::shared_ptr<std::atomic<bool>> editorAsyncAlive{ std::make_shared<std::atomic<bool>>(true) };
     juce::int64 editorCreatedAtMs = 0;
     std::atomic<bool> garyModelFetchScheduled{ false };
-    std::atomic<bool> garyModelFetchInFlight{ false };
     int persistentStateTimerTicks = 0;
     std::uint64_t lastAppliedHostStateRevision = 0;
     bool applyingProcessorState = false;
@@ -795,6 +969,44 @@ private:
     std::atomic<GenerationAsyncToken> generationAsyncToken{ 0 };
     std::atomic<bool> pollInFlight{ false };   // prevent overlapping polls
     juce::int64 lastGoodPollMs = 0;             // for diagnostics / backoff (optional)
+    PollScheduler pollScheduler;                // when the next poll_status is due
+
+    // Pushed status, when the backend offers it; polling covers the rest
+    std::unique_ptr<ProgressStream> progressStream;
+    std::unique_ptr<ProgressStream> dariusProgressStream;
+
+    // Batch mode: with variationsPerSend above 1, gary, terry and sa3 sends
+    // go out as several variations at once. The first take to finish ends the
+    // wait; the rest land in the take list, and playing one through moves on
+    // to the next.
+    void startVariationBatch(ServiceType service, std::vector<VariationBatch::Variation> variations);
+    void serviceVariationBatch();
+    void auditionTake(int takeIndex, bool startPlaying);
+    void clearVariationTakes();
+    static VariationBatch::Status readBatchStatus(const juce::String& responseText);
+    static constexpr int kMaxVariationsPerSend = 4;
+    static constexpr int kVariationBatchDefaultConcurrency = 2;    // When /health doesn't say
+    static constexpr int kVariationBatchHealthMaxAgeMs = 60 * 1000;
+
+    std::unique_ptr<VariationBatch> variationBatch;
+    int variationBatchSerial = 0;
+    ServiceType variationBatchService = ServiceType::Gary;
+    double variationTakesBpm = 0.0;                     // Tempo the batch was sent at
+    juce::String variationBatchError;                   // Last failed variation's reason
+    // A finished take, decoded on takeIngest as soon as it lands so that
+    // moving on to it is just a handle swap.
+    struct VariationTake
+    {
+        VariationBatch::Take take;
+        ResultIngest::Handle ingested;                  // nullptr until decoded
+    };
+
+    void prepareVariationTake(int takeIndex);
+
+    std::vector<VariationTake> variationTakes;          // In the order they finished
+    ResultIngest takeIngest;
+    int currentTakeIndex = -1;
+    int variationsPerSend = 1;
 
     std::unique_ptr<juce::PropertiesFile> updatePreferences;
     std::atomic<bool> updateCheckInFlight{ false };
@@ -819,7 +1031,11 @@ private:
     juce::String deferredUpdatePublishedAt;
     juce::StringArray deferredUpdateNotes;
 
-    
+    // Playback cursor follows the processor's transport snapshot at display
+    // refresh rate. Declared last so it detaches before anything it touches.
+    void repaintPlaybackCursor(const juce::Rectangle<int>& area, double previousSeconds,
+                               double currentSeconds, double durationSeconds);
+    juce::VBlankAttachment playbackCursorVBlank { this, [this] { checkPlaybackStatus(); } };
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Gary4juceAudioProcessorEditor)
 };
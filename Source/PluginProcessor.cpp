@@ -41,6 +41,106 @@ namespace
 
         return backendHealthBodyLooksOnline(responseText);
     }
+
+    // Plugin state chunk: magic, format version, then tag + length framed
+    // sections. Version 2 and earlier were XML written by copyXmlToBinary.
+    constexpr int makeStateTag(char a, char b, char c, char d) noexcept
+    {
+        return (int)((juce::uint32)(juce::uint8)a | ((juce::uint32)(juce::uint8)b << 8)
+                     | ((juce::uint32)(juce::uint8)c << 16) | ((juce::uint32)(juce::uint8)d << 24));
+    }
+
+    constexpr int stateMagic = makeStateTag('G', '4', 'J', 'S');
+    constexpr int currentStateVersion = 3;
+    constexpr int coreSectionTag = makeStateTag('c', 'o', 'r', 'e');
+    constexpr int editorSectionTag = makeStateTag('e', 'd', 'i', 't');
+    constexpr int foundationSectionTag = makeStateTag('f', 'n', 'd', 'n');
+    constexpr int recordingAudioSectionTag = makeStateTag('r', 'e', 'c', 'f');
+    constexpr int outputAudioSectionTag = makeStateTag('o', 'u', 't', 'f');
+    constexpr int embeddedAudioChunkSamples = 65536;
+
+    void writeStateSection(juce::OutputStream& out, int tag, const juce::MemoryBlock& sectionData)
+    {
+        out.writeInt(tag);
+        out.writeInt((int)sectionData.getSize());
+        out.write(sectionData.getData(), sectionData.getSize());
+    }
+
+    // 24-bit FLAC of the first numSamples of audio, or an empty block when
+    // FLAC is unavailable, the encode fails or shouldStop turns true. Written
+    // a chunk at a time so a stop is noticed part way through.
+    juce::MemoryBlock encodeEmbeddedFlac(const juce::AudioBuffer<float>& audio, int numSamples, double sampleRate,
+                                         const std::function<bool()>& shouldStop)
+    {
+        juce::MemoryBlock encoded;
+
+       #if JUCE_USE_FLAC
+        if (numSamples <= 0 || sampleRate <= 0.0 || audio.getNumChannels() <= 0)
+            return encoded;
+
+        auto stream = std::make_unique<juce::MemoryOutputStream>(encoded, false);
+        juce::FlacAudioFormat flacFormat;
+        std::unique_ptr<juce::AudioFormatWriter> writer(flacFormat.createWriterFor(
+            stream.get(), sampleRate, (unsigned int)audio.getNumChannels(), 24, {}, 5));
+        if (writer == nullptr)
+            return encoded;
+
+        stream.release();
+        bool written = true;
+        for (int position = 0; written && position < numSamples; position += embeddedAudioChunkSamples)
+        {
+            if (shouldStop())
+            {
+                written = false;
+                break;
+            }
+
+            written = writer->writeFromAudioSampleBuffer(audio, position, juce::jmin(embeddedAudioChunkSamples, numSamples - position));
+        }
+        writer.reset();
+
+        if (!written)
+            encoded.reset();
+       #else
+        juce::ignoreUnused(audio, numSamples, sampleRate, shouldStop);
+       #endif
+
+        return encoded;
+    }
+
+    // Moves a fully written file over destination, keeping the previous file
+    // until the new one is in place. The source is left alone on failure.
+    bool installRecordingFile(const juce::File& source, const juce::File& destination)
+    {
+        juce::File previousFile;
+        if (destination.existsAsFile())
+        {
+            previousFile = destination.getParentDirectory().getNonexistentChildFile(
+                destination.getFileNameWithoutExtension() + ".previous", destination.getFileExtension(), true);
+            if (!destination.moveFileTo(previousFile))
+            {
+                DBG("Could not preserve existing recording before replacement");
+                return false;
+            }
+        }
+
+        if (!source.moveFileTo(destination))
+        {
+            DBG("Could not install newly written recording");
+            if (previousFile.existsAsFile() && !previousFile.moveFileTo(destination))
+            {
+                DBG("Could not restore previous recording: " + previousFile.getFullPathName());
+            }
+            return false;
+        }
+
+        if (previousFile.existsAsFile() && !previousFile.deleteFile())
+        {
+            DBG("Could not remove previous recording backup: " + previousFile.getFullPathName());
+        }
+
+        return true;
+    }
 }
 
 class Gary4juceAudioProcessor::BackendHealthChecker final : public juce::Thread
@@ -134,7 +234,7 @@ public:
             int statusCode = 0;
 
             std::unique_ptr<juce::InputStream> stream(
-                healthUrl.createInputStream(
+                HttpClient::openStream(healthUrl,
                     juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
                         .withConnectionTimeoutMs(3000)
                         .withStatusCode(&statusCode)
@@ -180,6 +280,153 @@ private:
     bool hasPendingRequest = false;
 };
 
+// Drains the recording ring into recordingBuffer off the audio thread. It is the
+// only thread that appends to the buffer, so snapshot readers holding bufferLock
+// can stall it for as long as they like without the audio thread noticing.
+class Gary4juceAudioProcessor::RecordingWriter final : public juce::Thread
+{
+public:
+    explicit RecordingWriter(Gary4juceAudioProcessor& ownerToUse)
+        : juce::Thread("gary4juce recording writer"),
+          owner(ownerToUse)
+    {
+        startThread();
+    }
+
+    ~RecordingWriter() override
+    {
+        stopThread(2000);
+    }
+
+    void run() override
+    {
+        while (!threadShouldExit())
+        {
+            owner.drainRecordingRing();
+            wait(drainIntervalMs);
+        }
+    }
+
+private:
+    static constexpr int drainIntervalMs = 5;
+    Gary4juceAudioProcessor& owner;
+};
+
+// Keeps the FLAC copies of the recording and the output that
+// getStateInformation hands out up to date, between takes. Kept apart from
+// the recording writer so an encode of minutes of audio never holds up the
+// ring; a take that starts mid-encode stops it.
+class Gary4juceAudioProcessor::EmbeddedAudioEncoder final : public juce::Thread
+{
+public:
+    explicit EmbeddedAudioEncoder(Gary4juceAudioProcessor& ownerToUse)
+        : juce::Thread("gary4juce embedded audio encoder"),
+          owner(ownerToUse)
+    {
+        startThread(juce::Thread::Priority::background);
+    }
+
+    ~EmbeddedAudioEncoder() override
+    {
+        stopThread(4000);
+    }
+
+    void run() override
+    {
+        const auto shouldStop = [this] { return threadShouldExit() || owner.atomicRecording.load(); };
+
+        while (!threadShouldExit())
+        {
+            owner.refreshEmbeddedAudioCache(shouldStop);
+            wait(refreshIntervalMs);
+        }
+    }
+
+private:
+    static constexpr int refreshIntervalMs = 500;
+    Gary4juceAudioProcessor& owner;
+};
+
+// Decodes the FLAC audio carried by a restored state chunk so that
+// setStateInformation only has to copy bytes. The results go back to the
+// owner; a newer restore stops this one first.
+class Gary4juceAudioProcessor::EmbeddedAudioDecoder final : public juce::Thread
+{
+public:
+    EmbeddedAudioDecoder(Gary4juceAudioProcessor& ownerToUse,
+                         juce::MemoryBlock recordingData,
+                         juce::MemoryBlock outputData)
+        : juce::Thread("gary4juce embedded audio"),
+          owner(ownerToUse),
+          recordingFlac(std::move(recordingData)),
+          outputFlac(std::move(outputData))
+    {
+        startThread(juce::Thread::Priority::background);
+    }
+
+    ~EmbeddedAudioDecoder() override
+    {
+        stopThread(4000);
+    }
+
+    void run() override
+    {
+        auto recording = decode(recordingFlac, recordingLengthSeconds);
+        auto output = decode(outputFlac, maxEmbeddedAudioSeconds);
+
+        if (!threadShouldExit())
+            owner.embeddedAudioDecoded(std::move(recording), std::move(output));
+    }
+
+private:
+    // The header's claims are checked before anything is allocated, so a
+    // damaged or hostile chunk can't ask for gigabytes.
+    std::unique_ptr<EmbeddedAudio> decode(const juce::MemoryBlock& data, double maxSeconds)
+    {
+       #if JUCE_USE_FLAC
+        if (data.isEmpty())
+            return nullptr;
+
+        juce::FlacAudioFormat flacFormat;
+        std::unique_ptr<juce::AudioFormatReader> reader(
+            flacFormat.createReaderFor(new juce::MemoryInputStream(data, false), true));
+
+        if (reader == nullptr || reader->sampleRate <= 0.0 || reader->sampleRate > maxEmbeddedAudioSampleRate
+            || reader->numChannels == 0 || reader->lengthInSamples <= 0
+            || reader->lengthInSamples > (juce::int64)(maxSeconds * reader->sampleRate)
+            || reader->lengthInSamples > (juce::int64)data.getSize() * maxEmbeddedSamplesPerByte)
+        {
+            DBG("Ignoring embedded audio that is unreadable or over the size limit");
+            return nullptr;
+        }
+
+        // Reading into a stereo buffer drops any channels beyond it
+        auto audio = std::make_unique<EmbeddedAudio>();
+        audio->sampleRate = reader->sampleRate;
+        audio->buffer.setSize(juce::jmin((int)reader->numChannels, maxEmbeddedAudioChannels),
+                              (int)reader->lengthInSamples);
+
+        for (juce::int64 position = 0; position < reader->lengthInSamples; position += embeddedAudioChunkSamples)
+        {
+            if (threadShouldExit())
+                return nullptr;
+
+            const int count = (int)juce::jmin((juce::int64)embeddedAudioChunkSamples, reader->lengthInSamples - position);
+            reader->read(&audio->buffer, (int)position, count, position, true, true);
+        }
+
+        return audio;
+       #else
+        juce::ignoreUnused(data);
+        return nullptr;
+       #endif
+    }
+
+    Gary4juceAudioProcessor& owner;
+    const juce::MemoryBlock recordingFlac;
+    const juce::MemoryBlock outputFlac;
+};
+
 //==============================================================================
 Gary4juceAudioProcessor::Gary4juceAudioProcessor()
 #ifndef JucePlugin_PreferredChannelConfigurations
@@ -194,8 +441,11 @@ Gary4juceAudioProcessor::Gary4juceAudioProcessor()
 #endif
 {
     DBG("=== PROCESSOR CREATED ===");
+    playbackReadAheadThread.startThread();
     backendHealthCallbackToken = std::make_shared<std::atomic<bool>>(true);
     backendHealthChecker = std::make_unique<BackendHealthChecker>();
+    recordingWriter = std::make_unique<RecordingWriter>(*this);
+    embeddedAudioEncoder = std::make_unique<EmbeddedAudioEncoder>(*this);
 }
 
 Gary4juceAudioProcessor::~Gary4juceAudioProcessor()
@@ -203,6 +453,9 @@ Gary4juceAudioProcessor::~Gary4juceAudioProcessor()
     DBG("=== PROCESSOR DESTROYED ===");
     DBG("=== STOPPING PROCESSOR BACKGROUND OPERATIONS ===");
 
+    embeddedAudioDecoder.reset();
+    embeddedAudioEncoder.reset();
+
     if (backendHealthCallbackToken)
     {
         backendHealthCallbackToken->store(false);
@@ -215,6 +468,11 @@ Gary4juceAudioProcessor::~Gary4juceAudioProcessor()
         backendHealthChecker->stop();
         backendHealthChecker.reset();
     }
+
+    recordingWriter.reset();
+
+    const juce::ScopedLock writerLock(recordingWriterLock);
+    discardRecordingSpool();
 }
 
 void Gary4juceAudioProcessor::stopHealthChecks()
@@ -396,210 +654,418 @@ bool Gary4juceAudioProcessor::isSessionValid() const
 void Gary4juceAudioProcessor::setEditorState(const juce::String& json)
 {
     const juce::ScopedLock lock(editorStateLock);
-    editorState = json;
+    editorState.set(json);
 }
 
 juce::String Gary4juceAudioProcessor::getEditorState() const
 {
     const juce::ScopedLock lock(editorStateLock);
-    return editorState;
+    return editorState.get();
+}
+
+void Gary4juceAudioProcessor::setFoundationState(const juce::String& json)
+{
+    const juce::ScopedLock lock(editorStateLock);
+    foundationState.set(json);
+}
+
+juce::String Gary4juceAudioProcessor::getFoundationState() const
+{
+    const juce::ScopedLock lock(editorStateLock);
+    return foundationState.get();
 }
 
 //==============================================================================
 // Recording buffer methods
 
-void Gary4juceAudioProcessor::startRecording()
+void Gary4juceAudioProcessor::pushRecordingInputFromAudioThread(const juce::AudioBuffer<float>& sourceBuffer,
+                                                                int totalNumInputChannels,
+                                                                bool isCurrentlyPlaying) noexcept
 {
-    DBG("Starting recording...");
-    juce::ScopedLock lock(bufferLock);
+    // Detect when transport starts (transition from not playing to playing)
+    if (isCurrentlyPlaying && !wasPlaying)
+    {
+        audioThreadTakeStartPending = true;
+    }
+    else if (!isCurrentlyPlaying && wasPlaying)
+    {
+        audioThreadTakeStartPending = false;
 
-    recordingStartPending.store(false);
-    recordingStopPending.store(false);
-    bufferWritePosition = 0;
-    recordedSamples = 0;
-    deferredRecordingSamples = 0;
-    deferredRecordingOverflowed = false;
-    atomicRecordedSamples = 0;
-    recording = true;
-    atomicRecording = true;
-}
+        if (audioThreadRecording)
+        {
+            audioThreadRecording = false;
+            audioThreadTakeStopPending = true;
+            atomicRecording.store(false, std::memory_order_release);
+        }
+    }
 
-void Gary4juceAudioProcessor::stopRecording()
-{
-    juce::ScopedLock lock(bufferLock);
+    if (audioThreadTakeStopPending && recordingRing.pushMarker(RecordingRing::ChunkKind::TakeStop))
+        audioThreadTakeStopPending = false;
 
-    DBG("Stopping recording. Recorded " + juce::String(recordedSamples) + " samples");
-    recordingStartPending.store(false);
-    recordingStopPending.store(false);
-    recording = false;
-    atomicRecording = false;
-    atomicRecordedSamples = recordedSamples;
-}
+    if (audioThreadTakeStartPending && !audioThreadTakeStopPending
+        && recordingRing.pushMarker(RecordingRing::ChunkKind::TakeStart))
+    {
+        audioThreadTakeStartPending = false;
+        audioThreadRecording = true;
+        audioThreadTakeSamples = 0;
+        atomicRecording.store(true, std::memory_order_release);
+    }
 
-void Gary4juceAudioProcessor::requestRecordingStartFromAudioThread() noexcept
-{
-    recordingStopPending.store(false, std::memory_order_release);
-    recordingStartPending.store(true, std::memory_order_release);
-}
+    if (!audioThreadRecording || !isCurrentlyPlaying)
+        return;
 
-void Gary4juceAudioProcessor::requestRecordingStopFromAudioThread() noexcept
-{
-    recordingStartPending.store(false, std::memory_order_release);
-    recordingStopPending.store(true, std::memory_order_release);
-}
+    const int samplesToRecord = juce::jmin(sourceBuffer.getNumSamples(),
+                                           maxRecordingSamples - audioThreadTakeSamples);
+    if (samplesToRecord > 0)
+    {
+        recordingRing.pushAudio(sourceBuffer, totalNumInputChannels, samplesToRecord);
+        audioThreadTakeSamples += samplesToRecord;
+    }
 
-void Gary4juceAudioProcessor::applyPendingRecordingStateFromAudioThread(int totalNumInputChannels,
-                                                                        bool& stoppedThisBlock)
-{
-    if (recordingStopPending.exchange(false, std::memory_order_acq_rel))
+    if (audioThreadTakeSamples >= maxRecordingSamples)
     {
-        flushDeferredRecordingBlocks(totalNumInputChannels);
-        DBG("Stopping recording. Recorded " + juce::String(recordedSamples) + " samples");
-        recording = false;
-        stoppedThisBlock = true;
+        // Recording buffer full - stop the take; the writer publishes the final count.
+        audioThreadRecording = false;
+        audioThreadTakeStopPending = !recordingRing.pushMarker(RecordingRing::ChunkKind::TakeStop);
         atomicRecording.store(false, std::memory_order_release);
-        atomicRecordedSamples.store(recordedSamples, std::memory_order_release);
     }
+}
+
+void Gary4juceAudioProcessor::drainRecordingRing()
+{
+    const juce::ScopedLock writerLock(recordingWriterLock);
+    bool hasUnpublishedSamples = false;
 
-    if (recordingStartPending.exchange(false, std::memory_order_acq_rel))
+    recordingRing.drain([this, &hasUnpublishedSamples](const RecordingRing::Chunk& chunk,
+                                                       const juce::AudioBuffer<float>& storage,
+                                                       int storageStart)
     {
-        DBG("Starting recording...");
-        bufferWritePosition = 0;
-        recordedSamples = 0;
-        atomicRecordedSamples.store(0, std::memory_order_release);
-        recording = true;
-        atomicRecording.store(true, std::memory_order_release);
+        switch (chunk.kind)
+        {
+            case RecordingRing::ChunkKind::TakeStart:
+            {
+                openRecordingSpool(recordingBuffer.getNumChannels());
+
+                // A reader may still be copying the previous take out of the
+                // buffer; wait for it before overwriting from the start.
+                const juce::ScopedLock lock(bufferLock);
+                DBG("Starting recording...");
+                shrinkRecordingBuffer();
+                bufferWritePosition = 0;
+                recordedSamples = 0;
+                recording = true;
+                hasUnpublishedSamples = false;
+                atomicRecordedSamples.store(0, std::memory_order_release);
+                recordingTakeGapSamples.store(0, std::memory_order_release);
+                recordingPeakFeed.beginTake(recordingContentRevision.fetch_add(1) + 1);
+                break;
+            }
+
+            case RecordingRing::ChunkKind::Gap:
+            {
+                if (!recording)
+                    break;
+
+                // The ring overflowed while we were stalled. Pad with silence
+                // so everything after the loss stays where it was played.
+                const int samplesToPad = juce::jmin(chunk.numSamples, maxRecordingSamples - bufferWritePosition);
+                DBG("Recording journal overflowed - padding " + juce::String(samplesToPad) + " samples");
+
+                if (bufferWritePosition + samplesToPad > recordingBuffer.getNumSamples())
+                {
+                    const juce::ScopedLock lock(bufferLock);
+                    growRecordingBuffer(bufferWritePosition + samplesToPad);
+                }
+
+                for (int padded = 0; padded < samplesToPad;)
+                {
+                    const int count = juce::jmin(samplesToPad - padded, recordingGapBuffer.getNumSamples());
+                    for (int channel = 0; channel < recordingBuffer.getNumChannels(); ++channel)
+                        juce::FloatVectorOperations::clear(recordingBuffer.getWritePointer(channel, bufferWritePosition), count);
+
+                    writeRecordingSpool(recordingGapBuffer, 0, count);
+                    bufferWritePosition += count;
+                    padded += count;
+                }
+
+                recordingPeakFeed.addSilence(samplesToPad);
+
+                recordingTakeGapSamples.fetch_add(samplesToPad, std::memory_order_acq_rel);
+                hasUnpublishedSamples = samplesToPad > 0 || hasUnpublishedSamples;
+                atomicRecordedSamples.store(bufferWritePosition, std::memory_order_release);
+
+                if (bufferWritePosition >= maxRecordingSamples)
+                {
+                    finishRecordingSpool();
+                    recordingPeakFeed.endTake();
+
+                    const juce::ScopedLock lock(bufferLock);
+                    recordedSamples = bufferWritePosition;
+                    recording = false;
+                    hasUnpublishedSamples = false;
+                }
+                break;
+            }
+
+            case RecordingRing::ChunkKind::TakeStop:
+            {
+                if (recording)
+                {
+                    finishRecordingSpool();
+                    recordingPeakFeed.endTake();
+
+                    const juce::ScopedLock lock(bufferLock);
+                    recordedSamples = bufferWritePosition;
+                    recording = false;
+                    hasUnpublishedSamples = false;
+                    DBG("Stopping recording. Recorded " + juce::String(recordedSamples) + " samples");
+                }
+                break;
+            }
+
+            case RecordingRing::ChunkKind::Audio:
+            {
+                if (!recording)
+                    break;
+
+                const int samplesToWrite = juce::jmin(chunk.numSamples, maxRecordingSamples - bufferWritePosition);
+                if (samplesToWrite > 0)
+                {
+                    // Reallocating moves what readers copy from, so only that
+                    // takes the lock
+                    if (bufferWritePosition + samplesToWrite > recordingBuffer.getNumSamples())
+                    {
+                        const juce::ScopedLock lock(bufferLock);
+                        growRecordingBuffer(bufferWritePosition + samplesToWrite);
+                    }
+
+                    // Appends land past recordedSamples, which no snapshot reader
+                    // looks at, so this copy does not need bufferLock.
+                    const int channelsToWrite = juce::jmin(storage.getNumChannels(), recordingBuffer.getNumChannels());
+                    for (int channel = 0; channel < channelsToWrite; ++channel)
+                        juce::FloatVectorOperations::copy(
+                            recordingBuffer.getWritePointer(channel, bufferWritePosition),
+                            storage.getReadPointer(channel, storageStart),
+                            samplesToWrite);
+
+                    writeRecordingSpool(storage, storageStart, samplesToWrite);
+                    recordingPeakFeed.add(storage, storageStart, samplesToWrite, channelsToWrite);
+
+                    bufferWritePosition += samplesToWrite;
+                    hasUnpublishedSamples = true;
+                    atomicRecordedSamples.store(bufferWritePosition, std::memory_order_release);
+                }
+
+                if (bufferWritePosition >= maxRecordingSamples)
+                {
+                    finishRecordingSpool();
+                    recordingPeakFeed.endTake();
+
+                    const juce::ScopedLock lock(bufferLock);
+                    DBG("Recording buffer full - stopped recording");
+                    recordedSamples = bufferWritePosition;
+                    recording = false;
+                    hasUnpublishedSamples = false;
+                }
+                break;
+            }
+        }
+
+        return true;
+    });
+
+    // Mid-take progress is published opportunistically; if a reader holds the
+    // lock the count catches up on the next drain.
+    if (hasUnpublishedSamples && bufferLock.tryEnter())
+    {
+        if (recording)
+            recordedSamples = bufferWritePosition;
+
+        bufferLock.exit();
     }
 }
 
-void Gary4juceAudioProcessor::copyInputBlockToRecordingBuffer(const juce::AudioBuffer<float>& sourceBuffer,
-                                                              int totalNumInputChannels,
-                                                              int numSamples)
+// The buffer only holds as much of a take as has been recorded, from a small
+// working window up to the full recording length. It doubles as a take grows,
+// so a three-minute take reallocates a handful of times. Writer side, with
+// bufferLock held.
+void Gary4juceAudioProcessor::growRecordingBuffer(int numSamples)
 {
-    if (!recording || recordedSamples >= maxRecordingSamples || numSamples <= 0)
+    const int currentSamples = recordingBuffer.getNumSamples();
+    if (numSamples <= currentSamples)
         return;
 
-    const int samplesToRecord = juce::jmin(numSamples, maxRecordingSamples - recordedSamples);
-    if (samplesToRecord <= 0)
-        return;
+    const int newSamples = juce::jmin(maxRecordingSamples, juce::jmax(numSamples, currentSamples * 2));
+    recordingBuffer.setSize(recordingBuffer.getNumChannels(), newSamples, true, true, false);
+}
 
-    for (int channel = 0; channel < juce::jmin(totalNumInputChannels, recordingBuffer.getNumChannels()); ++channel)
-        recordingBuffer.copyFrom(channel, bufferWritePosition, sourceBuffer, channel, 0, samplesToRecord);
+// Drops back to the working window once nothing in the buffer is wanted.
+// bufferLock held.
+void Gary4juceAudioProcessor::shrinkRecordingBuffer()
+{
+    if (recordingBuffer.getNumSamples() != recordingWindowSamples)
+        recordingBuffer.setSize(recordingBuffer.getNumChannels(), recordingWindowSamples, false, true, false);
+}
 
-    bufferWritePosition += samplesToRecord;
-    recordedSamples += samplesToRecord;
-    atomicRecordedSamples.store(recordedSamples, std::memory_order_release);
+void Gary4juceAudioProcessor::stopRecordingNonBlocking() noexcept
+{
+    // Called while processBlock is not running, so this thread may act as the
+    // ring's producer.
+    audioThreadTakeStartPending = false;
 
-    if (recordedSamples >= maxRecordingSamples)
+    if (audioThreadRecording)
     {
-        DBG("Recording buffer full - stopped recording");
-        recording = false;
-        atomicRecording.store(false, std::memory_order_release);
+        audioThreadRecording = false;
+        audioThreadTakeStopPending = !recordingRing.pushMarker(RecordingRing::ChunkKind::TakeStop);
     }
+
+    atomicRecording.store(false, std::memory_order_release);
+}
+
+void Gary4juceAudioProcessor::setRecordingSpoolDirectory(const juce::File& directory)
+{
+    const juce::ScopedLock writerLock(recordingWriterLock);
+    recordingSpoolDirectory = directory;
 }
 
-void Gary4juceAudioProcessor::appendDeferredRecordingBlock(const juce::AudioBuffer<float>& sourceBuffer,
-                                                           int totalNumInputChannels,
-                                                           int numSamples)
+void Gary4juceAudioProcessor::openRecordingSpool(int numChannels)
 {
-    if (numSamples <= 0 || maxDeferredRecordingSamples <= 0)
+    // A new take replaces whatever the last one left behind unsaved.
+    discardRecordingSpool();
+
+    if (!recordingSpoolDirectory.isDirectory() || numChannels <= 0 || currentSampleRate <= 0.0)
         return;
 
-    const int availableSamples = maxDeferredRecordingSamples - deferredRecordingSamples;
-    const int samplesToDefer = juce::jmin(numSamples, availableSamples);
+    recordingSpoolFile = recordingSpoolDirectory.getNonexistentChildFile("myBuffer.take", ".wav", false);
+    std::unique_ptr<juce::FileOutputStream> fileStream(recordingSpoolFile.createOutputStream());
 
-    if (samplesToDefer <= 0)
+    if (fileStream == nullptr || !fileStream->openedOk())
     {
-        if (!deferredRecordingOverflowed)
-        {
-            DBG("Deferred recording buffer full - dropping input while waiting for recording lock");
-            deferredRecordingOverflowed = true;
-        }
+        DBG("Could not open recording spool: " + recordingSpoolFile.getFullPathName());
+        recordingSpoolFile.deleteFile();
+        recordingSpoolFile = juce::File();
         return;
     }
 
-    deferredRecordingBuffer.clear(deferredRecordingSamples, samplesToDefer);
-
-    for (int channel = 0; channel < juce::jmin(totalNumInputChannels, deferredRecordingBuffer.getNumChannels()); ++channel)
-        deferredRecordingBuffer.copyFrom(channel, deferredRecordingSamples, sourceBuffer, channel, 0, samplesToDefer);
-
-    deferredRecordingSamples += samplesToDefer;
+    // Same 16-bit format saveRecordingToFile produces, so the spool can be
+    // installed as myBuffer.wav without re-encoding.
+    juce::WavAudioFormat wavFormat;
+    recordingSpoolWriter.reset(wavFormat.createWriterFor(fileStream.release(),
+        currentSampleRate,
+        (unsigned int)numChannels,
+        16,
+        {},
+        0));
 
-    if (samplesToDefer < numSamples && !deferredRecordingOverflowed)
+    if (recordingSpoolWriter == nullptr)
     {
-        DBG("Deferred recording buffer overflowed - dropping " + juce::String(numSamples - samplesToDefer) + " samples");
-        deferredRecordingOverflowed = true;
+        DBG("Could not create recording spool writer");
+        recordingSpoolFile.deleteFile();
+        recordingSpoolFile = juce::File();
     }
 }
 
-void Gary4juceAudioProcessor::flushDeferredRecordingBlocks(int totalNumInputChannels)
+void Gary4juceAudioProcessor::writeRecordingSpool(const juce::AudioBuffer<float>& source,
+                                                  int startSample,
+                                                  int numSamples)
 {
-    if (deferredRecordingSamples <= 0)
+    if (recordingSpoolWriter == nullptr)
         return;
 
-    if (!recording || recordedSamples >= maxRecordingSamples)
+    if (recordingSpoolWriter->writeFromAudioSampleBuffer(source, startSample, numSamples))
     {
-        deferredRecordingSamples = 0;
-        deferredRecordingOverflowed = false;
+        recordingSpoolSamples += numSamples;
         return;
     }
 
-    const int samplesToFlush = juce::jmin(deferredRecordingSamples, maxRecordingSamples - recordedSamples);
-    if (samplesToFlush > 0)
-    {
-        const int channelsToFlush = juce::jmin(totalNumInputChannels,
-            juce::jmin(recordingBuffer.getNumChannels(), deferredRecordingBuffer.getNumChannels()));
-        for (int channel = 0; channel < channelsToFlush; ++channel)
-            recordingBuffer.copyFrom(channel, bufferWritePosition, deferredRecordingBuffer, channel, 0, samplesToFlush);
+    DBG("Recording spool write failed - falling back to in-memory save");
+    discardRecordingSpool();
+}
 
-        bufferWritePosition += samplesToFlush;
-        recordedSamples += samplesToFlush;
-        atomicRecordedSamples.store(recordedSamples, std::memory_order_release);
-    }
+void Gary4juceAudioProcessor::finishRecordingSpool()
+{
+    if (recordingSpoolWriter == nullptr)
+        return;
 
-    deferredRecordingSamples = 0;
-    deferredRecordingOverflowed = false;
+    // Destroying the writer rewrites the WAV header with the final length.
+    recordingSpoolWriter.reset();
+    recordingSpoolComplete = recordingSpoolFile.existsAsFile();
+    DBG("Recording spool finished: " + juce::String(recordingSpoolSamples) + " samples");
+}
 
-    if (recordedSamples >= maxRecordingSamples)
-    {
-        DBG("Recording buffer full - stopped recording");
-        recording = false;
-        atomicRecording.store(false, std::memory_order_release);
-    }
+void Gary4juceAudioProcessor::discardRecordingSpool()
+{
+    recordingSpoolWriter.reset();
+
+    if (recordingSpoolFile != juce::File() && recordingSpoolFile.existsAsFile())
+        recordingSpoolFile.deleteFile();
+
+    recordingSpoolFile = juce::File();
+    recordingSpoolSamples = 0;
+    recordingSpoolComplete = false;
 }
 
-void Gary4juceAudioProcessor::stopRecordingNonBlocking() noexcept
+bool Gary4juceAudioProcessor::installRecordingSpool(const juce::File& file)
 {
-    requestRecordingStopFromAudioThread();
-    atomicRecording.store(false, std::memory_order_release);
+    if (!recordingSpoolComplete || !recordingSpoolFile.existsAsFile())
+        return false;
 
-    if (bufferLock.tryEnter())
+    int publishedSamples = 0;
     {
-        recordingStartPending.store(false, std::memory_order_release);
-        recordingStopPending.store(false, std::memory_order_release);
-        recording = false;
-        atomicRecordedSamples.store(recordedSamples, std::memory_order_release);
-        bufferLock.exit();
+        const juce::ScopedLock lock(bufferLock);
+        publishedSamples = recordedSamples;
     }
+
+    if (publishedSamples <= 0 || publishedSamples != recordingSpoolSamples)
+        return false;
+
+    const auto parentResult = file.getParentDirectory().createDirectory();
+    if (!parentResult.wasOk() || !installRecordingFile(recordingSpoolFile, file))
+        return false;
+
+    recordingSpoolFile = juce::File();
+    recordingSpoolSamples = 0;
+    recordingSpoolComplete = false;
+
+    savedSamples = publishedSamples;
+    DBG("Installed streamed recording (" + juce::String(publishedSamples) + " samples) as " + file.getFullPathName());
+    return true;
+}
+
+juce::uint32 Gary4juceAudioProcessor::summariseRecording(PeakPyramid& peaks)
+{
+    // bufferLock keeps a new take, load or clear from touching the buffer,
+    // and nothing below atomicRecordedSamples is rewritten until one does.
+    const juce::ScopedLock lock(bufferLock);
+    const auto revision = recordingContentRevision.load();
+    int samples = atomicRecordedSamples.load(std::memory_order_acquire);
+
+    // Mid-take, stop at the last whole bucket; the feed supplies the rest
+    if (recording)
+        samples -= samples % PeakPyramid::baseBlockSamples;
+
+    peaks.reset();
+    peaks.refresh(recordingBuffer, 0, samples);
+    return revision;
 }
 
 void Gary4juceAudioProcessor::clearRecordingBuffer()
 {
+    const juce::ScopedLock writerLock(recordingWriterLock);
+    discardRecordingSpool();
     juce::ScopedLock lock(bufferLock);
 
-    recordingStartPending = false;
-    recordingStopPending = false;
+    shrinkRecordingBuffer();
     recordingBuffer.clear();
     bufferWritePosition = 0;
     recordedSamples = 0;
-    deferredRecordingSamples = 0;
-    deferredRecordingOverflowed = false;
     atomicRecordedSamples = 0;
     recording = false;
     atomicRecording = false;
     
     // CRITICAL: Clear saved samples too
     savedSamples = 0;
+    recordingContentRevision.fetch_add(1);
     
     DBG("Recording buffer cleared and saved samples reset");
 }
@@ -608,6 +1074,15 @@ bool Gary4juceAudioProcessor::saveRecordingToFile(const juce::File& file)
 {
     DBG("saveRecordingToFile called with: " + file.getFullPathName());
 
+    {
+        // A finished take has already been streamed to disk by the writer
+        // thread; saving it is just a rename. Takes still in progress (or
+        // without a spool) use the snapshot path below.
+        const juce::ScopedLock writerLock(recordingWriterLock);
+        if (installRecordingSpool(file))
+            return true;
+    }
+
     // Take a thread-safe snapshot of the recording buffer
     juce::AudioBuffer<float> tempBuffer;
     int snapshotSamples = 0;
@@ -696,35 +1171,12 @@ bool Gary4juceAudioProcessor::saveRecordingToFile(const juce::File& file)
         return false;
     }
 
-    juce::File previousFile;
-    if (file.existsAsFile())
+    if (!installRecordingFile(temporaryFile, file))
     {
-        previousFile = file.getParentDirectory().getNonexistentChildFile(
-            file.getFileNameWithoutExtension() + ".previous", file.getFileExtension(), true);
-        if (!file.moveFileTo(previousFile))
-        {
-            DBG("Could not preserve existing recording before replacement");
-            temporaryFile.deleteFile();
-            return false;
-        }
-    }
-
-    if (!temporaryFile.moveFileTo(file))
-    {
-        DBG("Could not install newly written recording");
-        if (previousFile.existsAsFile() && !previousFile.moveFileTo(file))
-        {
-            DBG("Could not restore previous recording: " + previousFile.getFullPathName());
-        }
         temporaryFile.deleteFile();
         return false;
     }
 
-    if (previousFile.existsAsFile() && !previousFile.deleteFile())
-    {
-        DBG("Could not remove previous recording backup: " + previousFile.getFullPathName());
-    }
-
     savedSamples = snapshotSamples;
     DBG("Successfully saved and stored " + juce::String(snapshotSamples) + " samples in processor");
 
@@ -735,22 +1187,21 @@ bool Gary4juceAudioProcessor::saveRecordingToFile(const juce::File& file)
 
 void Gary4juceAudioProcessor::loadAudioIntoRecordingBuffer(const juce::AudioBuffer<float>& sourceBuffer)
 {
+    const juce::ScopedLock writerLock(recordingWriterLock);
+    discardRecordingSpool();
     juce::ScopedLock lock(bufferLock);
 
-    recordingStartPending = false;
-    recordingStopPending = false;
-
-    // Clear existing recording state
+    // Clear existing recording state. A take still running on the audio thread
+    // is ignored by the writer until the next transport start.
     recordingBuffer.clear();
     bufferWritePosition = 0;
-    deferredRecordingSamples = 0;
-    deferredRecordingOverflowed = false;
     recording = false;
     atomicRecording = false;
 
-    // Calculate how many samples to copy (up to the full recording buffer capacity)
-    int samplesToCopy = juce::jmin(sourceBuffer.getNumSamples(),
-                                    recordingBuffer.getNumSamples());
+    // Calculate how many samples to copy (up to the full recording length)
+    int samplesToCopy = juce::jmin(sourceBuffer.getNumSamples(), maxRecordingSamples);
+    shrinkRecordingBuffer();
+    growRecordingBuffer(samplesToCopy);
 
     // Copy audio data channel by channel
     for (int ch = 0; ch < juce::jmin(sourceBuffer.getNumChannels(),
@@ -763,6 +1214,7 @@ void Gary4juceAudioProcessor::loadAudioIntoRecordingBuffer(const juce::AudioBuff
     recordedSamples = samplesToCopy;
     atomicRecordedSamples = samplesToCopy;
     savedSamples = samplesToCopy;  // Mark as "saved"
+    recordingContentRevision.fetch_add(1);
 
     DBG("Loaded " + juce::String(samplesToCopy) + " samples into recording buffer from dropped file");
 }
@@ -851,71 +1303,88 @@ void Gary4juceAudioProcessor::changeProgramName(int index, const juce::String& n
 //==============================================================================
 void Gary4juceAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    // The writer must be idle while the ring and buffer are rebuilt. Anything
+    // queued before the host stopped processing still belongs to the last take.
+    const juce::ScopedLock writerLock(recordingWriterLock);
+    drainRecordingRing();
+
     currentSampleRate = sampleRate;
+    outputLoopRenderer.prepare(sampleRate);
+    audioThreadLooping = false;
 
-    // Calculate buffer size for recorded audio plus a short spill buffer used
-    // when the main recording buffer is momentarily locked by the UI thread.
+    // Calculate buffer size for recorded audio
     int newMaxRecordingSamples = (int)(recordingLengthSeconds * sampleRate);
-    int newMaxDeferredRecordingSamples = juce::jmax(samplesPerBlock,
-        (int)(deferredRecordingLengthSeconds * sampleRate));
+
+    // Set up recording buffer - use same channel configuration as the plugin
+    int numChannels = juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels());
 
     // Only reset recording state if sample rate changed or buffer needs resize
     bool needsBufferResize = (maxRecordingSamples != newMaxRecordingSamples) ||
-        (maxDeferredRecordingSamples != newMaxDeferredRecordingSamples) ||
-        (recordingBuffer.getNumChannels() != juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels()));
+        (recordingBuffer.getNumChannels() != numChannels);
 
     maxRecordingSamples = newMaxRecordingSamples;
-    maxDeferredRecordingSamples = newMaxDeferredRecordingSamples;
+    recordingWindowSamples = juce::jmin(maxRecordingSamples, (int)(recordingWindowSeconds * sampleRate));
 
-    // Set up recording buffer - use same channel configuration as the plugin
-    int numChannels = juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels());
+    // The ring only has to cover the time the writer can be held off by a
+    // snapshot reader, so a few seconds of host-sized chunks is plenty.
+    const int ringChunkSamples = juce::jmax(32, samplesPerBlock);
+    recordingRing.prepare(numChannels, ringChunkSamples,
+        (int)std::ceil(recordingRingLengthSeconds * sampleRate / ringChunkSamples) + 1);
+    recordingGapBuffer.setSize(numChannels, ringChunkSamples);
+    recordingGapBuffer.clear();
+
+    audioThreadRecording = false;
+    audioThreadTakeStartPending = false;
+    audioThreadTakeStopPending = false;
+    audioThreadTakeSamples = 0;
 
     if (needsBufferResize)
     {
+        discardRecordingSpool();
+
         // THREAD SAFETY: Use lock when modifying buffer and state
         juce::ScopedLock lock(bufferLock);
 
-        recordingStartPending = false;
-        recordingStopPending = false;
-
-        // Only clear the buffer if we actually need to resize it
-        recordingBuffer.setSize(numChannels, maxRecordingSamples);
+        // Only clear the buffer if we actually need to resize it. It starts
+        // at the working window and grows with the take.
+        recordingBuffer.setSize(numChannels, recordingWindowSamples);
         recordingBuffer.clear();
-        deferredRecordingBuffer.setSize(numChannels, maxDeferredRecordingSamples);
-        deferredRecordingBuffer.clear();
 
         // Reset recording state only when buffer changes - UPDATE ATOMICS TOO
         bufferWritePosition = 0;
         recordedSamples = 0;
-        deferredRecordingSamples = 0;
-        deferredRecordingOverflowed = false;
         atomicRecordedSamples = 0;  // ADD THIS
         recording = false;
         atomicRecording = false;    // ADD THIS
+        recordingContentRevision.fetch_add(1);
 
-        DBG("Recording buffer resized: " + juce::String(numChannels) + " channels, " +
+        DBG("Recording buffer resized: " + juce::String(numChannels) + " channels, up to " +
             juce::String(maxRecordingSamples) + " samples (" +
             juce::String(recordingLengthSeconds) + " seconds at " +
             juce::String(sampleRate) + " Hz)");
     }
     else
     {
+        finishRecordingSpool();
+
         // THREAD SAFETY: Use lock when modifying recording state
         juce::ScopedLock lock(bufferLock);
 
-        recordingStartPending = false;
-        recordingStopPending = false;
-
         // Just ensure we're not recording when transport stops, but preserve data
+        if (recording)
+            recordedSamples = bufferWritePosition;
+
         recording = false;
-        deferredRecordingSamples = 0;
-        deferredRecordingOverflowed = false;
         atomicRecording = false;    // ADD THIS
 
         DBG("PrepareToPlay called - preserving " + juce::String(recordedSamples) + " recorded samples");
     }
 
     wasPlaying = false;
+
+    // Audio restored from the state before the host prepared us has been
+    // waiting for a recording buffer to go into.
+    installPendingEmbeddedRecording();
 }
 
 void Gary4juceAudioProcessor::releaseResources()
@@ -961,6 +1430,8 @@ void Gary4juceAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     // Get transport information
     juce::AudioPlayHead* playHead = getPlayHead();
     bool isCurrentlyPlaying = false;
+    double hostPpq = 0.0;
+    bool hostPpqValid = false;
 
     if (playHead != nullptr)
     {
@@ -969,6 +1440,12 @@ void Gary4juceAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
         {
             isCurrentlyPlaying = positionInfo->getIsPlaying();
 
+            if (auto ppq = positionInfo->getPpqPosition())
+            {
+                hostPpq = *ppq;
+                hostPpqValid = true;
+            }
+
             // NEW: Get BPM from DAW
             if (auto bpm = positionInfo->getBpm())
             {
@@ -977,137 +1454,188 @@ void Gary4juceAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
         }
     }
 
-    // Detect when transport starts (transition from not playing to playing)
-    if (isCurrentlyPlaying && !wasPlaying)
+    // Recording never touches bufferLock here: input is queued into the ring
+    // and the writer thread appends it to the recording buffer.
+    pushRecordingInputFromAudioThread(buffer, totalNumInputChannels, isCurrentlyPlaying);
+    wasPlaying = isCurrentlyPlaying;
+
+    // Clear unused output channels
+    for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
+        buffer.clear(i, 0, buffer.getNumSamples());
+
+    renderOutputPlayback(buffer, totalNumOutputChannels, isCurrentlyPlaying, hostPpq, hostPpqValid);
+
+    // Pass input audio through unchanged
+    for (int channel = 0; channel < totalNumInputChannels; ++channel)
     {
-        deferredRecordingSamples = 0;
-        deferredRecordingOverflowed = false;
-        requestRecordingStartFromAudioThread();
+        // Input pass-through (existing behavior)
     }
-    else if (!isCurrentlyPlaying && wasPlaying)
+}
+
+void Gary4juceAudioProcessor::renderOutputPlayback(juce::AudioBuffer<float>& buffer, int totalNumOutputChannels,
+                                                   bool hostIsPlaying, double hostPpq, bool hostPpqValid) noexcept
+{
+    const int numSamples = buffer.getNumSamples();
+    const double blockStartMs = juce::Time::getMillisecondCounterHiRes();
+    const juce::int64 blockStartSampleTime = audioThreadSampleTime;
+    audioThreadSampleTime += numSamples;
+
+    const RealtimeHandoff<OutputPlaybackData>::ScopedRead playbackData(outputPlayback);
+    const bool playing = isPlayingOutputAudio.load(std::memory_order_acquire) && playbackData;
+    const int totalPlaybackSamples = playbackData ? playbackData->getNumSamples() : 0;
+
+    // A seek lands at the sample its request was stamped with, so the jump
+    // happens part-way through the block rather than on a block boundary.
+    int seekOffset = -1;
+    juce::int64 seekTarget = 0;
+    const auto seek = outputSeekRequest.load();
+    if (seek.serial != audioThreadSeekSerial)
     {
-        requestRecordingStopFromAudioThread();
+        const auto offset = playing ? seek.hostSampleTime - blockStartSampleTime : 0;
+        if (offset < numSamples)
+        {
+            seekOffset = (int)juce::jmax((juce::int64)0, offset);
+            seekTarget = juce::jlimit((juce::int64)0, (juce::int64)juce::jmax(0, totalPlaybackSamples - 1), seek.targetSample);
+            audioThreadSeekSerial = seek.serial;
+        }
     }
 
-    wasPlaying = isCurrentlyPlaying;
+    juce::int64 position = outputPlaybackReadPosition.load(std::memory_order_acquire);
+    bool finished = false;
 
-    const bool hasPendingRecordingState =
-        recordingStartPending.load(std::memory_order_acquire) ||
-        recordingStopPending.load(std::memory_order_acquire);
+    const bool looping = playing && playbackData->stream == nullptr && playbackData->loopLengthBeats > 0.0
+        && outputLoopEnabled.load(std::memory_order_acquire);
 
-    const bool shouldHandleRecording =
-        hasPendingRecordingState ||
-        atomicRecording.load(std::memory_order_acquire) ||
-        deferredRecordingSamples > 0;
+    if (looping && !audioThreadLooping)
+    {
+        outputLoopRenderer.reset();
+        outputLoopRenderer.setPhase((double)position);
+    }
+    audioThreadLooping = looping;
 
-    if (shouldHandleRecording)
+    if (!playing)
     {
-        if (bufferLock.tryEnter())
+        if (seekOffset >= 0)
         {
-            bool stoppedThisBlock = false;
-            applyPendingRecordingStateFromAudioThread(totalNumInputChannels, stoppedThisBlock);
+            position = seekTarget;
 
-            if (recording && !stoppedThisBlock && recordedSamples < maxRecordingSamples)
-            {
-                flushDeferredRecordingBlocks(totalNumInputChannels);
+            // Nothing is playing it, so there is no old material to hold
+            // on to while the new position fills
+            if (playbackData && playbackData->stream != nullptr)
+                playbackData->stream->jumpToCue();
+        }
+    }
+    else if (looping)
+    {
+        // Locked to the host while its transport runs, so seeks only move the
+        // loop while the host is stopped.
+        const bool locked = hostIsPlaying && hostPpqValid;
+        const double bpm = currentBPM.load(std::memory_order_relaxed);
+        const int splitAt = seekOffset >= 0 && !locked ? seekOffset : numSamples;
 
-                if (isCurrentlyPlaying && recording)
-                    copyInputBlockToRecordingBuffer(buffer, totalNumInputChannels, buffer.getNumSamples());
-            }
-            else if (!recording)
-            {
-                deferredRecordingSamples = 0;
-                deferredRecordingOverflowed = false;
-            }
+        outputLoopRenderer.render(playbackData->getBuffer(), playbackData->loopLengthBeats, locked, hostPpq, bpm,
+                                  buffer, 0, splitAt, totalNumOutputChannels);
 
-            bufferLock.exit();
-        }
-        else if (isCurrentlyPlaying
-                 && !recordingStopPending.load(std::memory_order_acquire)
-                 && (recordingStartPending.load(std::memory_order_acquire)
-                     || atomicRecording.load(std::memory_order_acquire)))
+        if (splitAt < numSamples)
         {
-            appendDeferredRecordingBlock(buffer, totalNumInputChannels, buffer.getNumSamples());
+            outputLoopRenderer.setPhase((double)seekTarget);
+            outputLoopRenderer.render(playbackData->getBuffer(), playbackData->loopLengthBeats, false, 0.0, bpm,
+                                      buffer, splitAt, numSamples - splitAt, totalNumOutputChannels);
         }
+
+        position = (juce::int64)outputLoopRenderer.getPhase();
     }
+    else if (playbackData->stream != nullptr)
+    {
+        // Disk-backed output: copy whatever the read-ahead thread has queued.
+        // An underrun just leaves the rest of the block silent. The seek was
+        // cued when it was posted, so the new position is normally queued by
+        // the stamped sample; if not, the old material plays on until it is.
+        auto& stream = *playbackData->stream;
 
-    // Clear unused output channels
-    for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
-        buffer.clear(i, 0, buffer.getNumSamples());
+        if (seekOffset >= 0)
+        {
+            stream.addNextBlock(buffer, 0, seekOffset, totalNumOutputChannels);
+            stream.switchToCue();
+            stream.addNextBlock(buffer, seekOffset, numSamples - seekOffset, totalNumOutputChannels);
+        }
+        else
+        {
+            stream.addNextBlock(buffer, 0, numSamples, totalNumOutputChannels);
+        }
 
-    const auto playbackData = std::atomic_load(&outputPlaybackData);
-    if (isPlayingOutputAudio.load(std::memory_order_acquire) && playbackData != nullptr)
+        finished = stream.isFinished();
+        position = stream.getPlaybackPosition();
+    }
+    else
     {
-        const auto& playbackBuffer = playbackData->buffer;
-        const int totalPlaybackSamples = playbackBuffer.getNumSamples();
-        const int readPosition = outputPlaybackReadPosition.load(std::memory_order_acquire);
+        const auto& playbackBuffer = playbackData->getBuffer();
+        const int splitAt = seekOffset >= 0 ? seekOffset : numSamples;
 
-        if (totalPlaybackSamples > 0 && readPosition >= 0 && readPosition < totalPlaybackSamples)
-        {
-            const int numSamplesToMix = juce::jmin(buffer.getNumSamples(), totalPlaybackSamples - readPosition);
+        position = mixOutputPlaybackBuffer(playbackBuffer, position, buffer, 0, splitAt, totalNumOutputChannels);
 
-            if (numSamplesToMix > 0)
-            {
-                // FIXED: Handle mono → stereo conversion
-                if (playbackBuffer.getNumChannels() == 1)
-                {
-                    // Mono source - duplicate to all output channels
-                    for (int channel = 0; channel < totalNumOutputChannels; ++channel)
-                    {
-                        buffer.addFrom(
-                            channel, 0,
-                            playbackBuffer,
-                            0,  // Always read from channel 0 (mono)
-                            readPosition,
-                            numSamplesToMix
-                        );
-                    }
-                }
-                else
-                {
-                    // Stereo/multi-channel source - normal channel mapping
-                    for (int channel = 0; channel < juce::jmin(totalNumOutputChannels, playbackBuffer.getNumChannels()); ++channel)
-                    {
-                        buffer.addFrom(
-                            channel, 0,
-                            playbackBuffer,
-                            channel, readPosition,
-                            numSamplesToMix
-                        );
-                    }
-                }
+        if (seekOffset >= 0)
+            position = mixOutputPlaybackBuffer(playbackBuffer, seekTarget, buffer, splitAt,
+                                               numSamples - splitAt, totalNumOutputChannels);
 
-                const int newReadPosition = readPosition + numSamplesToMix;
+        finished = totalPlaybackSamples <= 0 || position >= totalPlaybackSamples;
+    }
 
-                if (newReadPosition >= totalPlaybackSamples)
-                {
-                    isPlayingOutputAudio.store(false, std::memory_order_release);
-                    isPausedOutputAudio.store(false, std::memory_order_release);
-                    outputPlaybackReadPosition.store(0, std::memory_order_release);
-                    outputPlaybackPosition.store(0.0, std::memory_order_release);
-                }
-                else
-                {
-                    outputPlaybackReadPosition.store(newReadPosition, std::memory_order_release);
-                    outputPlaybackPosition.store((double)newReadPosition / playbackData->sampleRate, std::memory_order_release);
-                }
-            }
-        }
-        else if (readPosition >= totalPlaybackSamples)
-        {
-            isPlayingOutputAudio.store(false, std::memory_order_release);
-            isPausedOutputAudio.store(false, std::memory_order_release);
-            outputPlaybackReadPosition.store(0, std::memory_order_release);
-            outputPlaybackPosition.store(0.0, std::memory_order_release);
-        }
+    if (playing && finished)
+    {
+        isPlayingOutputAudio.store(false, std::memory_order_release);
+        isPausedOutputAudio.store(false, std::memory_order_release);
+        position = 0;
     }
 
-    // Pass input audio through unchanged
-    for (int channel = 0; channel < totalNumInputChannels; ++channel)
+    const double sampleRate = playbackData ? playbackData->sampleRate : currentSampleRate;
+
+    if (playing || seekOffset >= 0)
     {
-        // Input pass-through (existing behavior)
+        outputPlaybackReadPosition.store((int)position, std::memory_order_release);
+        outputPlaybackPosition.store(sampleRate > 0.0 ? (double)position / sampleRate : 0.0, std::memory_order_release);
+    }
+
+    // The snapshot describes the end of this block, stamped with the time
+    // that sample is due if the block started playing now.
+    OutputTransportSnapshot snapshot;
+    snapshot.readPosition = position;
+    snapshot.hostSampleTime = audioThreadSampleTime;
+    snapshot.totalSamples = totalPlaybackSamples;
+    snapshot.sampleRate = sampleRate;
+    snapshot.timestampMs = blockStartMs + (sampleRate > 0.0 ? 1000.0 * numSamples / sampleRate : 0.0);
+    snapshot.blockSize = numSamples;
+    snapshot.seekSerial = audioThreadSeekSerial;
+    snapshot.playing = playing && !finished;
+    snapshot.looping = looping;
+    outputTransport.store(snapshot);
+}
+
+juce::int64 Gary4juceAudioProcessor::mixOutputPlaybackBuffer(const juce::AudioBuffer<float>& playbackBuffer,
+                                                             juce::int64 readPosition,
+                                                             juce::AudioBuffer<float>& dest,
+                                                             int destStartSample,
+                                                             int numSamples,
+                                                             int totalNumOutputChannels) noexcept
+{
+    const int totalPlaybackSamples = playbackBuffer.getNumSamples();
+    if (numSamples <= 0 || readPosition < 0 || readPosition >= totalPlaybackSamples)
+        return readPosition;
+
+    const int numSamplesToMix = (int)juce::jmin((juce::int64)numSamples, totalPlaybackSamples - readPosition);
+    const int sourceChannels = playbackBuffer.getNumChannels();
+
+    for (int channel = 0; channel < totalNumOutputChannels; ++channel)
+    {
+        // Mono sources feed every output channel
+        const int sourceChannel = sourceChannels == 1 ? 0 : channel;
+        if (sourceChannel < sourceChannels)
+            dest.addFrom(channel, destStartSample, playbackBuffer, sourceChannel, (int)readPosition, numSamplesToMix);
     }
+
+    return readPosition + numSamplesToMix;
 }
+
 //==============================================================================
 bool Gary4juceAudioProcessor::hasEditor() const
 {
@@ -1122,19 +1650,50 @@ juce::AudioProcessorEditor* Gary4juceAudioProcessor::createEditor()
 //==============================================================================
 void Gary4juceAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    juce::XmlElement xmlState("GARY_STATE");
-    xmlState.setAttribute("stateVersion", 2);
-    xmlState.setAttribute("savedSamples", savedSamples.load());
-    xmlState.setAttribute("transformRecording", transformRecording.load());
-    xmlState.setAttribute("currentSessionId", currentSessionId);
-    xmlState.setAttribute("sessionTimestamp", juce::String(sessionTimestamp));  // ADD THIS
-    xmlState.setAttribute("isUsingLocalhost", isUsingLocalhost);
-    xmlState.setAttribute("undoTransformAvailable", undoTransformAvailable.load());
-    xmlState.setAttribute("retryAvailable", retryAvailable.load());
-    xmlState.setAttribute("careyLyrics", careyLyrics);
-    xmlState.setAttribute("careyLanguage", careyLanguage);
-    xmlState.setAttribute("foundationState", foundationState);
-    xmlState.setAttribute("editorState", getEditorState());
+    // Small scalar state goes in one ValueTree section; the large JSON
+    // documents are separate raw UTF-8 sections so restoring never has to
+    // unescape or parse them.
+    juce::ValueTree core("GARY_STATE");
+    core.setProperty("savedSamples", savedSamples.load(), nullptr);
+    core.setProperty("transformRecording", transformRecording.load(), nullptr);
+    core.setProperty("currentSessionId", currentSessionId, nullptr);
+    core.setProperty("sessionTimestamp", sessionTimestamp, nullptr);
+    core.setProperty("isUsingLocalhost", isUsingLocalhost, nullptr);
+    core.setProperty("undoTransformAvailable", undoTransformAvailable.load(), nullptr);
+    core.setProperty("retryAvailable", retryAvailable.load(), nullptr);
+    core.setProperty("careyLyrics", careyLyrics, nullptr);
+    core.setProperty("careyLanguage", careyLanguage, nullptr);
+    core.setProperty("embedAudio", embedAudioInState.load(), nullptr);
+    core.setProperty("outputBpm", outputGenerationBpm.load(), nullptr);
+
+    juce::MemoryBlock coreData;
+    {
+        juce::MemoryOutputStream coreStream(coreData, false);
+        core.writeToStream(coreStream);
+    }
+
+    juce::MemoryBlock editorData, foundationData;
+    {
+        const juce::ScopedLock lock(editorStateLock);
+        editorData = editorState.getUtf8();
+        foundationData = foundationState.getUtf8();
+    }
+
+    destData.reset();
+    juce::MemoryOutputStream out(destData, false);
+    out.writeInt(stateMagic);
+    out.writeInt(currentStateVersion);
+    writeStateSection(out, coreSectionTag, coreData);
+    writeStateSection(out, editorSectionTag, editorData);
+    writeStateSection(out, foundationSectionTag, foundationData);
+
+    if (embedAudioInState.load())
+    {
+        writeStateSection(out, recordingAudioSectionTag, getEmbeddedRecordingFlac());
+        writeStateSection(out, outputAudioSectionTag, getEmbeddedOutputFlac());
+    }
+
+    out.flush();
 
     // DEBUG: Log what we're saving with age calculation
     DBG("=== SAVING STATE ===");
@@ -1149,91 +1708,484 @@ void Gary4juceAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
     DBG("undoTransformAvailable: " + juce::String(undoTransformAvailable.load() ? "true" : "false"));
     DBG("retryAvailable: " + juce::String(retryAvailable.load() ? "true" : "false"));
     DBG("careyLyrics: '" + careyLyrics.substring(0, 40) + "'");
-
-    copyXmlToBinary(xmlState, destData);
+    DBG("state size: " + juce::String((int)destData.getSize()) + " bytes");
 }
 
 void Gary4juceAudioProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
-    std::unique_ptr<juce::XmlElement> xml(getXmlFromBinary(data, sizeInBytes));
-    if (xml != nullptr && xml->hasTagName("GARY_STATE"))
-    {
-        const bool wasUsingLocalhost = isUsingLocalhost;
-
-        savedSamples = xml->getIntAttribute("savedSamples");
-        transformRecording = xml->getBoolAttribute("transformRecording");
-        currentSessionId = xml->getStringAttribute("currentSessionId");
-        sessionTimestamp = xml->getStringAttribute("sessionTimestamp").getLargeIntValue();  // ADD THIS
-        isUsingLocalhost = xml->getBoolAttribute("isUsingLocalhost");
-        undoTransformAvailable = xml->getBoolAttribute("undoTransformAvailable");
-        retryAvailable = xml->getBoolAttribute("retryAvailable");
-        // Shared lyrics - try new key first, fall back to old legoLyrics key for backward compat
-        careyLyrics = xml->getStringAttribute("careyLyrics");
-        if (careyLyrics.isEmpty())
-            careyLyrics = xml->getStringAttribute("careyLegoLyrics");
-        careyLanguage = xml->getStringAttribute("careyLanguage", "en");
-        foundationState = xml->getStringAttribute("foundationState");
-        setEditorState(xml->getStringAttribute("editorState"));
-        backendBaseUrl = getServiceUrl(ServiceType::Gary, "");
+    const bool wasUsingLocalhost = isUsingLocalhost;
 
-        // DEBUG: Log what we're loading
-        DBG("=== LOADING STATE ===");
-        DBG("savedSamples: " + juce::String(savedSamples.load()));
-        DBG("currentSessionId: '" + currentSessionId + "'");
-        DBG("sessionTimestamp: " + juce::String(sessionTimestamp));
-        DBG("undoTransformAvailable: " + juce::String(undoTransformAvailable.load() ? "true" : "false"));
-        DBG("retryAvailable: " + juce::String(retryAvailable.load() ? "true" : "false"));
-        DBG("careyLyrics: '" + careyLyrics.substring(0, 40) + "'");
-
-        // CRITICAL: Check if loaded session is stale and clean up if needed
-        if (!currentSessionId.isEmpty() && sessionTimestamp > 0)
-        {
-            auto currentTime = juce::Time::getCurrentTime().toMilliseconds();
-            auto sessionAge = currentTime - sessionTimestamp;
+    // Projects saved before stateVersion 3 carry the XML chunk; it is read
+    // once here and written back in the binary format on the next save.
+    if (!restoreBinaryState(data, sizeInBytes) && !restoreLegacyXmlState(data, sizeInBytes))
+        return;
 
-            DBG("Session age on load: " + juce::String(sessionAge / 1000) + " seconds");
+    finishStateRestore(wasUsingLocalhost);
+}
 
-            if (sessionAge >= SESSION_TIMEOUT_MS)
-            {
-                DBG("=== CLEANING UP STALE SESSION ===");
-                DBG("Session is " + juce::String(sessionAge / 60000) + " minutes old, clearing...");
+bool Gary4juceAudioProcessor::restoreBinaryState(const void* data, int sizeInBytes)
+{
+    if (data == nullptr || sizeInBytes < 8)
+        return false;
 
-                // Clear stale session and all associated state
-                currentSessionId = "";
-                sessionTimestamp = 0;
-                undoTransformAvailable.store(false);
-                retryAvailable.store(false);
+    juce::MemoryInputStream in(data, (size_t)sizeInBytes, false);
+    if (in.readInt() != stateMagic)
+        return false;
 
-                DBG("Stale session cleaned up - all operation flags cleared");
-            }
-            else
-            {
-                DBG("Session is valid - " + juce::String((SESSION_TIMEOUT_MS - sessionAge) / 60000) +
-                    " minutes remaining until timeout");
-            }
+    const int version = in.readInt();
+    if (version > currentStateVersion)
+        DBG("State was saved by a newer version (" + juce::String(version) + "); reading known sections only");
+
+    juce::ValueTree core;
+    const char* bytes = static_cast<const char*>(data);
+    const char* editorData = nullptr;
+    const char* foundationData = nullptr;
+    int editorLength = 0, foundationLength = 0;
+    juce::MemoryBlock recordingFlac, outputFlac;
+
+    // Sections are tag + length framed; unknown tags are skipped so newer
+    // projects still open in older builds.
+    while (in.getNumBytesRemaining() >= 8)
+    {
+        const int tag = in.readInt();
+        const int length = in.readInt();
+        const auto offset = in.getPosition();
+
+        if (length < 0 || (juce::int64)length > in.getNumBytesRemaining())
+        {
+            DBG("Truncated state section - ignoring the rest of the chunk");
+            break;
+        }
+
+        if (tag == coreSectionTag)
+        {
+            core = juce::ValueTree::readFromData(bytes + offset, (size_t)length);
+        }
+        else if (tag == editorSectionTag)
+        {
+            editorData = bytes + offset;
+            editorLength = length;
         }
-        else if (!currentSessionId.isEmpty() && sessionTimestamp == 0)
+        else if (tag == foundationSectionTag)
         {
-            // Handle legacy state (no timestamp) - assume it's stale
-            DBG("=== LEGACY SESSION WITHOUT TIMESTAMP - ASSUMING STALE ===");
+            foundationData = bytes + offset;
+            foundationLength = length;
+        }
+        else if (tag == recordingAudioSectionTag && (size_t)length <= maxEmbeddedAudioBytes)
+        {
+            recordingFlac.replaceAll(bytes + offset, (size_t)length);
+        }
+        else if (tag == outputAudioSectionTag && (size_t)length <= maxEmbeddedAudioBytes)
+        {
+            outputFlac.replaceAll(bytes + offset, (size_t)length);
+        }
+
+        in.setPosition(offset + length);
+    }
+
+    if (!core.hasType("GARY_STATE"))
+    {
+        DBG("State chunk has no core section");
+        return false;
+    }
+
+    {
+        const juce::ScopedLock lock(editorStateLock);
+        editorState.setRaw(editorData, (size_t)editorLength);
+        foundationState.setRaw(foundationData, (size_t)foundationLength);
+    }
+
+    savedSamples = (int)core.getProperty("savedSamples", 0);
+    transformRecording = (bool)core.getProperty("transformRecording", false);
+    currentSessionId = core.getProperty("currentSessionId").toString();
+    sessionTimestamp = (juce::int64)core.getProperty("sessionTimestamp", 0);
+    isUsingLocalhost = (bool)core.getProperty("isUsingLocalhost", false);
+    undoTransformAvailable = (bool)core.getProperty("undoTransformAvailable", false);
+    retryAvailable = (bool)core.getProperty("retryAvailable", false);
+    careyLyrics = core.getProperty("careyLyrics").toString();
+    careyLanguage = core.getProperty("careyLanguage", "en").toString();
+    embedAudioInState = (bool)core.getProperty("embedAudio", false);
+    outputGenerationBpm = (double)core.getProperty("outputBpm", 0.0);
+
+    startEmbeddedAudioDecode(std::move(recordingFlac), std::move(outputFlac));
+    return true;
+}
+
+bool Gary4juceAudioProcessor::restoreLegacyXmlState(const void* data, int sizeInBytes)
+{
+    std::unique_ptr<juce::XmlElement> xml(getXmlFromBinary(data, sizeInBytes));
+    if (xml == nullptr || !xml->hasTagName("GARY_STATE"))
+        return false;
+
+    DBG("Migrating stateVersion " + juce::String(xml->getIntAttribute("stateVersion", 1)) + " XML state");
+
+    savedSamples = xml->getIntAttribute("savedSamples");
+    transformRecording = xml->getBoolAttribute("transformRecording");
+    currentSessionId = xml->getStringAttribute("currentSessionId");
+    sessionTimestamp = xml->getStringAttribute("sessionTimestamp").getLargeIntValue();
+    isUsingLocalhost = xml->getBoolAttribute("isUsingLocalhost");
+    undoTransformAvailable = xml->getBoolAttribute("undoTransformAvailable");
+    retryAvailable = xml->getBoolAttribute("retryAvailable");
+    // Shared lyrics - try new key first, fall back to old legoLyrics key for backward compat
+    careyLyrics = xml->getStringAttribute("careyLyrics");
+    if (careyLyrics.isEmpty())
+        careyLyrics = xml->getStringAttribute("careyLegoLyrics");
+    careyLanguage = xml->getStringAttribute("careyLanguage", "en");
+    setFoundationState(xml->getStringAttribute("foundationState"));
+    setEditorState(xml->getStringAttribute("editorState"));
+    embedAudioInState = false;
+    startEmbeddedAudioDecode({}, {});
+    return true;
+}
+
+void Gary4juceAudioProcessor::finishStateRestore(bool wasUsingLocalhost)
+{
+    backendBaseUrl = getServiceUrl(ServiceType::Gary, "");
+
+    // DEBUG: Log what we're loading
+    DBG("=== LOADING STATE ===");
+    DBG("savedSamples: " + juce::String(savedSamples.load()));
+    DBG("currentSessionId: '" + currentSessionId + "'");
+    DBG("sessionTimestamp: " + juce::String(sessionTimestamp));
+    DBG("undoTransformAvailable: " + juce::String(undoTransformAvailable.load() ? "true" : "false"));
+    DBG("retryAvailable: " + juce::String(retryAvailable.load() ? "true" : "false"));
+    DBG("careyLyrics: '" + careyLyrics.substring(0, 40) + "'");
+
+    // CRITICAL: Check if loaded session is stale and clean up if needed
+    if (!currentSessionId.isEmpty() && sessionTimestamp > 0)
+    {
+        auto currentTime = juce::Time::getCurrentTime().toMilliseconds();
+        auto sessionAge = currentTime - sessionTimestamp;
+
+        DBG("Session age on load: " + juce::String(sessionAge / 1000) + " seconds");
+
+        if (sessionAge >= SESSION_TIMEOUT_MS)
+        {
+            DBG("=== CLEANING UP STALE SESSION ===");
+            DBG("Session is " + juce::String(sessionAge / 60000) + " minutes old, clearing...");
+
+            // Clear stale session and all associated state
             currentSessionId = "";
+            sessionTimestamp = 0;
             undoTransformAvailable.store(false);
             retryAvailable.store(false);
-            DBG("Legacy session cleared");
+
+            DBG("Stale session cleaned up - all operation flags cleared");
         }
+        else
+        {
+            DBG("Session is valid - " + juce::String((SESSION_TIMEOUT_MS - sessionAge) / 60000) +
+                " minutes remaining until timeout");
+        }
+    }
+    else if (!currentSessionId.isEmpty() && sessionTimestamp == 0)
+    {
+        // Handle legacy state (no timestamp) - assume it's stale
+        DBG("=== LEGACY SESSION WITHOUT TIMESTAMP - ASSUMING STALE ===");
+        currentSessionId = "";
+        undoTransformAvailable.store(false);
+        retryAvailable.store(false);
+        DBG("Legacy session cleared");
+    }
 
-        // Connection health is live process state, not preset state. Preserve a
-        // known-good result when the preset keeps the same backend so loading it
-        // does not flash "disconnected". A backend switch must be revalidated.
-        if (wasUsingLocalhost != isUsingLocalhost)
-            setBackendConnectionStatus(false);
+    // Connection health is live process state, not preset state. Preserve a
+    // known-good result when the preset keeps the same backend so loading it
+    // does not flash "disconnected". A backend switch must be revalidated.
+    if (wasUsingLocalhost != isUsingLocalhost)
+        setBackendConnectionStatus(false);
 
-        // Hosts may restore a preset while the editor is already open. Publish a
-        // distinct revision so the existing editor can apply the newly loaded
-        // state instead of overwriting it on its next persistence timer tick.
-        hostStateRevision.fetch_add(1, std::memory_order_release);
-        sendChangeMessage();
+    // Hosts may restore a preset while the editor is already open. Publish a
+    // distinct revision so the existing editor can apply the newly loaded
+    // state instead of overwriting it on its next persistence timer tick.
+    hostStateRevision.fetch_add(1, std::memory_order_release);
+    sendChangeMessage();
+}
+
+//==============================================================================
+// Audio embedded in the plugin state
+
+// Saving only ever copies what the recording writer last encoded, so a host
+// autosave never waits on an encode. During a take that is the audio from
+// before it; the take is picked up once it ends.
+juce::MemoryBlock Gary4juceAudioProcessor::getEmbeddedRecordingFlac()
+{
+    const juce::ScopedLock lock(embeddedAudioLock);
+    return cachedRecordingFlac;
+}
+
+juce::MemoryBlock Gary4juceAudioProcessor::getEmbeddedOutputFlac()
+{
+    const juce::ScopedLock lock(embeddedAudioLock);
+    return cachedOutputFlac;
+}
+
+// Re-encodes the recording if it changed since the cached copy was made.
+// A restored recording that hasn't been loaded yet keeps its restored copy.
+void Gary4juceAudioProcessor::updateEmbeddedRecordingFlac(const std::function<bool()>& shouldStop)
+{
+    const juce::ScopedLock encodeLock(embeddedEncodeLock);
+
+    int samples = 0;
+    double sampleRate = 0.0;
+    int channels = 0;
+    {
+        const juce::ScopedLock lock(bufferLock);
+        samples = recordedSamples;
+        sampleRate = currentSampleRate;
+        channels = recordingBuffer.getNumChannels();
     }
+
+    const auto revision = recordingContentRevision.load();
+    juce::uint32 epoch = 0;
+    {
+        const juce::ScopedLock lock(embeddedAudioLock);
+        if (pendingEmbeddedRecording != nullptr
+            || (revision == cachedRecordingRevision && samples == cachedRecordingSamples))
+            return;
+
+        epoch = embeddedCacheEpoch;
+    }
+
+    juce::MemoryBlock encoded;
+    if (samples > 0 && channels > 0 && samples <= (int)(maxEmbeddedAudioSeconds * sampleRate))
+    {
+        juce::AudioBuffer<float> snapshot;
+        {
+            const juce::ScopedLock lock(bufferLock);
+            samples = juce::jmin(samples, recordedSamples);
+            snapshot.setSize(juce::jmin(recordingBuffer.getNumChannels(), maxEmbeddedAudioChannels), samples);
+            for (int channel = 0; channel < snapshot.getNumChannels(); ++channel)
+                snapshot.copyFrom(channel, 0, recordingBuffer, channel, 0, samples);
+        }
+
+        encoded = encodeEmbeddedFlac(snapshot, samples, sampleRate, shouldStop);
+        if (shouldStop())
+            return;
+
+        if (encoded.getSize() > maxEmbeddedAudioBytes)
+        {
+            DBG("Recording is too large to embed in the plugin state (" + juce::String((juce::int64)encoded.getSize()) + " bytes)");
+            encoded.reset();
+        }
+    }
+
+    // A restore seeded the cache while this was encoding
+    const juce::ScopedLock lock(embeddedAudioLock);
+    if (epoch != embeddedCacheEpoch)
+        return;
+
+    cachedRecordingFlac = std::move(encoded);
+    cachedRecordingRevision = revision;
+    cachedRecordingSamples = samples;
+}
+
+// Likewise for the current output file, keyed by its path, size and time.
+void Gary4juceAudioProcessor::updateEmbeddedOutputFlac(const std::function<bool()>& shouldStop)
+{
+    const juce::ScopedLock encodeLock(embeddedEncodeLock);
+
+    juce::File source;
+    juce::uint32 epoch = 0;
+    {
+        const juce::ScopedLock lock(embeddedAudioLock);
+        source = embeddedOutputSource;
+        epoch = embeddedCacheEpoch;
+    }
+
+    if (!source.existsAsFile())
+    {
+        // Left alone while it still holds restored audio the editor hasn't
+        // replaced the output with yet
+        const juce::ScopedLock lock(embeddedAudioLock);
+        if (!(cachedOutputRestored && source == cachedOutputFile))
+        {
+            cachedOutputFlac.reset();
+            cachedOutputFile = juce::File();
+            cachedOutputRestored = false;
+        }
+        return;
+    }
+
+    const auto modificationTime = source.getLastModificationTime();
+    const auto size = source.getSize();
+    {
+        const juce::ScopedLock lock(embeddedAudioLock);
+        if (source == cachedOutputFile && modificationTime == cachedOutputModificationTime && size == cachedOutputSize)
+            return;
+    }
+
+    juce::MemoryBlock encoded;
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+    std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(source));
+
+    if (reader != nullptr && reader->sampleRate > 0.0 && reader->lengthInSamples > 0 && reader->numChannels > 0
+        && reader->lengthInSamples <= (juce::int64)(maxEmbeddedAudioSeconds * reader->sampleRate))
+    {
+        juce::AudioBuffer<float> audio(juce::jmin((int)reader->numChannels, maxEmbeddedAudioChannels),
+                                       (int)reader->lengthInSamples);
+
+        for (juce::int64 position = 0; position < reader->lengthInSamples; position += embeddedAudioChunkSamples)
+        {
+            if (shouldStop())
+                return;
+
+            const int count = (int)juce::jmin((juce::int64)embeddedAudioChunkSamples, reader->lengthInSamples - position);
+            reader->read(&audio, (int)position, count, position, true, true);
+        }
+
+        encoded = encodeEmbeddedFlac(audio, audio.getNumSamples(), reader->sampleRate, shouldStop);
+        if (shouldStop())
+            return;
+
+        if (encoded.getSize() > maxEmbeddedAudioBytes)
+        {
+            DBG("Output is too large to embed in the plugin state (" + juce::String((juce::int64)encoded.getSize()) + " bytes)");
+            encoded.reset();
+        }
+    }
+
+    const juce::ScopedLock lock(embeddedAudioLock);
+    if (epoch != embeddedCacheEpoch)
+        return;
+
+    cachedOutputFlac = std::move(encoded);
+    cachedOutputRestored = false;
+    cachedOutputFile = source;
+    cachedOutputModificationTime = modificationTime;
+    cachedOutputSize = size;
+}
+
+void Gary4juceAudioProcessor::refreshEmbeddedAudioCache(const std::function<bool()>& shouldStop)
+{
+    // Encoder thread, between takes; the only place the embedded audio is
+    // encoded. Both updates return straight away when their cache is
+    // current, and drop a stopped encode without touching the cache.
+    if (!embedAudioInState.load() || shouldStop())
+        return;
+
+    updateEmbeddedRecordingFlac(shouldStop);
+    updateEmbeddedOutputFlac(shouldStop);
+}
+
+void Gary4juceAudioProcessor::startEmbeddedAudioDecode(juce::MemoryBlock recordingFlac, juce::MemoryBlock outputFlac)
+{
+    embeddedAudioDecoder.reset();
+
+    int samples = 0;
+    {
+        const juce::ScopedLock lock(bufferLock);
+        samples = recordedSamples;
+    }
+
+    {
+        // Until the writer re-encodes what ends up loaded, a save hands back
+        // the audio exactly as it was restored.
+        const juce::ScopedLock lock(embeddedAudioLock);
+        pendingEmbeddedRecording.reset();
+        restoredEmbeddedOutput.reset();
+        ++embeddedCacheEpoch;
+
+        if (!recordingFlac.isEmpty())
+        {
+            cachedRecordingFlac = recordingFlac;
+            cachedRecordingRevision = recordingContentRevision.load();
+            cachedRecordingSamples = samples;
+        }
+
+        if (!outputFlac.isEmpty())
+        {
+            cachedOutputFlac = outputFlac;
+            cachedOutputFile = embeddedOutputSource;
+            cachedOutputModificationTime = embeddedOutputSource.getLastModificationTime();
+            cachedOutputSize = embeddedOutputSource.getSize();
+            cachedOutputRestored = true;
+        }
+    }
+    restoredRecordingPending = false;
+
+    if (recordingFlac.isEmpty() && outputFlac.isEmpty())
+        return;
+
+    DBG("Decoding embedded audio in the background (" + juce::String((juce::int64)recordingFlac.getSize()) +
+        " + " + juce::String((juce::int64)outputFlac.getSize()) + " bytes)");
+    embeddedAudioDecoder = std::make_unique<EmbeddedAudioDecoder>(*this, std::move(recordingFlac), std::move(outputFlac));
+}
+
+void Gary4juceAudioProcessor::embeddedAudioDecoded(std::unique_ptr<EmbeddedAudio> recording,
+                                                   std::unique_ptr<EmbeddedAudio> output)
+{
+    {
+        const juce::ScopedLock lock(embeddedAudioLock);
+        pendingEmbeddedRecording = std::move(recording);
+        restoredEmbeddedOutput = std::move(output);
+    }
+
+    installPendingEmbeddedRecording();
+    sendChangeMessage();
+}
+
+void Gary4juceAudioProcessor::installPendingEmbeddedRecording()
+{
+    for (;;)
+    {
+        std::unique_ptr<EmbeddedAudio> audio;
+        {
+            const juce::ScopedLock lock(embeddedAudioLock);
+            audio = std::move(pendingEmbeddedRecording);
+        }
+
+        if (audio == nullptr)
+            return;
+
+        double hostRate = 0.0;
+        bool prepared = false;
+        {
+            const juce::ScopedLock lock(bufferLock);
+            hostRate = currentSampleRate;
+            prepared = recordingBuffer.getNumSamples() > 0;
+        }
+
+        if (prepared)
+        {
+            if (std::abs(audio->sampleRate - hostRate) > 1.0e-6)
+                audio->buffer = StreamingResampler::resampleBuffer(audio->buffer, audio->sampleRate, hostRate,
+                                                                   StreamingResampler::Quality::Standard);
+
+            loadAudioIntoRecordingBuffer(audio->buffer);
+            restoredRecordingPending = true;
+            DBG("Restored embedded recording: " + juce::String(audio->buffer.getNumSamples()) + " samples");
+            return;
+        }
+
+        // Not prepared yet; prepareToPlay picks it up. Look again in case it
+        // ran while the audio was out of the slot.
+        {
+            const juce::ScopedLock lock(embeddedAudioLock);
+            if (pendingEmbeddedRecording == nullptr)
+                pendingEmbeddedRecording = std::move(audio);
+        }
+
+        const juce::ScopedLock lock(bufferLock);
+        if (recordingBuffer.getNumSamples() <= 0)
+            return;
+    }
+}
+
+bool Gary4juceAudioProcessor::takeRestoredOutputAudio(juce::AudioBuffer<float>& destination, double& sampleRate)
+{
+    std::unique_ptr<EmbeddedAudio> audio;
+    {
+        const juce::ScopedLock lock(embeddedAudioLock);
+        audio = std::move(restoredEmbeddedOutput);
+    }
+
+    if (audio == nullptr)
+        return false;
+
+    destination = std::move(audio->buffer);
+    sampleRate = audio->sampleRate;
+    return true;
 }
 
 //==============================================================================
@@ -1241,7 +2193,7 @@ void Gary4juceAudioProcessor::setStateInformation(const void* data, int sizeInBy
 
 bool Gary4juceAudioProcessor::loadRecordingAudioForPlayback()
 {
-    auto newPlaybackData = std::make_shared<OutputPlaybackData>();
+    auto newPlaybackData = std::make_unique<OutputPlaybackData>();
 
     {
         // Playback must use a stable snapshot: the audio thread may start a new
@@ -1263,134 +2215,246 @@ bool Gary4juceAudioProcessor::loadRecordingAudioForPlayback()
         newPlaybackData->durationSeconds = (double)snapshotSamples / currentSampleRate;
     }
 
-    std::shared_ptr<const OutputPlaybackData> immutablePlaybackData = newPlaybackData;
-    std::atomic_store(&outputPlaybackData, immutablePlaybackData);
-    outputAudioSampleRate.store(newPlaybackData->sampleRate);
-    outputAudioDuration.store(newPlaybackData->durationSeconds);
+    const double durationSeconds = newPlaybackData->durationSeconds;
 
+    // Stop first so the audio thread never applies the old read position to
+    // the new buffer.
     isPlayingOutputAudio.store(false);
     isPausedOutputAudio.store(false);
     outputPlaybackReadPosition.store(0);
     outputPlaybackPosition.store(0.0);
 
+    outputAudioSampleRate.store(newPlaybackData->sampleRate);
+    outputAudioDuration.store(durationSeconds);
+    publishOutputPlayback(std::move(newPlaybackData));
+
     DBG("Loaded recording buffer snapshot for playback: "
-        + juce::String(newPlaybackData->durationSeconds, 2) + "s");
+        + juce::String(durationSeconds, 2) + "s");
     return true;
 }
 
 void Gary4juceAudioProcessor::loadOutputAudioForPlayback(const juce::File& audioFile)
 {
-    juce::AudioFormatManager formatManager;
-    formatManager.registerBasicFormats();
+    outputPlaybackFile = audioFile;
+    {
+        const juce::ScopedLock lock(embeddedAudioLock);
+        embeddedOutputSource = audioFile;
+    }
 
-    std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(audioFile));
+    // Only the header is read here; the read-ahead thread decodes and
+    // resamples to the host rate block by block once the source is live.
+    auto stream = StreamingPlaybackSource::open(audioFile, currentSampleRate, playbackReadAheadThread);
 
-    if (reader != nullptr)
+    if (stream != nullptr)
     {
-        auto newPlaybackData = std::make_shared<OutputPlaybackData>();
-        const double hostSampleRate = currentSampleRate;
-        const double fileSampleRate = reader->sampleRate;
-        const int fileNumChannels = (int)reader->numChannels;
-        const int fileNumSamples = (int)reader->lengthInSamples;
+        auto newPlaybackData = std::make_unique<OutputPlaybackData>();
 
-        DBG("Loading audio file: " + juce::String(fileNumSamples) + " samples at " +
-            juce::String(fileSampleRate) + " Hz, " + juce::String(fileNumChannels) + " channels");
+        DBG("Streaming audio file: " + juce::String(stream->getTotalLength()) + " samples at " +
+            juce::String(stream->getSampleRate()) + " Hz (file " + juce::String(stream->getFileSampleRate()) +
+            " Hz), " + juce::String(stream->getNumChannels()) + " channels");
 
-        // Check if we need sample rate conversion
-        const bool needsResampling = (fileSampleRate != hostSampleRate);
+        newPlaybackData->sampleRate = stream->getSampleRate();
+        newPlaybackData->durationSeconds = (double)stream->getTotalLength() / stream->getSampleRate();
+        newPlaybackData->stream = std::move(stream);
 
-        if (needsResampling)
-        {
-            DBG("Sample rate mismatch: file=" + juce::String(fileSampleRate) +
-                " Hz, host=" + juce::String(hostSampleRate) + " Hz - resampling...");
+        // Reset playback state before the new source becomes visible
+        isPlayingOutputAudio.store(false);
+        isPausedOutputAudio.store(false);
+        outputPlaybackReadPosition.store(0);
+        outputPlaybackPosition.store(0.0);
 
-            // Calculate how many samples we'll need after resampling
-            const double sizeRatio = hostSampleRate / fileSampleRate;
-            const int resampledNumSamples = (int)(fileNumSamples * sizeRatio);
+        outputAudioSampleRate.store(newPlaybackData->sampleRate);
+        outputAudioDuration.store(newPlaybackData->durationSeconds);
+        publishOutputPlayback(std::move(newPlaybackData));
 
-            // Calculate speed ratio for interpolator (how fast to read input samples)
-            // For upsampling (44.1→48kHz): speedRatio < 1.0 (read slower)
-            // For downsampling (48→44.1kHz): speedRatio > 1.0 (read faster)
-            const double speedRatio = fileSampleRate / hostSampleRate;
+        // Looping needs the whole output in memory. It plays streamed until
+        // the decode lands, which then takes over at the same position.
+        if (outputLoopEnabled.load() && outputAudioDuration.load() <= maxLoopPlaybackSeconds)
+            queueLoopDecode(audioFile);
 
-            DBG("Size ratio: " + juce::String(sizeRatio) + ", Speed ratio: " + juce::String(speedRatio));
+        DBG("Loaded output audio for playback successfully");
+    }
+    else
+    {
+        DBG("Failed to load audio file for playback: " + audioFile.getFullPathName());
+    }
+}
 
-            // Load original audio into temporary buffer
-            juce::AudioBuffer<float> tempBuffer(fileNumChannels, fileNumSamples);
-            reader->read(&tempBuffer, 0, fileNumSamples, 0, true, true);
+void Gary4juceAudioProcessor::loadOutputAudioForPlayback(const ResultIngest::Handle& ingested)
+{
+    if (ingested == nullptr)
+        return;
 
-            // Create output buffer at host sample rate
-            newPlaybackData->buffer.setSize(fileNumChannels, resampledNumSamples);
+    auto newPlaybackData = makeIngestedPlaybackData(ingested);
+    if (newPlaybackData == nullptr)
+    {
+        loadOutputAudioForPlayback(ingested->file);
+        return;
+    }
 
-            // Resample each channel using JUCE's Lagrange interpolator
-            for (int channel = 0; channel < fileNumChannels; ++channel)
-            {
-                juce::LagrangeInterpolator interpolator;
-                interpolator.reset();
-
-                // Read pointer from temp buffer, write pointer to output buffer
-                const float* readPtr = tempBuffer.getReadPointer(channel);
-                float* writePtr = newPlaybackData->buffer.getWritePointer(channel);
-
-                // Perform resampling
-                interpolator.process(
-                    speedRatio,             // Speed ratio for reading input (inverse of size ratio)
-                    readPtr,                // Source data
-                    writePtr,               // Destination data
-                    resampledNumSamples,    // Number of output samples
-                    fileNumSamples,         // Number of input samples available
-                    0                       // Wrap (0 = no wrap)
-                );
-            }
+    outputPlaybackFile = ingested->file;
+    {
+        const juce::ScopedLock lock(embeddedAudioLock);
+        embeddedOutputSource = ingested->file;
+    }
 
-            // Store final properties (at host sample rate)
-            newPlaybackData->sampleRate = hostSampleRate;
-            newPlaybackData->durationSeconds = (double)resampledNumSamples / hostSampleRate;
+    isPlayingOutputAudio.store(false);
+    isPausedOutputAudio.store(false);
+    outputPlaybackReadPosition.store(0);
+    outputPlaybackPosition.store(0.0);
 
-            DBG("Resampling complete: " + juce::String(resampledNumSamples) + " samples at " +
-                juce::String(hostSampleRate) + " Hz");
-        }
-        else
-        {
-            // No resampling needed - direct load
-            DBG("Sample rates match - loading directly");
+    outputAudioSampleRate.store(newPlaybackData->sampleRate);
+    outputAudioDuration.store(newPlaybackData->durationSeconds);
+    publishOutputPlayback(std::move(newPlaybackData));
+
+    DBG("Loaded ingested output audio for playback");
+}
+
+void Gary4juceAudioProcessor::publishOutputPlayback(std::unique_ptr<OutputPlaybackData> playbackData)
+{
+    // Anything published from here supersedes a loop decode still in flight
+    const juce::ScopedLock lock(outputLoadLock);
+    ++outputLoadSerial;
+    outputPlayback.publish(std::move(playbackData));
+}
 
-            newPlaybackData->buffer.setSize(fileNumChannels, fileNumSamples);
-            reader->read(&newPlaybackData->buffer, 0, fileNumSamples, 0, true, true);
+void Gary4juceAudioProcessor::queueLoopDecode(const juce::File& audioFile)
+{
+    std::uint32_t serial = 0;
+    {
+        const juce::ScopedLock lock(outputLoadLock);
+        serial = outputLoadSerial;
+    }
 
-            // Store file properties
-            newPlaybackData->sampleRate = fileSampleRate;
-            newPlaybackData->durationSeconds = (double)fileNumSamples / fileSampleRate;
+    loopIngest.reload(audioFile, currentSampleRate, [this, serial](ResultIngest::Handle ingested,
+                                                                   const juce::String& error)
+    {
+        if (ingested == nullptr)
+        {
+            DBG("Failed to decode output for loop playback: " + error);
+            return;
         }
 
-        std::shared_ptr<const OutputPlaybackData> immutablePlaybackData = newPlaybackData;
-        std::atomic_store(&outputPlaybackData, immutablePlaybackData);
-        outputAudioSampleRate.store(newPlaybackData->sampleRate);
-        outputAudioDuration.store(newPlaybackData->durationSeconds);
+        const juce::ScopedLock lock(outputLoadLock);
 
-        // Reset playback state
-        isPlayingOutputAudio.store(false);
-        isPausedOutputAudio.store(false);
-        outputPlaybackReadPosition.store(0);
-        outputPlaybackPosition.store(0.0);
+        // Another output was loaded, or looping turned off, while this ran
+        if (serial != outputLoadSerial || !outputLoopEnabled.load())
+            return;
 
-        DBG("Loaded output audio for playback successfully");
+        auto loopData = makeIngestedPlaybackData(ingested);
+        if (loopData == nullptr)
+            return;
+
+        // Same host rate as the stream it replaces, so the read position
+        // and transport state carry over
+        DBG("Decoded output for loop playback: " + juce::String(loopData->durationSeconds, 2) + "s, "
+            + juce::String(loopData->loopLengthBeats, 2) + " beats");
+        outputAudioDuration.store(loopData->durationSeconds);
+        outputPlayback.publish(std::move(loopData));
+    });
+}
+
+std::unique_ptr<Gary4juceAudioProcessor::OutputPlaybackData>
+Gary4juceAudioProcessor::makeIngestedPlaybackData(const ResultIngest::Handle& ingested) const
+{
+    const auto* playbackBuffer = ingested != nullptr ? ingested->getPlaybackBuffer() : nullptr;
+
+    // Streamed instead if it was too long to hold or the host rate has
+    // changed since the ingest ran
+    if (playbackBuffer == nullptr || playbackBuffer->getNumSamples() <= 0
+        || ingested->playbackRate != currentSampleRate)
+        return nullptr;
+
+    // No copy: the buffer stays owned by the shared result
+    auto data = std::make_unique<OutputPlaybackData>();
+    data->ingested = ingested;
+    data->sampleRate = ingested->playbackRate;
+    data->durationSeconds = (double)playbackBuffer->getNumSamples() / ingested->playbackRate;
+    data->loopLengthBeats = inferOutputLoopBeats(ingested->getDurationSeconds());
+    return data;
+}
+
+double Gary4juceAudioProcessor::inferOutputLoopBeats(double durationSeconds) const
+{
+    const double requestedBeats = outputLoopBeatsRequested.load();
+    if (requestedBeats > 0.0)
+        return requestedBeats;
+
+    // Generated loops are a whole number of beats at the tempo they were made
+    // at, which the host may since have moved away from
+    const double generationBpm = outputGenerationBpm.load();
+    const double bpm = generationBpm > 0.0 ? generationBpm : currentBPM.load();
+    return juce::jmax(1.0, (double)juce::roundToInt(durationSeconds * bpm / 60.0));
+}
+
+bool Gary4juceAudioProcessor::setOutputLoopPlayback(bool shouldLoop, double loopLengthInBeats)
+{
+    outputLoopBeatsRequested.store(juce::jmax(0.0, loopLengthInBeats));
+
+    if (!shouldLoop)
+    {
+        outputLoopEnabled.store(false);
+        return true;
     }
-    else
+
+    // Looping needs the whole output in memory; a streamed output is decoded
+    // on the loop ingest thread and swapped in when ready, keeping the
+    // transport state and position.
+    bool isStreamedOutput = false;
+    ResultIngest::Handle ingested;
+    outputPlayback.readLocked([&isStreamedOutput, &ingested](const OutputPlaybackData* playbackData)
     {
-        DBG("Failed to load audio file for playback: " + audioFile.getFullPathName());
+        isStreamedOutput = playbackData != nullptr && playbackData->stream != nullptr;
+        if (playbackData != nullptr)
+            ingested = playbackData->ingested;
+    });
+
+    if (ingested != nullptr)
+    {
+        // Already in memory; only the loop length can have changed
+        if (auto loopData = makeIngestedPlaybackData(ingested))
+            publishOutputPlayback(std::move(loopData));
     }
+    else if (isStreamedOutput)
+    {
+        if (outputAudioDuration.load() > maxLoopPlaybackSeconds)
+        {
+            DBG("Output is " + juce::String(outputAudioDuration.load(), 1) + "s - too long for loop playback");
+            return false;
+        }
+
+        outputLoopEnabled.store(true);
+        queueLoopDecode(outputPlaybackFile);
+        return true;
+    }
+
+    outputLoopEnabled.store(true);
+    return true;
 }
 
 void Gary4juceAudioProcessor::startOutputPlayback(double fromPosition)
 {
-    const auto playbackData = std::atomic_load(&outputPlaybackData);
+    // Already running: move it at a stamped sample, like any other seek
+    if (isPlayingOutputAudio.load())
+    {
+        seekOutputPlayback(fromPosition);
+        return;
+    }
 
-    if (playbackData != nullptr && playbackData->buffer.getNumSamples() > 0)
+    outputPlayback.readLocked([this, fromPosition](const OutputPlaybackData* playbackData)
     {
+        const int totalSamples = playbackData != nullptr ? playbackData->getNumSamples() : 0;
+        if (totalSamples <= 0)
+            return;
+
         // Calculate sample position from time
         int samplePosition = (int)(fromPosition * playbackData->sampleRate);
-        samplePosition = juce::jlimit(0, playbackData->buffer.getNumSamples() - 1, samplePosition);
+        samplePosition = juce::jlimit(0, totalSamples - 1, samplePosition);
+
+        // Nothing reads the stream while stopped, so it can move now and
+        // fill before the first block asks for it
+        if (playbackData->stream != nullptr)
+            playbackData->stream->seek(samplePosition);
 
         outputPlaybackReadPosition.store(samplePosition);
         outputPlaybackPosition.store((double)samplePosition / playbackData->sampleRate);
@@ -1398,7 +2462,7 @@ void Gary4juceAudioProcessor::startOutputPlayback(double fromPosition)
         isPlayingOutputAudio.store(true);
 
         DBG("Started output playback from " + juce::String(fromPosition, 2) + "s");
-    }
+    });
 }
 
 void Gary4juceAudioProcessor::pauseOutputPlayback()
@@ -1424,22 +2488,42 @@ void Gary4juceAudioProcessor::stopOutputPlayback()
 
 void Gary4juceAudioProcessor::seekOutputPlayback(double positionInSeconds)
 {
-    const auto playbackData = std::atomic_load(&outputPlaybackData);
-
-    if (playbackData != nullptr && playbackData->buffer.getNumSamples() > 0)
+    outputPlayback.readLocked([this, positionInSeconds](const OutputPlaybackData* playbackData) mutable
     {
+        const int totalSamples = playbackData != nullptr ? playbackData->getNumSamples() : 0;
+        if (totalSamples <= 0)
+            return;
+
         // Clamp position to valid range
         positionInSeconds = juce::jlimit(0.0, outputAudioDuration.load(), positionInSeconds);
 
         // Calculate sample position
         int samplePosition = (int)(positionInSeconds * playbackData->sampleRate);
-        samplePosition = juce::jlimit(0, playbackData->buffer.getNumSamples() - 1, samplePosition);
+        samplePosition = juce::jlimit(0, totalSamples - 1, samplePosition);
+
+        // A stream starts rendering the new position now, behind what is
+        // already queued, and only moves once the audio thread reaches the
+        // stamped sample. Stopped, it can move at once.
+        if (playbackData->stream != nullptr)
+        {
+            if (isPlayingOutputAudio.load())
+                playbackData->stream->cue(samplePosition);
+            else
+                playbackData->stream->seek(samplePosition);
+        }
+
+        // Stamp the request with where the audio thread's clock is now; the
+        // next block starts playing the new position from that sample.
+        OutputSeekRequest request;
+        request.targetSample = samplePosition;
+        request.hostSampleTime = outputTransport.load().getHostSampleTimeAt(juce::Time::getMillisecondCounterHiRes());
+        request.serial = outputSeekSerial.fetch_add(1, std::memory_order_acq_rel) + 1;
+        outputSeekRequest.store(request);
 
-        outputPlaybackReadPosition.store(samplePosition);
         outputPlaybackPosition.store((double)samplePosition / playbackData->sampleRate);
 
         DBG("Seeked to " + juce::String(positionInSeconds, 2) + "s");
-    }
+    });
 }
 
 //==============================================================================
@@ -8,6 +8,15 @@
 */
 #pragma once
 #include <JuceHeader.h>
+#include "Audio/RealtimeHandoff.h"
+#include "Audio/RecordingPeakFeed.h"
+#include "Audio/RecordingRing.h"
+#include "Audio/ResultIngest.h"
+#include "Audio/LoopPlaybackRenderer.h"
+#include "Audio/StreamingPlaybackSource.h"
+#include "Audio/TransportSnapshot.h"
+#include "Network/HttpClient.h"
+#include "Network/MetadataCache.h"
 #include <atomic>  // ADD THIS FOR ATOMIC TYPES
 #include <cstdint>
 #include <memory>
@@ -79,13 +88,30 @@ public:
     bool isRecording() const;  // Declaration only - implementation in .cpp
     float getRecordingProgress() const;  // Declaration only - implementation in .cpp
     bool saveRecordingToFile(const juce::File& file);
+    // Takes are streamed to a spool WAV in this directory while recording, so
+    // saving a finished take only has to move the file into place.
+    void setRecordingSpoolDirectory(const juce::File& directory);
     void loadAudioIntoRecordingBuffer(const juce::AudioBuffer<float>& sourceBuffer);
     void clearRecordingBuffer();
-    const juce::AudioBuffer<float>& getRecordingBuffer() const { return recordingBuffer; }
+    juce::uint32 getRecordingContentRevision() const noexcept { return recordingContentRevision.load(); }  // Bumped whenever the buffer is replaced
+
+    // Live waveform for the editor: buckets of each take as it is written
+    // (see RecordingPeakFeed.h), and a locked rebuild for when the editor
+    // has fallen out of step. summariseRecording returns the revision the
+    // peaks reflect. Message thread only.
+    RecordingPeakFeed& getRecordingPeakFeed() noexcept { return recordingPeakFeed; }
+    juce::uint32 summariseRecording(PeakPyramid& peaks);
     int getRecordedSamples() const;  // Declaration only - implementation in .cpp
     int getMaxRecordingSamples() const { return maxRecordingSamples; }  // ADD THIS
     double getCurrentSampleRate() const { return currentSampleRate; }
 
+    // Recording journal overflow accounting. Input that could not be queued is
+    // replaced by silence in the take, so these report loss, not misalignment.
+    juce::int64 getRecordingDroppedSamples() const noexcept { return recordingRing.getDroppedSamples(); }
+    int getRecordingOverflowCount() const noexcept { return recordingRing.getOverflowCount(); }
+    int getRecordingTakeGapSamples() const noexcept { return recordingTakeGapSamples.load(std::memory_order_acquire); }
+    float getRecordingJournalPeakFill() const noexcept { return recordingRing.getPeakFill(); }
+
     //==============================================================================
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
@@ -135,8 +161,8 @@ public:
     juce::String getCareyLanguage() const { return careyLanguage; }
 
     // Foundation UI state persistence
-    void setFoundationState(const juce::String& json) { foundationState = json; }
-    juce::String getFoundationState() const { return foundationState; }
+    void setFoundationState(const juce::String& json);
+    juce::String getFoundationState() const;
 
     // Versioned editor configuration. The editor is a disposable host-owned
     // view, so durable control state must live with the processor.
@@ -147,8 +173,28 @@ public:
         return hostStateRevision.load(std::memory_order_acquire);
     }
 
+    // Shared pool every backend request runs on (see HttpClient.h)
+    HttpClient& getHttpClient() noexcept { return httpClient; }
+
+    // Metadata responses shared with every other instance (see MetadataCache.h)
+    MetadataCache& getMetadataCache() noexcept { return *metadataCache; }
+
+    // Opt-in: store the recording and the last output inside the plugin state
+    // as FLAC so a reopened project gets its exact audio back. Restoring only
+    // copies the bytes; decoding runs on a background thread and the editor
+    // picks the results up through the take* calls below (message thread).
+    void setEmbedAudioInState(bool shouldEmbed) { embedAudioInState.store(shouldEmbed); }
+    bool getEmbedAudioInState() const { return embedAudioInState.load(); }
+    bool takeRestoredOutputAudio(juce::AudioBuffer<float>& destination, double& sampleRate);
+    bool takeRestoredRecording() { return restoredRecordingPending.exchange(false); }
+
     // Output audio playback control (for host audio)
     void loadOutputAudioForPlayback(const juce::File& audioFile);
+    void loadOutputAudioForPlayback(const ResultIngest::Handle& ingested);  // Plays from memory when it can
+
+    // Tempo the current output was generated at, so a loop keeps its length
+    // in beats when the host tempo changes. 0 falls back to the host tempo.
+    void setOutputGenerationBpm(double bpm) { outputGenerationBpm.store(juce::jmax(0.0, bpm)); }
     bool loadRecordingAudioForPlayback();
     void startOutputPlayback(double fromPosition = 0.0);
     void pauseOutputPlayback();
@@ -159,11 +205,24 @@ public:
     double getOutputPlaybackPosition() const { return outputPlaybackPosition.load(); }
     double getOutputAudioDuration() const { return outputAudioDuration.load(); }
 
+    // Lock-free: where playback was at the end of the last audio block.
+    OutputTransportSnapshot getOutputTransportSnapshot() const noexcept { return outputTransport.load(); }
+    std::uint32_t getLastOutputSeekSerial() const noexcept { return outputSeekSerial.load(std::memory_order_acquire); }
+
+    // Loop audition of generated output, locked to the host's PPQ position.
+    // loopLengthInBeats <= 0 infers the length from the output duration and
+    // host tempo. Returns false if the current output is too long to loop.
+    bool setOutputLoopPlayback(bool shouldLoop, double loopLengthInBeats = 0.0);
+    bool getIsLoopingOutput() const { return outputLoopEnabled.load(); }
+
 private:
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Gary4juceAudioProcessor)
 
     class BackendHealthChecker;
+    class RecordingWriter;
+    class EmbeddedAudioDecoder;
+    class EmbeddedAudioEncoder;
 
     // Backend connection state
     std::atomic<bool> backendConnected{ false };
@@ -177,28 +236,45 @@ private:
     LocalServiceHealthSnapshot localHealthSnapshot;
 
     // Thread safety - PUT THESE FIRST
+    // bufferLock guards the published part of recordingBuffer (recordedSamples)
+    // for snapshot readers. recordingWriterLock is held by the writer thread
+    // while it appends, so structural changes (clear/load/resize) take it first.
     juce::CriticalSection bufferLock;
+    juce::CriticalSection recordingWriterLock;
     std::atomic<int> atomicRecordedSamples{ 0 };
+    std::atomic<int> recordingTakeGapSamples{ 0 };   // Silence padded into the current take
     std::atomic<bool> atomicRecording{ false };
-    std::atomic<bool> recordingStartPending{ false };
-    std::atomic<bool> recordingStopPending{ false };
 
-    // Recording buffer state
+    // Recording buffer state (writer thread, published under bufferLock)
     juce::AudioBuffer<float> recordingBuffer;
-    juce::AudioBuffer<float> deferredRecordingBuffer;
     int bufferWritePosition = 0;
     int recordedSamples = 0;
-    int deferredRecordingSamples = 0;
-    int maxDeferredRecordingSamples = 0;
-    bool deferredRecordingOverflowed = false;
     bool recording = false;
-    bool wasPlaying = false;  // To detect transport state changes
     double currentSampleRate = 44100.0;  // Default fallback, updated in prepareToPlay()
 
+    // Streaming take spool (writer thread, guarded by recordingWriterLock)
+    juce::File recordingSpoolDirectory;
+    juce::File recordingSpoolFile;
+    std::unique_ptr<juce::AudioFormatWriter> recordingSpoolWriter;
+    int recordingSpoolSamples = 0;
+    bool recordingSpoolComplete = false;
+    juce::AudioBuffer<float> recordingGapBuffer;   // Silence for padding journal gaps
+
+    // Audio-thread-only recording state. Transport edges are turned into ring
+    // markers here; a marker that does not fit is retried on the next block.
+    RecordingRing recordingRing;
+    bool wasPlaying = false;  // To detect transport state changes
+    bool audioThreadRecording = false;
+    bool audioThreadTakeStartPending = false;
+    bool audioThreadTakeStopPending = false;
+    int audioThreadTakeSamples = 0;
+
     // Recording settings
     static constexpr double recordingLengthSeconds = 180.0;  // Extended for full-song Carey conditioning
-    static constexpr double deferredRecordingLengthSeconds = 2.0;
+    static constexpr double recordingRingLengthSeconds = 4.0;
+    static constexpr double recordingWindowSeconds = 20.0;  // Held in memory before a take outgrows it
     int maxRecordingSamples = 0;  // Will be calculated based on sample rate
+    int recordingWindowSamples = 0;
 
     std::atomic<double> currentBPM{ 120.0 };  // Thread-safe BPM storage
 
@@ -217,22 +293,143 @@ private:
     juce::String careyLyrics;
     juce::String careyLanguage = "en";
 
-    // Foundation UI state persistence
-    juce::String foundationState;
+    // A state document restored from a binary chunk stays as raw UTF-8 until
+    // something reads it, so instances whose editor is never opened don't pay
+    // for decoding it during project load and save it back byte-for-byte.
+    class LazyStateText
+    {
+    public:
+        void set(const juce::String& newText)
+        {
+            text = newText;
+            raw.reset();
+            pending = false;
+        }
+
+        void setRaw(const void* data, size_t numBytes)
+        {
+            raw.replaceAll(data, numBytes);
+            text.clear();
+            pending = true;
+        }
+
+        juce::String get() const
+        {
+            if (pending)
+            {
+                text = juce::String::fromUTF8(static_cast<const char*>(raw.getData()), (int)raw.getSize());
+                raw.reset();
+                pending = false;
+            }
+
+            return text;
+        }
+
+        juce::MemoryBlock getUtf8() const
+        {
+            if (pending)
+                return raw;
+
+            return { text.toRawUTF8(), text.getNumBytesAsUTF8() };
+        }
 
+    private:
+        mutable juce::MemoryBlock raw;
+        mutable juce::String text;
+        mutable bool pending = false;
+    };
+
+    // Audio embedded in the plugin state. Encoded blobs are cached against
+    // the content they came from so repeated saves don't re-encode, and the
+    // recording writer keeps them fresh between takes so a save rarely has
+    // to encode anything itself.
+    struct EmbeddedAudio
+    {
+        juce::AudioBuffer<float> buffer;
+        double sampleRate = 0.0;
+    };
+
+    static constexpr size_t maxEmbeddedAudioBytes = 48 * 1024 * 1024;   // Per stream, encoded
+    static constexpr double maxEmbeddedAudioSeconds = 600.0;
+    static constexpr double maxEmbeddedAudioSampleRate = 384000.0;
+    static constexpr int maxEmbeddedAudioChannels = 2;                  // Extra channels are dropped
+
+    // A restored chunk is only decoded if its length is plausible for its
+    // size: FLAC stays far below this many samples per byte even on silence.
+    static constexpr int maxEmbeddedSamplesPerByte = 512;
+
+    juce::MemoryBlock getEmbeddedRecordingFlac();
+    juce::MemoryBlock getEmbeddedOutputFlac();
+    void updateEmbeddedRecordingFlac(const std::function<bool()>& shouldStop);
+    void updateEmbeddedOutputFlac(const std::function<bool()>& shouldStop);
+    void refreshEmbeddedAudioCache(const std::function<bool()>& shouldStop);
+    void startEmbeddedAudioDecode(juce::MemoryBlock recordingFlac, juce::MemoryBlock outputFlac);
+    void embeddedAudioDecoded(std::unique_ptr<EmbeddedAudio> recording, std::unique_ptr<EmbeddedAudio> output);
+    void installPendingEmbeddedRecording();
+
+    std::atomic<bool> embedAudioInState{ false };
+    std::atomic<bool> restoredRecordingPending{ false };
+    std::atomic<juce::uint32> recordingContentRevision{ 0 };
+    RecordingPeakFeed recordingPeakFeed;    // Written by the recording writer
+    juce::CriticalSection embeddedAudioLock;
+    juce::CriticalSection embeddedEncodeLock;  // One encode at a time
+    std::unique_ptr<EmbeddedAudio> pendingEmbeddedRecording;    // Waits for a prepared recording buffer
+    std::unique_ptr<EmbeddedAudio> restoredEmbeddedOutput;      // Waits for the editor
+    juce::File embeddedOutputSource;
+    juce::MemoryBlock cachedRecordingFlac;
+    juce::uint32 cachedRecordingRevision = 0;
+    int cachedRecordingSamples = 0;
+    juce::MemoryBlock cachedOutputFlac;
+    juce::File cachedOutputFile;
+    juce::Time cachedOutputModificationTime;
+    juce::int64 cachedOutputSize = 0;
+    bool cachedOutputRestored = false;      // cachedOutputFlac came from a restored state
+    juce::uint32 embeddedCacheEpoch = 0;    // Bumped by every restore
+
+    bool restoreBinaryState(const void* data, int sizeInBytes);
+    bool restoreLegacyXmlState(const void* data, int sizeInBytes);
+    void finishStateRestore(bool wasUsingLocalhost);
+
+    // Editor and Foundation UI state persistence (guarded by editorStateLock)
     mutable juce::CriticalSection editorStateLock;
-    juce::String editorState;
+    LazyStateText foundationState;
+    LazyStateText editorState;
     std::atomic<std::uint64_t> hostStateRevision { 0 };
 
+    // Either an in-memory snapshot (input audition, looped output), a
+    // generated output the editor's ingest already decoded at the host rate,
+    // or a disk-backed stream (long generated output). sampleRate is always
+    // the host rate.
     struct OutputPlaybackData
     {
         juce::AudioBuffer<float> buffer;
+        ResultIngest::Handle ingested;  // Shared with the editor; used instead of buffer when set
+        std::unique_ptr<StreamingPlaybackSource> stream;
         double sampleRate = 44100.0;
         double durationSeconds = 0.0;
+        double loopLengthBeats = 0.0;   // > 0 for a generated output held in memory
+
+        const juce::AudioBuffer<float>& getBuffer() const noexcept
+        {
+            if (ingested != nullptr)
+                if (const auto* playbackBuffer = ingested->getPlaybackBuffer())
+                    return *playbackBuffer;
+            return buffer;
+        }
+
+        int getNumSamples() const
+        {
+            return stream != nullptr ? (int)stream->getTotalLength() : getBuffer().getNumSamples();
+        }
     };
 
-    // Output audio playback state (for host audio mixing)
-    std::shared_ptr<const OutputPlaybackData> outputPlaybackData;
+    // Must outlive outputPlayback: retired streams unregister from it.
+    juce::TimeSliceThread playbackReadAheadThread { "gary4juce playback read-ahead" };
+
+    // Output audio playback state (for host audio mixing). Buffers are handed
+    // to processBlock through the handoff, which also frees replaced buffers
+    // off the audio thread.
+    RealtimeHandoff<OutputPlaybackData> outputPlayback;
     std::atomic<bool> isPlayingOutputAudio{false};
     std::atomic<bool> isPausedOutputAudio{false};
     std::atomic<double> outputPlaybackPosition{0.0};  // In seconds
@@ -240,18 +437,64 @@ private:
     std::atomic<double> outputAudioSampleRate{44100.0};
     std::atomic<int> outputPlaybackReadPosition{ 0 };  // In samples
 
+    // Published once per block for the editor's cursor, and seeks posted back
+    // for the audio thread to apply at a sample offset.
+    SeqLockValue<OutputTransportSnapshot> outputTransport;
+    SeqLockValue<OutputSeekRequest> outputSeekRequest;
+    std::atomic<std::uint32_t> outputSeekSerial{ 0 };
+    std::uint32_t audioThreadSeekSerial = 0;      // Audio thread
+    juce::int64 audioThreadSampleTime = 0;     // Audio thread sample clock
+
+    // Loop playback. The flag and requested length are set from the message
+    // thread; the renderer belongs to the audio thread.
+    std::atomic<bool> outputLoopEnabled{ false };
+    std::atomic<double> outputLoopBeatsRequested{ 0.0 };
+    std::atomic<double> outputGenerationBpm{ 0.0 };   // 0 if unknown
+    juce::File outputPlaybackFile;             // Message thread
+    LoopPlaybackRenderer outputLoopRenderer;
+    bool audioThreadLooping = false;
+    static constexpr double maxLoopPlaybackSeconds = 120.0;
+
+    // Decodes a streamed output for looping off the message thread. Declared
+    // after outputPlayback and the lock so it stops before either goes. A
+    // decode only lands if nothing else was published since it was queued.
+    juce::CriticalSection outputLoadLock;
+    std::uint32_t outputLoadSerial = 0;        // Guarded by outputLoadLock
+    ResultIngest loopIngest;
+
     // Private methods
-    void startRecording();
-    void stopRecording();
-    void requestRecordingStartFromAudioThread() noexcept;
-    void requestRecordingStopFromAudioThread() noexcept;
-    void applyPendingRecordingStateFromAudioThread(int totalNumInputChannels, bool& stoppedThisBlock);
-    void copyInputBlockToRecordingBuffer(const juce::AudioBuffer<float>& sourceBuffer,
-                                         int totalNumInputChannels,
-                                         int numSamples);
-    void appendDeferredRecordingBlock(const juce::AudioBuffer<float>& sourceBuffer,
-                                      int totalNumInputChannels,
-                                      int numSamples);
-    void flushDeferredRecordingBlocks(int totalNumInputChannels);
+    void pushRecordingInputFromAudioThread(const juce::AudioBuffer<float>& sourceBuffer,
+                                           int totalNumInputChannels,
+                                           bool isCurrentlyPlaying) noexcept;
+    void drainRecordingRing();
+    void growRecordingBuffer(int numSamples);
+    void shrinkRecordingBuffer();
+    void openRecordingSpool(int numChannels);
+    void writeRecordingSpool(const juce::AudioBuffer<float>& source, int startSample, int numSamples);
+    void finishRecordingSpool();
+    void discardRecordingSpool();
+    bool installRecordingSpool(const juce::File& file);
     void stopRecordingNonBlocking() noexcept;
+    void renderOutputPlayback(juce::AudioBuffer<float>& buffer, int totalNumOutputChannels,
+                              bool hostIsPlaying, double hostPpq, bool hostPpqValid) noexcept;
+    void publishOutputPlayback(std::unique_ptr<OutputPlaybackData> playbackData);
+    void queueLoopDecode(const juce::File& audioFile);
+    std::unique_ptr<OutputPlaybackData> makeIngestedPlaybackData(const ResultIngest::Handle& ingested) const;
+    double inferOutputLoopBeats(double durationSeconds) const;
+    static juce::int64 mixOutputPlaybackBuffer(const juce::AudioBuffer<float>& playbackBuffer,
+                                               juce::int64 readPosition,
+                                               juce::AudioBuffer<float>& dest,
+                                               int destStartSample,
+                                               int numSamples,
+                                               int totalNumOutputChannels) noexcept;
+
+    std::unique_ptr<RecordingWriter> recordingWriter;
+    std::unique_ptr<EmbeddedAudioDecoder> embeddedAudioDecoder;
+    std::unique_ptr<EmbeddedAudioEncoder> embeddedAudioEncoder;
+
+    juce::SharedResourcePointer<MetadataCache> metadataCache;
+
+    // Declared last so pending requests are cancelled and joined before
+    // anything they might touch is destroyed.
+    HttpClient httpClient;
 };
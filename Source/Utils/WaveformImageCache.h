@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// WaveformImageCache.h
+#pragma once
+#include <JuceHeader.h>
+#include <cstdint>
+#include <cstring>
+
+// Keeps the static body of a waveform display as an image, so a repaint that
+// only moves a cursor, steps a progress bar or flashes an indicator copies
+// pixels instead of redrawing every column.
+//
+// The owner describes what the body shows with a key (combine() the values
+// it depends on) and passes a render function. The body is redrawn only when
+// the key, the area or the display scale changes; otherwise draw() is one
+// image blit clipped to whatever region is being repainted. A body that only
+// grows (a take being recorded) can instead have just the strip that changed
+// redrawn into the existing image. The image is sized in physical pixels so
+// it stays sharp on high-DPI displays.
+class WaveformImageCache
+{
+public:
+    using RenderFunction = std::function<void(juce::Graphics&, const juce::Rectangle<int>&)>;
+
+    static std::uint64_t combine(std::uint64_t seed, double value) noexcept
+    {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return mix(seed, bits);
+    }
+
+    // Identity only; pair it with something that changes when the object is
+    // replaced, since a new one can land at a freed address.
+    static std::uint64_t combine(std::uint64_t seed, const void* pointer) noexcept
+    {
+        return mix(seed, (std::uint64_t)reinterpret_cast<std::uintptr_t>(pointer));
+    }
+
+    static constexpr std::uint64_t initialKey = 14695981039346656037ull;
+
+    // Renders with area in component coordinates, as if drawing directly.
+    void draw(juce::Graphics& g, const juce::Rectangle<int>& area, std::uint64_t key, const RenderFunction& render)
+    {
+        if (area.isEmpty())
+            return;
+
+        const float scale = juce::jmax(1.0f, g.getInternalContext().getPhysicalPixelScaleFactor());
+
+        if (!image.isValid() || key != cachedKey || area != cachedArea || scale != cachedScale)
+        {
+            const int width = juce::roundToInt((float)area.getWidth() * scale);
+            const int height = juce::roundToInt((float)area.getHeight() * scale);
+
+            if (!image.isValid() || image.getWidth() != width || image.getHeight() != height)
+                image = juce::Image(juce::Image::ARGB, width, height, true);
+            else
+                image.clear(image.getBounds());
+
+            juce::Graphics imageGraphics(image);
+            imageGraphics.addTransform(juce::AffineTransform::translation((float)-area.getX(), (float)-area.getY())
+                                           .scaled(scale));
+            render(imageGraphics, area);
+
+            cachedKey = key;
+            cachedArea = area;
+            cachedScale = scale;
+        }
+
+        g.drawImage(image, area.toFloat());
+    }
+
+    // Clears region of the cached image and renders it again, clipped to the
+    // region; the rest of the image is kept. The render function should skip
+    // what falls outside g.getClipBounds(). Without a cached image this does
+    // nothing, as the next draw() renders everything anyway.
+    void redraw(const juce::Rectangle<int>& region, const RenderFunction& render)
+    {
+        if (!image.isValid())
+            return;
+
+        const auto physical = (region.getIntersection(cachedArea) - cachedArea.getPosition())
+                                  .toFloat().transformedBy(juce::AffineTransform::scale(cachedScale))
+                                  .getSmallestIntegerContainer()
+                                  .getIntersection(image.getBounds());
+        if (physical.isEmpty())
+            return;
+
+        image.clear(physical);
+
+        juce::Graphics imageGraphics(image);
+        imageGraphics.reduceClipRegion(physical);
+        imageGraphics.addTransform(juce::AffineTransform::translation((float)-cachedArea.getX(), (float)-cachedArea.getY())
+                                       .scaled(cachedScale));
+        render(imageGraphics, cachedArea);
+    }
+
+    void invalidate() noexcept { image = {}; }
+
+private:
+    // FNV-1a over the value's bytes
+    static std::uint64_t mix(std::uint64_t seed, std::uint64_t bits) noexcept
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            seed ^= (bits >> (i * 8)) & 0xff;
+            seed *= 1099511628211ull;
+        }
+        return seed;
+    }
+
+    juce::Image image;
+    std::uint64_t cachedKey = 0;
+    juce::Rectangle<int> cachedArea;
+    float cachedScale = 1.0f;
+};
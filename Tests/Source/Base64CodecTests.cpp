@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// Base64CodecTests.cpp
+#include <JuceHeader.h>
+#include "TestCategories.h"
+#include "../../Source/Network/Base64Codec.h"
+#include <cstring>
+
+// Base64Codec against juce::Base64 on random payloads, with the decoder fed in
+// random chunk sizes so every vector/scalar hand-over and every split of a
+// group across writes gets exercised.
+class Base64CodecTests final : public juce::UnitTest
+{
+public:
+    Base64CodecTests() : juce::UnitTest("Base64Codec", TestCategories::unit) {}
+
+    void runTest() override
+    {
+        auto random = getRandom();
+
+        beginTest("Encode matches juce::Base64");
+        for (int iteration = 0; iteration < 500; ++iteration)
+        {
+            const auto data = makePayload(random, random.nextInt(4096));
+            expectEquals(Base64Codec::encode(data.getData(), data.getSize()),
+                         juce::Base64::toBase64(data.getData(), data.getSize()));
+        }
+
+        beginTest("Round trip in random chunks");
+        for (int iteration = 0; iteration < 500; ++iteration)
+        {
+            const auto data = makePayload(random, random.nextInt(20000));
+            const auto text = Base64Codec::encode(data.getData(), data.getSize());
+            expect(decodeInChunks(random, text.toStdString()) == data, "size " + juce::String((int)data.getSize()));
+        }
+
+        beginTest("Whitespace and the URL-safe alphabet are accepted");
+        for (int iteration = 0; iteration < 200; ++iteration)
+        {
+            const auto data = makePayload(random, random.nextInt(3000));
+            std::string text;
+
+            for (auto c : Base64Codec::encode(data.getData(), data.getSize()).toStdString())
+            {
+                if (c == '+') c = '-';
+                if (c == '/') c = '_';
+                text += c;
+
+                if (random.nextInt(40) == 0)
+                    text += random.nextBool() ? "\r\n" : " ";
+            }
+
+            expect(decodeInChunks(random, text) == data);
+        }
+
+        beginTest("Malformed input is rejected");
+        for (int iteration = 0; iteration < 200; ++iteration)
+        {
+            const auto data = makePayload(random, 1 + random.nextInt(3000));
+            auto text = Base64Codec::encode(data.getData(), data.getSize()).toStdString();
+            text[(size_t)random.nextInt((int)text.size())] = "!*.\x80"[random.nextInt(4)];
+
+            juce::MemoryOutputStream out;
+            Base64Codec::Decoder decoder;
+            expect(!(decoder.write(text.data(), text.size(), out) && decoder.finish(out)));
+        }
+
+        {
+            juce::MemoryOutputStream out;
+            Base64Codec::Decoder decoder;
+            expect(!(decoder.write("QUJD=QUJD", 9, out) && decoder.finish(out)), "data after padding");
+        }
+
+        {
+            juce::MemoryOutputStream out;
+            Base64Codec::Decoder decoder;
+            expect(!(decoder.write("QUJDR", 5, out) && decoder.finish(out)), "a lone trailing character");
+        }
+    }
+
+private:
+    static juce::MemoryBlock makePayload(juce::Random& random, int size)
+    {
+        juce::MemoryBlock data((size_t)size);
+        random.fillBitsRandomly(data.getData(), data.getSize());
+        return data;
+    }
+
+    static juce::MemoryBlock decodeInChunks(juce::Random& random, const std::string& text)
+    {
+        juce::MemoryOutputStream out;
+        Base64Codec::Decoder decoder;
+        size_t position = 0;
+        bool ok = true;
+
+        while (ok && position < text.size())
+        {
+            const auto length = juce::jmin(text.size() - position, (size_t)(1 + random.nextInt(300)));
+            ok = decoder.write(text.data() + position, length, out);
+            position += length;
+        }
+
+        if (!ok || !decoder.finish(out))
+            return {};
+
+        return out.getMemoryBlock();
+    }
+};
+
+// Encode and decode throughput against juce::Base64, from a short clip up to
+// the largest results a backend sends, in GB/s.
+class Base64CodecBenchmark final : public juce::UnitTest
+{
+public:
+    Base64CodecBenchmark() : juce::UnitTest("Base64Codec throughput", TestCategories::benchmark) {}
+
+    void runTest() override
+    {
+        for (const int megabytes : { 1, 10, 50, 200 })
+        {
+            beginTest("Encode and decode " + juce::String(megabytes) + " MB");
+            runSize((size_t)megabytes * 1000 * 1000);
+        }
+    }
+
+private:
+    void runSize(size_t numBytes)
+    {
+        // The big payloads take long enough per pass that three are plenty
+        const int runs = numBytes >= (size_t)50 * 1000 * 1000 ? 3 : 5;
+
+        juce::MemoryBlock data(numBytes);
+        getRandom().fillBitsRandomly(data.getData(), data.getSize());
+
+        juce::String encoded;
+        const double codecEncodeMs = TestCategories::timeBestOf(runs, [&] { encoded = Base64Codec::encode(data.getData(), data.getSize()); });
+        const double juceEncodeMs = TestCategories::timeBestOf(runs, [&] { juce::Base64::toBase64(data.getData(), data.getSize()); });
+
+        juce::MemoryOutputStream decoded(data.getSize() + 16);
+        const double codecDecodeMs = TestCategories::timeBestOf(runs, [&]
+        {
+            decoded.reset();
+            Base64Codec::decode(encoded, decoded);
+        });
+
+        const double juceDecodeMs = TestCategories::timeBestOf(runs, [&]
+        {
+            juce::MemoryOutputStream out(data.getSize() + 16);
+            juce::Base64::convertFromBase64(out, encoded);
+        });
+
+        expect(decoded.getDataSize() == data.getSize()
+               && std::memcmp(decoded.getData(), data.getData(), data.getSize()) == 0);
+
+        // Of raw bytes, both ways
+        const auto gigabytesPerSecond = [numBytes](double ms)
+        {
+            return juce::String((double)numBytes / 1.0e9 / (ms / 1000.0), 2) + " GB/s";
+        };
+
+        logMessage("encode: Base64Codec " + gigabytesPerSecond(codecEncodeMs) + ", juce::Base64 " + gigabytesPerSecond(juceEncodeMs));
+        logMessage("decode: Base64Codec " + gigabytesPerSecond(codecDecodeMs) + ", juce::Base64 " + gigabytesPerSecond(juceDecodeMs));
+    }
+};
+
+static Base64CodecTests base64CodecTests;
+static Base64CodecBenchmark base64CodecBenchmark;
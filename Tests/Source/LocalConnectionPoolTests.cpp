@@ -0,0 +1,314 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// LocalConnectionPoolTests.cpp
+#include <JuceHeader.h>
+#include "TestCategories.h"
+#include "../../Source/Network/HttpClient.h"
+#include <thread>
+
+// HttpClient::openStream against a stand-in backend on 127.0.0.1 that counts
+// the TCP connections it accepts. Sequential requests should all ride one
+// kept-alive connection whatever the body framing; a body dropped part way or
+// a server that says close costs a new one; the timeout applies to each
+// wait, not to the whole response; and a cancelled token stops a stalled
+// read, and with it a client's shutdown, long before any timeout.
+class LocalConnectionPoolTests final : public juce::UnitTest
+{
+public:
+    LocalConnectionPoolTests() : juce::UnitTest("LocalConnectionPool", TestCategories::unit) {}
+
+    void runTest() override
+    {
+        // A fresh server per case: pooled connections are kept per port, so
+        // none carry over from the case before.
+        {
+            StandInServer server;
+            if (!server.isListening())
+            {
+                logMessage("couldn't listen on 127.0.0.1, skipping");
+                return;
+            }
+
+            beginTest("Content-Length bodies reuse one connection");
+            for (int i = 0; i < 20; ++i)
+                expectEquals(fetch(server, "/length"), "ok " + juce::String(i));
+            expectEquals(server.getNumConnections(), 1);
+        }
+
+        {
+            StandInServer server;
+            beginTest("Chunked bodies reuse one connection");
+            for (int i = 0; i < 10; ++i)
+                expectEquals(fetch(server, "/chunked"), juce::String("chunked body split across three chunks"));
+            expectEquals(server.getNumConnections(), 1);
+        }
+
+        {
+            StandInServer server;
+            beginTest("A body left unread isn't reused");
+            expect(open(server, "/length") != nullptr);
+            expectEquals(fetch(server, "/length"), juce::String("ok 1"));
+            expectEquals(server.getNumConnections(), 2);
+        }
+
+        {
+            StandInServer server;
+            beginTest("Connection: close is honoured");
+            for (int i = 0; i < 3; ++i)
+                expectEquals(fetch(server, "/close"), juce::String("bye"));
+            expectEquals(server.getNumConnections(), 3);
+        }
+
+        {
+            StandInServer server;
+            beginTest("The timeout applies per read, not to the whole body");
+            expectEquals(fetch(server, "/slow", 400), juce::String("abcdef"));
+
+            beginTest("A stalled read times out");
+            expectEquals(fetch(server, "/stall", 200), juce::String());
+        }
+
+        {
+            StandInServer server;
+            beginTest("Cancelling the token stops a stalled read");
+
+            HttpClient::CancellationToken token;
+            auto stream = open(server, "/hang", 10000, nullptr, token);
+            expect(stream != nullptr);
+
+            if (stream != nullptr)
+            {
+                std::thread canceller([token] { juce::Thread::sleep(100); token.cancel(); });
+
+                const auto startMs = juce::Time::getMillisecondCounterHiRes();
+                char buffer[6];
+                expectEquals(stream->read(buffer, (int)sizeof(buffer)), 2);
+                const auto elapsedMs = juce::Time::getMillisecondCounterHiRes() - startMs;
+                canceller.join();
+
+                expect(stream->isExhausted());
+                expect(elapsedMs < 1000.0, "read stopped after " + juce::String(elapsedMs, 0) + " ms");
+            }
+        }
+
+        {
+            StandInServer server;
+            beginTest("Destroying the client doesn't wait out a stalled job");
+
+            auto client = std::make_unique<HttpClient>(1, 1, 0);
+            std::atomic<bool> started{ false };
+
+            client->submit(HttpClient::Priority::Metadata, urlFor(server, "/hang"), [&server, &started](const HttpClient::CancellationToken&)
+            {
+                started = true;
+                if (auto stream = open(server, "/hang", 10000))
+                    stream->readEntireStreamAsString();
+            });
+
+            while (!started)
+                juce::Thread::sleep(1);
+            juce::Thread::sleep(50);
+
+            const auto startMs = juce::Time::getMillisecondCounterHiRes();
+            client.reset();
+            const auto elapsedMs = juce::Time::getMillisecondCounterHiRes() - startMs;
+
+            expect(elapsedMs < 1000.0, "shutdown took " + juce::String(elapsedMs, 0) + " ms");
+        }
+    }
+
+private:
+    // Answers on an ephemeral port, one thread per accepted connection.
+    class StandInServer final : private juce::Thread
+    {
+    public:
+        StandInServer() : juce::Thread("stand-in backend")
+        {
+            if (listener.createListener(0, "127.0.0.1"))
+                startThread();
+        }
+
+        ~StandInServer() override
+        {
+            stopping = true;
+            stopThread(2000);
+            listener.close();
+
+            for (auto& handler : handlers)
+                handler.join();
+        }
+
+        bool isListening() const { return isThreadRunning(); }
+        int getPort() const { return listener.getBoundPort(); }
+        int getNumConnections() const { return connections.load(); }
+
+    private:
+        void run() override
+        {
+            while (!threadShouldExit())
+            {
+                if (listener.waitUntilReady(true, 50) != 1)
+                    continue;
+
+                std::unique_ptr<juce::StreamingSocket> socket(listener.waitForNextConnection());
+                if (socket == nullptr)
+                    continue;
+
+                ++connections;
+                handlers.emplace_back([this, client = std::shared_ptr<juce::StreamingSocket>(std::move(socket))]
+                {
+                    serve(*client);
+                });
+            }
+        }
+
+        void serve(juce::StreamingSocket& socket)
+        {
+            juce::MemoryBlock received;
+
+            while (!stopping)
+            {
+                const auto head = readHead(socket, received);
+                if (head.isEmpty())
+                    return;
+
+                const auto path = head.fromFirstOccurrenceOf(" ", false, false).upToFirstOccurrenceOf(" ", false, false);
+                const int number = requests++;
+
+                if (path == "/length")
+                {
+                    send(socket, withLength("ok " + juce::String(number)));
+                }
+                else if (path == "/chunked")
+                {
+                    send(socket, "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n"
+                                 "8\r\nchunked \r\n"
+                                 "11\r\nbody split across\r\n"
+                                 "d;ext=1\r\n three chunks\r\n"
+                                 "0\r\nX-Trailer: 1\r\n\r\n");
+                }
+                else if (path == "/close")
+                {
+                    send(socket, "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 3\r\n\r\nbye");
+                    return;
+                }
+                else if (path == "/slow")
+                {
+                    // Three waits of 250 ms: each inside the timeout, the
+                    // total well past it
+                    send(socket, "HTTP/1.1 200 OK\r\nContent-Length: 6\r\n\r\n");
+                    for (auto part : { "ab", "cd", "ef" })
+                    {
+                        juce::Thread::sleep(250);
+                        send(socket, part);
+                    }
+                }
+                else if (path == "/hang")
+                {
+                    // Part of the body, then nothing until the server goes
+                    send(socket, "HTTP/1.1 200 OK\r\nContent-Length: 6\r\n\r\nab");
+                    while (!stopping)
+                        juce::Thread::sleep(50);
+                    return;
+                }
+                else if (path == "/stall")
+                {
+                    send(socket, "HTTP/1.1 200 OK\r\nContent-Length: 6\r\n\r\nab");
+                    for (int i = 0; i < 20 && !stopping; ++i)
+                        juce::Thread::sleep(50);
+                    return;
+                }
+                else
+                {
+                    send(socket, "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n");
+                }
+            }
+        }
+
+        static juce::String withLength(const juce::String& body)
+        {
+            return "HTTP/1.1 200 OK\r\nContent-Length: " + juce::String(body.getNumBytesAsUTF8()) + "\r\n\r\n" + body;
+        }
+
+        // The next request head, leaving anything after it in received.
+        juce::String readHead(juce::StreamingSocket& socket, juce::MemoryBlock& received)
+        {
+            for (;;)
+            {
+                const auto text = received.toString();
+                const int end = text.indexOf("\r\n\r\n");
+                if (end >= 0)
+                {
+                    received.removeSection(0, (size_t)end + 4);
+                    return text.substring(0, end);
+                }
+
+                if (stopping)
+                    return {};
+
+                const int ready = socket.waitUntilReady(true, 50);
+                if (ready < 0)
+                    return {};
+                if (ready == 0)
+                    continue;
+
+                char buffer[1024];
+                const int bytesRead = socket.read(buffer, (int)sizeof(buffer), false);
+                if (bytesRead <= 0)
+                    return {};
+
+                received.append(buffer, (size_t)bytesRead);
+            }
+        }
+
+        static void send(juce::StreamingSocket& socket, const juce::String& text)
+        {
+            socket.write(text.toRawUTF8(), (int)text.getNumBytesAsUTF8());
+        }
+
+        juce::StreamingSocket listener;
+        std::vector<std::thread> handlers;      // Only touched by run() until the destructor joins
+        std::atomic<int> connections { 0 };
+        std::atomic<int> requests { 0 };     // Numbers the /length replies
+        std::atomic<bool> stopping { false };
+    };
+
+    static juce::URL urlFor(const StandInServer& server, const juce::String& path)
+    {
+        return juce::URL("http://127.0.0.1:" + juce::String(server.getPort()) + path);
+    }
+
+    static std::unique_ptr<juce::InputStream> open(const StandInServer& server, const juce::String& path,
+                                                   int timeoutMs = 2000, int* statusCode = nullptr,
+                                                   const HttpClient::CancellationToken& token = HttpClient::getCurrentJobToken())
+    {
+        return HttpClient::openStream(urlFor(server, path),
+                                      juce::URL::InputStreamOptions(juce::URL::ParameterHandling::inAddress)
+                                          .withConnectionTimeoutMs(timeoutMs)
+                                          .withStatusCode(statusCode),
+                                      token);
+    }
+
+    // The body, or an empty string if the request or the read failed.
+    juce::String fetch(const StandInServer& server, const juce::String& path, int timeoutMs = 2000)
+    {
+        int statusCode = 0;
+        auto stream = open(server, path, timeoutMs, &statusCode);
+        if (stream == nullptr)
+            return {};
+
+        expectEquals(statusCode, 200);
+
+        juce::MemoryOutputStream body;
+        body.writeFromInputStream(*stream, -1);
+
+        const auto length = stream->getTotalLength();
+        if (length >= 0 && (juce::int64)body.getDataSize() != length)
+            return {};
+
+        return body.toString();
+    }
+};
+
+static LocalConnectionPoolTests localConnectionPoolTests;
@@ -0,0 +1,33 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// Main.cpp
+#include <JuceHeader.h>
+#include "TestCategories.h"
+
+// Runs the gary4juce unit tests; pass --bench to run the benchmarks as well,
+// or --bench-only to run just those. Exits non-zero if anything failed.
+int main(int argc, char* argv[])
+{
+    // The processor and the networking code expect a message manager
+    const juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    const juce::ArgumentList args(argc, argv);
+
+    const bool benchOnly = args.containsOption("--bench-only");
+    const bool runBenchmarks = benchOnly || args.containsOption("--bench");
+
+    juce::UnitTestRunner runner;
+    runner.setAssertOnFailure(false);
+
+    if (!benchOnly)
+        runner.runTestsInCategory(TestCategories::unit);
+
+    if (runBenchmarks)
+        runner.runTestsInCategory(TestCategories::benchmark);
+
+    int failures = 0;
+    for (int i = 0; i < runner.getNumResults(); ++i)
+        failures += runner.getResult(i)->failures;
+
+    return failures == 0 ? 0 : 1;
+}
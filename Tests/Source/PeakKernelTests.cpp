@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// PeakKernelTests.cpp
+#include <JuceHeader.h>
+#include "TestCategories.h"
+#include "../../Source/Audio/PeakKernel.h"
+
+namespace
+{
+    // The per-sample loop PeakKernel replaced.
+    PeakKernel::Summary summariseScalar(const juce::AudioBuffer<float>& source, int startSample, int numSamples, int numChannels)
+    {
+        PeakKernel::Summary summary;
+        const int channels = juce::jmin(numChannels, source.getNumChannels());
+        if (channels <= 0 || numSamples <= 0)
+            return summary;
+
+        for (int i = startSample; i < startSample + numSamples; ++i)
+        {
+            float value = 0.0f;
+            for (int channel = 0; channel < channels; ++channel)
+                value += source.getSample(channel, i);
+            value /= (float)channels;
+
+            summary.min = juce::jmin(summary.min, value);
+            summary.max = juce::jmax(summary.max, value);
+            summary.sumSquares += value * value;
+        }
+
+        summary.count = numSamples;
+        return summary;
+    }
+
+    juce::AudioBuffer<float> makeNoise(juce::Random& random, int numChannels, int numSamples)
+    {
+        juce::AudioBuffer<float> buffer(numChannels, numSamples);
+        for (int channel = 0; channel < numChannels; ++channel)
+            for (int i = 0; i < numSamples; ++i)
+                buffer.setSample(channel, i, random.nextFloat() * 2.0f - 1.0f);
+        return buffer;
+    }
+}
+
+// PeakKernel against the scalar loop on random spans, so block boundaries and
+// short tails all get covered.
+class PeakKernelTests final : public juce::UnitTest
+{
+public:
+    PeakKernelTests() : juce::UnitTest("PeakKernel", TestCategories::unit) {}
+
+    void runTest() override
+    {
+        auto random = getRandom();
+
+        beginTest("Matches the scalar loop");
+        for (int channels = 1; channels <= 3; ++channels)
+        {
+            const auto buffer = makeNoise(random, channels, 10000);
+
+            for (int iteration = 0; iteration < 200; ++iteration)
+            {
+                const int start = random.nextInt(buffer.getNumSamples());
+                const int count = random.nextInt(buffer.getNumSamples() - start + 1);
+
+                const auto fast = PeakKernel::summarise(buffer, start, count, channels);
+                const auto slow = summariseScalar(buffer, start, count, channels);
+
+                expectWithinAbsoluteError(fast.min, slow.min, 1.0e-6f);
+                expectWithinAbsoluteError(fast.max, slow.max, 1.0e-6f);
+                expectWithinAbsoluteError(fast.sumSquares, slow.sumSquares, 1.0e-4f * juce::jmax(1.0f, slow.sumSquares));
+                expectEquals(fast.count, slow.count);
+            }
+        }
+
+        beginTest("Extremes include zero");
+        juce::AudioBuffer<float> positive(1, 100);
+        positive.clear();
+        for (int i = 0; i < 100; ++i)
+            positive.setSample(0, i, 0.25f + 0.005f * (float)i);
+
+        const auto summary = PeakKernel::summarise(positive, 0, 100, 1);
+        expectEquals(summary.min, 0.0f);
+        expectWithinAbsoluteError(summary.max, 0.745f, 1.0e-6f);
+
+        beginTest("Empty spans");
+        expectEquals(PeakKernel::summarise(positive, 10, 0, 1).count, 0);
+        expectEquals(PeakKernel::summarise(positive, 0, 100, 0).count, 0);
+    }
+};
+
+// Summarising stereo at 48 kHz in display-sized spans, the way the pyramid
+// and the raw zoomed-in path use it, from a short take up to the three-minute
+// recording limit. Reports samples per second, counting every channel.
+class PeakKernelBenchmark final : public juce::UnitTest
+{
+public:
+    PeakKernelBenchmark() : juce::UnitTest("PeakKernel throughput", TestCategories::benchmark) {}
+
+    void runTest() override
+    {
+        auto random = getRandom();
+
+        for (const int seconds : { 1, 30, 180 })
+        {
+            beginTest(juce::String(seconds) + " s stereo in 256-sample spans");
+            runLength(makeNoise(random, 2, seconds * 48000));
+        }
+    }
+
+private:
+    void runLength(const juce::AudioBuffer<float>& buffer)
+    {
+        constexpr int span = 256;
+        float sink = 0.0f;
+
+        // A one-second buffer is over in well under a millisecond
+        const int runs = buffer.getNumSamples() < 10 * 48000 ? 50 : 5;
+
+        const double kernelMs = TestCategories::timeBestOf(runs, [&]
+        {
+            for (int start = 0; start + span <= buffer.getNumSamples(); start += span)
+                sink += PeakKernel::summarise(buffer, start, span, 2).max;
+        });
+
+        const double scalarMs = TestCategories::timeBestOf(runs, [&]
+        {
+            for (int start = 0; start + span <= buffer.getNumSamples(); start += span)
+                sink += summariseScalar(buffer, start, span, 2).max;
+        });
+
+        const auto samplesPerSecond = [&buffer](double ms)
+        {
+            const double samples = (double)buffer.getNumSamples() * buffer.getNumChannels();
+            return juce::String(samples / juce::jmax(1.0e-6, ms / 1000.0) / 1.0e6, 1) + " M samples/s";
+        };
+
+        expect(sink > 0.0f);
+        logMessage("PeakKernel " + samplesPerSecond(kernelMs) + ", scalar " + samplesPerSecond(scalarMs)
+                   + " (" + juce::String(scalarMs / juce::jmax(0.001, kernelMs), 1) + "x)");
+    }
+};
+
+static PeakKernelTests peakKernelTests;
+static PeakKernelBenchmark peakKernelBenchmark;
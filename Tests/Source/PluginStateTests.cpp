@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// PluginStateTests.cpp
+#include <JuceHeader.h>
+#include "TestCategories.h"
+#include "../../Source/PluginProcessor.h"
+
+namespace
+{
+    // Editor state the size of a well-used session: every model's prompts,
+    // settings and a long history.
+    juce::String makeEditorState(juce::Random& random)
+    {
+        auto* root = new juce::DynamicObject();
+        juce::Array<juce::var> history;
+
+        for (int i = 0; i < 400; ++i)
+        {
+            auto* entry = new juce::DynamicObject();
+            entry->setProperty("prompt", "lofi \"dusty\" keys, take " + juce::String(random.nextInt(100000)) + "\n\tswing 58%");
+            entry->setProperty("bpm", 60 + random.nextInt(120));
+            entry->setProperty("seed", random.nextInt64());
+            history.add(juce::var(entry));
+        }
+
+        root->setProperty("history", history);
+        root->setProperty("activeTab", "jerry");
+        return juce::JSON::toString(juce::var(root), true);
+    }
+
+    // The XML chunk stateVersion 2 wrote, for comparison and for the
+    // migration path.
+    void writeLegacyState(const juce::String& editorState, juce::MemoryBlock& destData)
+    {
+        juce::XmlElement xmlState("GARY_STATE");
+        xmlState.setAttribute("stateVersion", 2);
+        xmlState.setAttribute("savedSamples", 0);
+        xmlState.setAttribute("currentSessionId", juce::String());
+        xmlState.setAttribute("sessionTimestamp", juce::String(0));
+        xmlState.setAttribute("careyLanguage", "en");
+        xmlState.setAttribute("foundationState", juce::String());
+        xmlState.setAttribute("editorState", editorState);
+        juce::AudioProcessor::copyXmlToBinary(xmlState, destData);
+    }
+}
+
+// Save and load round trips for the binary state chunk, and migration from
+// the XML chunk older versions saved.
+class PluginStateTests final : public juce::UnitTest
+{
+public:
+    PluginStateTests() : juce::UnitTest("Plugin state", TestCategories::unit) {}
+
+    void runTest() override
+    {
+        auto random = getRandom();
+        const auto editorState = makeEditorState(random);
+
+        beginTest("Binary state round trips");
+        {
+            Gary4juceAudioProcessor source, restored;
+            source.setEditorState(editorState);
+            source.setFoundationState("{\"steps\":16}");
+
+            juce::MemoryBlock saved;
+            source.getStateInformation(saved);
+            restored.setStateInformation(saved.getData(), (int)saved.getSize());
+
+            expectEquals(restored.getEditorState(), editorState);
+            expectEquals(restored.getFoundationState(), juce::String("{\"steps\":16}"));
+
+            juce::MemoryBlock resaved;
+            restored.getStateInformation(resaved);
+            expect(resaved == saved, "saving a restored state reproduces it byte for byte");
+        }
+
+        beginTest("XML state from older versions still loads");
+        {
+            juce::MemoryBlock legacy;
+            writeLegacyState(editorState, legacy);
+
+            Gary4juceAudioProcessor restored;
+            restored.setStateInformation(legacy.getData(), (int)legacy.getSize());
+            expectEquals(restored.getEditorState(), editorState);
+        }
+
+        beginTest("Garbage is ignored");
+        {
+            Gary4juceAudioProcessor restored;
+            restored.setEditorState(editorState);
+
+            juce::MemoryBlock garbage(4096);
+            random.fillBitsRandomly(garbage.getData(), garbage.getSize());
+            restored.setStateInformation(garbage.getData(), (int)garbage.getSize());
+            expectEquals(restored.getEditorState(), editorState);
+        }
+    }
+};
+
+// A project with 100 instances being saved and reopened: every instance's
+// state written, then every instance restored, in the binary format and in
+// the XML one it replaced.
+class PluginStateBenchmark final : public juce::UnitTest
+{
+public:
+    PluginStateBenchmark() : juce::UnitTest("Plugin state, 100 instances", TestCategories::benchmark) {}
+
+    void runTest() override
+    {
+        constexpr int numInstances = 100;
+        beginTest("Save and load " + juce::String(numInstances) + " instances");
+
+        auto random = getRandom();
+        juce::OwnedArray<Gary4juceAudioProcessor> instances;
+        juce::StringArray editorStates;
+
+        for (int i = 0; i < numInstances; ++i)
+        {
+            editorStates.add(makeEditorState(random));
+            instances.add(new Gary4juceAudioProcessor())->setEditorState(editorStates[i]);
+        }
+
+        std::vector<juce::MemoryBlock> binary((size_t)numInstances), legacy((size_t)numInstances);
+
+        const double binarySaveMs = TestCategories::timeBestOf(3, [&]
+        {
+            for (int i = 0; i < numInstances; ++i)
+                instances[i]->getStateInformation(binary[(size_t)i]);
+        });
+
+        const double binaryLoadMs = TestCategories::timeBestOf(3, [&]
+        {
+            for (int i = 0; i < numInstances; ++i)
+                instances[i]->setStateInformation(binary[(size_t)i].getData(), (int)binary[(size_t)i].getSize());
+        });
+
+        const double legacySaveMs = TestCategories::timeBestOf(3, [&]
+        {
+            for (int i = 0; i < numInstances; ++i)
+                writeLegacyState(instances[i]->getEditorState(), legacy[(size_t)i]);
+        });
+
+        const double legacyLoadMs = TestCategories::timeBestOf(3, [&]
+        {
+            for (int i = 0; i < numInstances; ++i)
+                instances[i]->setStateInformation(legacy[(size_t)i].getData(), (int)legacy[(size_t)i].getSize());
+        });
+
+        for (int i = 0; i < numInstances; ++i)
+            expectEquals(instances[i]->getEditorState(), editorStates[i]);
+
+        juce::int64 binaryBytes = 0, legacyBytes = 0;
+        for (int i = 0; i < numInstances; ++i)
+        {
+            binaryBytes += (juce::int64)binary[(size_t)i].getSize();
+            legacyBytes += (juce::int64)legacy[(size_t)i].getSize();
+        }
+
+        logMessage("binary: save " + juce::String(binarySaveMs, 1) + " ms, load " + juce::String(binaryLoadMs, 1)
+                   + " ms, " + juce::String(binaryBytes / 1024) + " KB");
+        logMessage("XML:    save " + juce::String(legacySaveMs, 1) + " ms, load " + juce::String(legacyLoadMs, 1)
+                   + " ms, " + juce::String(legacyBytes / 1024) + " KB");
+    }
+};
+
+static PluginStateTests pluginStateTests;
+static PluginStateBenchmark pluginStateBenchmark;
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// RealtimeHandoffTests.cpp
+#include <JuceHeader.h>
+#include "TestCategories.h"
+#include "../../Source/Audio/RealtimeHandoff.h"
+#include <array>
+#include <thread>
+
+// One thread standing in for processBlock reads the current object in tight
+// ScopedRead blocks while another publishes replacements as fast as it can.
+// Every object checks on destruction that no reader is inside it, and the
+// reader checks each object it sees is whole; any free under a reader or torn
+// object shows up as a counted violation.
+class RealtimeHandoffTests final : public juce::UnitTest
+{
+public:
+    RealtimeHandoffTests() : juce::UnitTest("RealtimeHandoff", TestCategories::unit) {}
+
+    void runTest() override
+    {
+        beginTest("Swap stress: nothing is freed under the reader");
+
+        std::atomic<int> violations { 0 };
+        std::atomic<int> alive { 0 };
+        std::atomic<bool> running { true };
+        juce::int64 blocksRead = 0;
+
+        {
+            RealtimeHandoff<Payload> handoff;
+            handoff.publish(std::make_unique<Payload>(0, alive, violations));
+
+            std::thread reader([&]
+            {
+                while (running.load(std::memory_order_acquire))
+                {
+                    RealtimeHandoff<Payload>::ScopedRead read(handoff);
+                    if (!read)
+                        continue;
+
+                    read->readers.fetch_add(1);
+                    if (!read->isWhole())
+                        violations.fetch_add(1);
+                    read->readers.fetch_sub(1);
+                    ++blocksRead;
+                }
+            });
+
+            for (int generation = 1; generation <= 200000; ++generation)
+                handoff.publish(std::make_unique<Payload>(generation, alive, violations));
+
+            running = false;
+            reader.join();
+
+            // Published objects still retired wait for the timer or the next
+            // publish; one more publish with the reader gone collects them.
+            handoff.publish(std::make_unique<Payload>(-1, alive, violations));
+            expectEquals(handoff.getNumRetired(), 0);
+            expectEquals(alive.load(), 1);
+        }
+
+        expectEquals(violations.load(), 0);
+        expectEquals(alive.load(), 0, "everything freed with the handoff");
+        expect(blocksRead > 0);
+    }
+
+private:
+    struct Payload
+    {
+        static constexpr int numValues = 64;
+
+        Payload(int generationToUse, std::atomic<int>& aliveCount, std::atomic<int>& violationCount)
+            : generation(generationToUse), alive(aliveCount), violations(violationCount)
+        {
+            values.fill(generation);
+            canary = liveCanary;
+            alive.fetch_add(1);
+        }
+
+        ~Payload()
+        {
+            if (readers.load() != 0)
+                violations.fetch_add(1);
+
+            canary = deadCanary;
+            values.fill(-2);
+            alive.fetch_sub(1);
+        }
+
+        bool isWhole() const noexcept
+        {
+            if (canary != liveCanary)
+                return false;
+
+            for (auto value : values)
+                if (value != generation)
+                    return false;
+
+            return true;
+        }
+
+        static constexpr juce::uint32 liveCanary = 0x6a7e5a11;
+        static constexpr juce::uint32 deadCanary = 0xdeadbeef;
+
+        const int generation;
+        std::array<int, numValues> values {};
+        juce::uint32 canary = 0;
+        mutable std::atomic<int> readers { 0 };
+        std::atomic<int>& alive;
+        std::atomic<int>& violations;
+    };
+};
+
+static RealtimeHandoffTests realtimeHandoffTests;
@@ -0,0 +1,271 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// RecordingRingTests.cpp
+#include <JuceHeader.h>
+#include "TestCategories.h"
+#include "../../Source/Audio/RecordingRing.h"
+#include <cstring>
+#include <thread>
+
+// A producer pushes host-sized blocks of a known, never-silent signal into the
+// ring while a consumer that stalls rebuilds the take the way the recording
+// writer does: audio chunks copied, Gap chunks padded with silence.
+//
+// Sized like the processor's ring and paced in real time, stalls of a few
+// hundred milliseconds must lose nothing: the take comes back bit-identical.
+// A deliberately undersized ring checks the overflow path instead: the take
+// keeps its length, every sample is identical or padding, and the padding
+// adds up to the dropped count.
+class RecordingRingTests final : public juce::UnitTest
+{
+public:
+    RecordingRingTests() : juce::UnitTest("RecordingRing", TestCategories::unit) {}
+
+    void runTest() override
+    {
+        for (const int blockSize : { 64, 480, 1024 })
+        {
+            beginTest("Real-time stalls lose nothing, block size " + juce::String(blockSize));
+            runRealtimeHarness(blockSize);
+        }
+
+        for (const int blockSize : { 64, 480, 1024 })
+        {
+            beginTest("Undersized ring keeps the take aligned, block size " + juce::String(blockSize));
+            runOverflowHarness(blockSize);
+        }
+    }
+
+private:
+    static constexpr int numChannels = 2;
+    static constexpr double sampleRate = 48000.0;
+
+    // Gary4juceAudioProcessor::recordingRingLengthSeconds
+    static constexpr double ringLengthSeconds = 4.0;
+
+    // Distinct per channel and never zero, so a padded gap is unmistakable.
+    static float signalAt(int channel, juce::int64 sample) noexcept
+    {
+        return (float)(1 + (sample % 100003)) * (channel == 0 ? 1.0f : -1.0f) / 100003.0f;
+    }
+
+    struct Take
+    {
+        std::vector<std::vector<float>> channels = std::vector<std::vector<float>>((size_t)numChannels);
+        int takeStarts = 0;
+        int takeStops = 0;
+        int gaps = 0;
+    };
+
+    // Drains everything queued into take. Returns once nothing was left.
+    static void drainInto(RecordingRing& ring, Take& take)
+    {
+        ring.drain([&](const RecordingRing::Chunk& chunk, const juce::AudioBuffer<float>& storage, int storageStart)
+        {
+            switch (chunk.kind)
+            {
+                case RecordingRing::ChunkKind::TakeStart: ++take.takeStarts; break;
+                case RecordingRing::ChunkKind::TakeStop:  ++take.takeStops; break;
+
+                case RecordingRing::ChunkKind::Gap:
+                    ++take.gaps;
+                    for (auto& channel : take.channels)
+                        channel.insert(channel.end(), (size_t)chunk.numSamples, 0.0f);
+                    break;
+
+                case RecordingRing::ChunkKind::Audio:
+                    for (int channel = 0; channel < numChannels; ++channel)
+                    {
+                        const auto* data = storage.getReadPointer(channel, storageStart);
+                        auto& rebuilt = take.channels[(size_t)channel];
+                        rebuilt.insert(rebuilt.end(), data, data + chunk.numSamples);
+                    }
+                    break;
+            }
+
+            return true;
+        });
+    }
+
+    // Pushes totalSamples of the signal as a single take. With realtime set
+    // each block waits for its due time; otherwise blocks go in as fast as
+    // they can be made.
+    static void produce(RecordingRing& ring, int blockSize, juce::int64 totalSamples, bool realtime)
+    {
+        juce::AudioBuffer<float> block(numChannels, blockSize);
+        auto waitUntil = [](auto&& condition) { while (!condition()) juce::Thread::sleep(1); };
+
+        waitUntil([&] { return ring.pushMarker(RecordingRing::ChunkKind::TakeStart); });
+
+        const double startMs = juce::Time::getMillisecondCounterHiRes();
+
+        for (juce::int64 position = 0; position < totalSamples; position += blockSize)
+        {
+            if (realtime)
+            {
+                const double dueMs = startMs + 1000.0 * (double)position / sampleRate;
+                while (juce::Time::getMillisecondCounterHiRes() < dueMs)
+                    juce::Thread::sleep(1);
+            }
+            else if ((position / blockSize) % 20 == 0)
+            {
+                // Give the consumer a look-in now and then
+                std::this_thread::yield();
+            }
+
+            const int count = (int)juce::jmin((juce::int64)blockSize, totalSamples - position);
+            for (int channel = 0; channel < numChannels; ++channel)
+                for (int i = 0; i < count; ++i)
+                    block.setSample(channel, i, signalAt(channel, position + i));
+
+            ring.pushAudio(block, numChannels, count);
+        }
+
+        // Loss still pending at the end is only reported with the next push;
+        // let the consumer make room so an empty push can deliver it.
+        waitUntil([&] { return ring.getNumReady() == 0; });
+        ring.pushAudio(block, numChannels, 0);
+        waitUntil([&] { return ring.pushMarker(RecordingRing::ChunkKind::TakeStop); });
+    }
+
+    void runRealtimeHarness(int blockSize)
+    {
+        // Prepared the way prepareToPlay() prepares the processor's ring
+        const int chunkSamples = juce::jmax(32, blockSize);
+        RecordingRing ring;
+        ring.prepare(numChannels, chunkSamples,
+                     (int)std::ceil(ringLengthSeconds * sampleRate / chunkSamples) + 1);
+
+        const juce::int64 totalSamples = (juce::int64)(sampleRate * 4.0);
+        std::atomic<bool> producerDone { false };
+        Take take;
+        int stalls = 0;
+
+        const auto seed = getRandom().nextInt64();
+
+        std::thread consumer([&]
+        {
+            juce::Random random(seed);
+            double nextStallMs = juce::Time::getMillisecondCounterHiRes() + 300.0;
+
+            for (;;)
+            {
+                const bool finished = producerDone.load(std::memory_order_acquire);
+                drainInto(ring, take);
+
+                if (finished && ring.getNumReady() == 0)
+                    break;
+
+                // A snapshot reader or a slow disk holding the writer off
+                if (juce::Time::getMillisecondCounterHiRes() >= nextStallMs)
+                {
+                    juce::Thread::sleep(200 + random.nextInt(301));
+                    nextStallMs = juce::Time::getMillisecondCounterHiRes() + 300.0 + random.nextInt(500);
+                    ++stalls;
+                }
+                else
+                {
+                    juce::Thread::sleep(2);
+                }
+            }
+        });
+
+        produce(ring, blockSize, totalSamples, true);
+
+        producerDone = true;
+        consumer.join();
+
+        expect(stalls > 0, "the consumer stalled");
+        expectEquals(ring.getDroppedSamples(), (juce::int64)0, "dropped samples");
+        expectEquals(ring.getOverflowCount(), 0, "overflows");
+        expectEquals(take.gaps, 0, "gap chunks");
+        expectEquals(take.takeStarts, 1);
+        expectEquals(take.takeStops, 1);
+        expectEquals((juce::int64)take.channels[0].size(), totalSamples, "rebuilt take length");
+
+        juce::int64 mismatches = 0;
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            const auto& rebuilt = take.channels[(size_t)channel];
+            for (juce::int64 sample = 0; sample < (juce::int64)rebuilt.size(); ++sample)
+            {
+                const float value = rebuilt[(size_t)sample];
+                const float expected = signalAt(channel, sample);
+                if (std::memcmp(&value, &expected, sizeof(float)) != 0)
+                    ++mismatches;
+            }
+        }
+
+        expectEquals(mismatches, (juce::int64)0, "samples not bit-identical");
+        logMessage(juce::String(stalls) + " stalls, peak fill " + juce::String(ring.getPeakFill() * 100.0f, 1) + "%");
+    }
+
+    void runOverflowHarness(int blockSize)
+    {
+        // Far smaller than the processor's: a 20 ms stall overflows it
+        RecordingRing ring;
+        ring.prepare(numChannels, 256, 16);
+
+        const juce::int64 totalSamples = (juce::int64)(sampleRate * 20.0);
+        std::atomic<bool> producerDone { false };
+        Take take;
+
+        const auto seed = getRandom().nextInt64();
+
+        std::thread consumer([&]
+        {
+            juce::Random random(seed);
+
+            // Held off from the start, so the producer is sure to overflow
+            juce::Thread::sleep(20);
+
+            for (;;)
+            {
+                const bool finished = producerDone.load(std::memory_order_acquire);
+                drainInto(ring, take);
+
+                if (finished && ring.getNumReady() == 0)
+                    break;
+
+                // Mostly keeps up; now and then stalls long enough to overflow
+                if (random.nextInt(50) == 0)
+                    juce::Thread::sleep(random.nextInt(20));
+                else
+                    std::this_thread::yield();
+            }
+        });
+
+        produce(ring, blockSize, totalSamples, false);
+
+        producerDone = true;
+        consumer.join();
+
+        expect(ring.getDroppedSamples() > 0, "the undersized ring overflowed");
+        expectEquals(take.takeStarts, 1);
+        expectEquals(take.takeStops, 1);
+        expectEquals((juce::int64)take.channels[0].size(), totalSamples, "rebuilt take length");
+
+        juce::int64 zeros = 0, mismatches = 0;
+        for (juce::int64 sample = 0; sample < (juce::int64)take.channels[0].size(); ++sample)
+        {
+            const bool silent = take.channels[0][(size_t)sample] == 0.0f;
+            zeros += silent ? 1 : 0;
+
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                const float value = take.channels[(size_t)channel][(size_t)sample];
+                const float expected = silent ? 0.0f : signalAt(channel, sample);
+                if (std::memcmp(&value, &expected, sizeof(float)) != 0)
+                    ++mismatches;
+            }
+        }
+
+        expectEquals(mismatches, (juce::int64)0, "samples neither identical nor padded");
+        expectEquals(zeros, ring.getDroppedSamples(), "padded samples match the dropped count");
+        logMessage("dropped " + juce::String(ring.getDroppedSamples()) + " samples in "
+                   + juce::String(ring.getOverflowCount()) + " overflows");
+    }
+};
+
+static RecordingRingTests recordingRingTests;
@@ -0,0 +1,299 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// StreamingResamplerTests.cpp
+#include <JuceHeader.h>
+#include "TestCategories.h"
+#include "../../Source/Audio/StreamingResampler.h"
+
+namespace
+{
+    juce::AudioBuffer<float> makeSine(int numChannels, int numSamples, double frequency, double sampleRate)
+    {
+        juce::AudioBuffer<float> buffer(numChannels, numSamples);
+        for (int channel = 0; channel < numChannels; ++channel)
+            for (int i = 0; i < numSamples; ++i)
+                buffer.setSample(channel, i, (float)std::sin(juce::MathConstants<double>::twoPi * frequency * i / sampleRate));
+        return buffer;
+    }
+
+    // Largest difference from the ideal sine, skipping the edges where the
+    // kernel runs into the silence before and after the source. Output sample
+    // m is compared with the source at input time m * step - latency.
+    float maxSineError(const juce::AudioBuffer<float>& output, double frequency, double sourceRate,
+                       double step, double latency)
+    {
+        constexpr int edge = 512;
+        float worst = 0.0f;
+
+        for (int channel = 0; channel < output.getNumChannels(); ++channel)
+            for (int m = edge; m < output.getNumSamples() - edge; ++m)
+            {
+                const double time = (double)m * step - latency;
+                const auto ideal = (float)std::sin(juce::MathConstants<double>::twoPi * frequency * time / sourceRate);
+                worst = juce::jmax(worst, std::abs(output.getSample(channel, m) - ideal));
+            }
+
+        return worst;
+    }
+
+    // Level of what came out, in dB relative to a full-scale sine, with the
+    // same edges skipped. For a source tone above the destination Nyquist the
+    // ideal output is silence, so this is how loud its alias is.
+    double aliasLevelDb(const juce::AudioBuffer<float>& output)
+    {
+        constexpr int edge = 512;
+        double sumOfSquares = 0.0;
+        juce::int64 count = 0;
+
+        for (int channel = 0; channel < output.getNumChannels(); ++channel)
+            for (int m = edge; m < output.getNumSamples() - edge; ++m)
+            {
+                const double sample = output.getSample(channel, m);
+                sumOfSquares += sample * sample;
+                ++count;
+            }
+
+        const double rms = count > 0 ? std::sqrt(sumOfSquares / (double)count) : 0.0;
+        return juce::Decibels::gainToDecibels(rms * juce::MathConstants<double>::sqrt2, -200.0);
+    }
+
+    juce::AudioBuffer<float> resampleLagrange(const juce::AudioBuffer<float>& source, double sourceRate, double destRate)
+    {
+        const double step = sourceRate / destRate;
+        const int outputLength = (int)std::floor((double)source.getNumSamples() / step) - 4;
+        juce::AudioBuffer<float> result(source.getNumChannels(), juce::jmax(0, outputLength));
+
+        for (int channel = 0; channel < source.getNumChannels(); ++channel)
+        {
+            juce::LagrangeInterpolator interpolator;
+            interpolator.process(step, source.getReadPointer(channel), result.getWritePointer(channel),
+                                 result.getNumSamples());
+        }
+
+        return result;
+    }
+}
+
+// Accuracy against ideal sines, rejection of tones the destination rate can't
+// hold, and that pushing a source through in uneven chunks gives the same
+// samples as one whole-buffer pass.
+class StreamingResamplerTests final : public juce::UnitTest
+{
+public:
+    StreamingResamplerTests() : juce::UnitTest("StreamingResampler", TestCategories::unit) {}
+
+    void runTest() override
+    {
+        using Quality = StreamingResampler::Quality;
+
+        beginTest("Sine accuracy");
+        {
+            struct Case { double sourceRate, destRate; Quality quality; float tolerance; };
+            const Case cases[] = {
+                { 44100.0, 48000.0, Quality::Draft,    1.0e-2f },
+                { 44100.0, 48000.0, Quality::Standard, 1.0e-3f },
+                { 44100.0, 48000.0, Quality::High,     1.0e-4f },
+                { 48000.0, 44100.0, Quality::Standard, 1.0e-3f },
+                { 48000.0, 22050.0, Quality::High,     1.0e-4f },
+                { 32000.0, 96000.0, Quality::High,     1.0e-4f },
+            };
+
+            for (const auto& c : cases)
+            {
+                const auto source = makeSine(2, (int)c.sourceRate, 1000.0, c.sourceRate);
+                const auto output = StreamingResampler::resampleBuffer(source, c.sourceRate, c.destRate, c.quality);
+
+                expectEquals(output.getNumSamples(), (int)c.destRate);
+                expectLessThan(maxSineError(output, 1000.0, c.sourceRate, c.sourceRate / c.destRate, 0.0), c.tolerance);
+            }
+        }
+
+        beginTest("Downsampling rejects tones above the new Nyquist");
+        {
+            // 30 kHz would fold back to 18 kHz and 14.1 kHz
+            for (const double destRate : { 48000.0, 44100.0 })
+            {
+                const auto source = makeSine(2, 96000, 30000.0, 96000.0);
+                const auto output = StreamingResampler::resampleBuffer(source, 96000.0, destRate, Quality::High);
+                expectLessThan(aliasLevelDb(output), -60.0);
+            }
+        }
+
+        beginTest("Chunked input matches one pass");
+        {
+            auto random = getRandom();
+            const auto source = makeSine(2, 30000, 440.0, 44100.0);
+            const auto whole = StreamingResampler::resampleBuffer(source, 44100.0, 48000.0, Quality::Standard);
+
+            StreamingResampler resampler;
+            resampler.prepare(2, 44100.0, 48000.0, Quality::Standard);
+
+            juce::AudioBuffer<float> chunked(2, whole.getNumSamples() + 64);
+            juce::AudioBuffer<float> scratch(2, resampler.getMaxOutputSamples(1000) + 64);
+            int written = 0;
+
+            const auto append = [&](int produced)
+            {
+                const int toCopy = juce::jmin(produced, chunked.getNumSamples() - written);
+                for (int channel = 0; channel < 2; ++channel)
+                    chunked.copyFrom(channel, written, scratch, channel, 0, toCopy);
+                written += toCopy;
+            };
+
+            for (int position = 0; position < source.getNumSamples();)
+            {
+                const int count = juce::jmin(1 + random.nextInt(1000), source.getNumSamples() - position);
+                const float* input[] = { source.getReadPointer(0, position), source.getReadPointer(1, position) };
+                append(resampler.process(input, count, scratch.getArrayOfWritePointers(), scratch.getNumSamples()));
+                position += count;
+            }
+
+            append(resampler.flush(scratch.getArrayOfWritePointers(), scratch.getNumSamples()));
+            expect(written >= whole.getNumSamples());
+
+            float worst = 0.0f;
+            for (int channel = 0; channel < 2; ++channel)
+                for (int i = 0; i < whole.getNumSamples(); ++i)
+                    worst = juce::jmax(worst, std::abs(whole.getSample(channel, i) - chunked.getSample(channel, i)));
+            expectEquals(worst, 0.0f);
+        }
+
+        beginTest("Primed restart matches one pass");
+        {
+            // Starting partway through, as a seek does, gives the samples a
+            // whole pass has there rather than fading in from silence
+            const double step = 44100.0 / 48000.0;
+            const auto source = makeSine(2, 30000, 440.0, 44100.0);
+            const auto whole = StreamingResampler::resampleBuffer(source, 44100.0, 48000.0, Quality::Standard);
+
+            StreamingResampler resampler;
+            resampler.prepare(2, 44100.0, 48000.0, Quality::Standard);
+
+            constexpr int startOutput = 10007;
+            const double startTime = startOutput * step;
+            const int start = (int)startTime;
+            const int primingLength = resampler.getPrimingLength();
+
+            const float* priming[] = { source.getReadPointer(0, start - primingLength),
+                                       source.getReadPointer(1, start - primingLength) };
+            resampler.resetAt(priming, startTime - start);
+
+            juce::AudioBuffer<float> output(2, resampler.getMaxOutputSamples(4096));
+            const float* input[] = { source.getReadPointer(0, start), source.getReadPointer(1, start) };
+            const int produced = resampler.process(input, 4096, output.getArrayOfWritePointers(), output.getNumSamples());
+            expect(produced > 4000);
+
+            float worst = 0.0f;
+            for (int channel = 0; channel < 2; ++channel)
+                for (int i = 0; i < produced; ++i)
+                    worst = juce::jmax(worst, std::abs(whole.getSample(channel, startOutput + i) - output.getSample(channel, i)));
+            // Standard's sine tolerance: where an output lands on a whole
+            // input sample, the two timelines can round to either side of it
+            expectLessThan(worst, 1.0e-3f);
+        }
+
+        beginTest("Matching rates bypass");
+        {
+            const auto source = makeSine(1, 1000, 440.0, 48000.0);
+            const auto output = StreamingResampler::resampleBuffer(source, 48000.0, 48000.0);
+            expectEquals(output.getNumSamples(), 1000);
+            expectEquals(output.getSample(0, 123), source.getSample(0, 123));
+        }
+    }
+};
+
+// A minute of stereo through each rate pair the plugin meets, at each quality
+// and through JUCE's Lagrange interpolator, the path this replaced. Next to
+// each timing: the worst error on a 1 kHz and a 10 kHz sine, and for the
+// downsampling pairs how loud a tone above the destination Nyquist comes out.
+// That tone should come out as silence, so its level is the aliasing.
+class StreamingResamplerBenchmark final : public juce::UnitTest
+{
+public:
+    StreamingResamplerBenchmark() : juce::UnitTest("StreamingResampler throughput", TestCategories::benchmark) {}
+
+    void runTest() override
+    {
+        // aliasTone is above destRate / 2, or 0 when upsampling
+        struct RatePair { double sourceRate, destRate, aliasTone; };
+        const RatePair pairs[] = {
+            { 44100.0, 48000.0, 0.0 },
+            { 96000.0, 48000.0, 30000.0 },
+            { 96000.0, 44100.0, 30000.0 },
+            { 48000.0, 44100.0, 23500.0 },
+        };
+
+        float sink = 0.0f;
+        for (const auto& pair : pairs)
+            runPair(pair.sourceRate, pair.destRate, pair.aliasTone, sink);
+
+        expect(std::isfinite(sink));
+    }
+
+private:
+    static juce::String khz(double rate)
+    {
+        return juce::String(rate / 1000.0, rate == std::floor(rate / 1000.0) * 1000.0 ? 0 : 1) + " kHz";
+    }
+
+    void runPair(double sourceRate, double destRate, double aliasTone, float& sink)
+    {
+        using Quality = StreamingResampler::Quality;
+        const double step = sourceRate / destRate;
+
+        beginTest("60 s stereo, " + khz(sourceRate) + " to " + khz(destRate));
+
+        const auto source = makeSine(2, 60 * (int)sourceRate, 1000.0, sourceRate);
+        const auto high = makeSine(2, 5 * (int)sourceRate, 10000.0, sourceRate);
+        const auto aliasing = aliasTone > 0.0 ? makeSine(2, 5 * (int)sourceRate, aliasTone, sourceRate)
+                                              : juce::AudioBuffer<float>();
+
+        const auto report = [&](const juce::String& name, double ms, float lowError, float highError,
+                                const juce::AudioBuffer<float>& aliased)
+        {
+            auto line = name.paddedRight(' ', 10) + juce::String(ms, 2) + " ms, max error "
+                      + juce::String(lowError, 6) + " at 1 kHz, " + juce::String(highError, 6) + " at 10 kHz";
+
+            if (aliasTone > 0.0)
+                line << ", " << khz(aliasTone) << " aliases at " << juce::String(aliasLevelDb(aliased), 1) << " dB";
+
+            logMessage(line);
+        };
+
+        const std::pair<const char*, Quality> qualities[] = {
+            { "Draft", Quality::Draft }, { "Standard", Quality::Standard }, { "High", Quality::High }
+        };
+
+        for (const auto& entry : qualities)
+        {
+            const auto quality = entry.second;
+            const double ms = TestCategories::timeBestOf(3, [&]
+            {
+                sink += StreamingResampler::resampleBuffer(source, sourceRate, destRate, quality).getSample(0, 1000);
+            });
+
+            report(entry.first, ms,
+                   maxSineError(StreamingResampler::resampleBuffer(source, sourceRate, destRate, quality),
+                                1000.0, sourceRate, step, 0.0),
+                   maxSineError(StreamingResampler::resampleBuffer(high, sourceRate, destRate, quality),
+                                10000.0, sourceRate, step, 0.0),
+                   aliasTone > 0.0 ? StreamingResampler::resampleBuffer(aliasing, sourceRate, destRate, quality)
+                                   : juce::AudioBuffer<float>());
+        }
+
+        const auto lagrangeLatency = (double)juce::LagrangeInterpolator::getBaseLatency();
+        const double lagrangeMs = TestCategories::timeBestOf(3, [&]
+        {
+            sink += resampleLagrange(source, sourceRate, destRate).getSample(0, 1000);
+        });
+
+        report("Lagrange", lagrangeMs,
+               maxSineError(resampleLagrange(source, sourceRate, destRate), 1000.0, sourceRate, step, lagrangeLatency),
+               maxSineError(resampleLagrange(high, sourceRate, destRate), 10000.0, sourceRate, step, lagrangeLatency),
+               aliasTone > 0.0 ? resampleLagrange(aliasing, sourceRate, destRate) : juce::AudioBuffer<float>());
+    }
+};
+
+static StreamingResamplerTests streamingResamplerTests;
+static StreamingResamplerBenchmark streamingResamplerBenchmark;
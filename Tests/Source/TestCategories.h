@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2025-2026 Kevin Griffing
+// SPDX-License-Identifier: AGPL-3.0-only
+
+// TestCategories.h
+#pragma once
+#include <JuceHeader.h>
+#include <limits>
+
+// Unit tests run on every invocation; benchmarks only when asked for, as they
+// take seconds and only report timings.
+namespace TestCategories
+{
+    static const juce::String unit { "gary4juce" };
+    static const juce::String benchmark { "gary4juce benchmarks" };
+
+    // Best of a few runs of function, in milliseconds.
+    template <typename Function>
+    double timeBestOf(int runs, Function&& function)
+    {
+        double best = std::numeric_limits<double>::max();
+
+        for (int run = 0; run < runs; ++run)
+        {
+            const auto start = juce::Time::getMillisecondCounterHiRes();
+            function();
+            best = juce::jmin(best, juce::Time::getMillisecondCounterHiRes() - start);
+        }
+
+        return best;
+    }
+}